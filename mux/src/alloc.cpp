@@ -7,6 +7,11 @@
  * adds value by greatly reducing the number and strength of calls to the
  * underlying platform's memory management. It also adds headers and footer to
  * detect misuse of buffers by its callers.
+ *
+ * When built with LEAN_POOLS, buffers are instead carved end to end from
+ * pages with no header or footer, the freelist is kept inside the free
+ * buffers themselves, and corruption checks are made on only a sample of
+ * allocations and frees.
  */
 
 #include "copyright.h"
@@ -20,18 +25,20 @@
  * aligned to avoid faults when the client accesses structure members within
  * in the client area.  64-bit alignment should be sufficient.
  *
- * The magicnum and pool_size are chosen when the pool it initialized. next
- * and nxtfree are managed as buffers are allocated and freed. buf_tag comes
- * from the client so that buffers can be associated with the places that
- * allocated them.
+ * The magicnum and pool_size are chosen when the pool it initialized. next,
+ * nxtfree, and bFree are managed as buffers are allocated and freed. buf_tag
+ * comes from the client so that buffers can be associated with the places
+ * that allocated them.
  */
 
 typedef struct pool_header
 {
     unsigned int        magicnum;   // For consistency check
+    bool                bFree;      // Buffer is not in use
     size_t              pool_size;  // For consistency check
     struct pool_header *next;       // Next pool header in chain
     struct pool_header *nxtfree;    // Next pool header in freelist
+    struct arena_slab  *slab;       // Slab holding an arena buffer
     union
     {
         const UTF8     *buf_tag;    // Debugging/trace tag
@@ -55,119 +62,1001 @@ typedef struct pool_footer
  * The head of the free list and in-use list are contained here.
  */
 
+#if defined(LEAN_POOLS)
+
+/*! \brief Page from which a lean pool carves its buffers.
+ *
+ * Buffers follow this structure end to end, each pool_alloc_size bytes
+ * long, with nothing between them.
+ */
+
+typedef struct pool_page
+{
+    struct pool_page *next;         // Next page in this pool
+    UTF8             *pEnd;         // End of the last buffer
+    UINT64            align;        // Not used.
+} POOLPAGE;
+
+/*! \brief Overlay on a free buffer in a lean pool.
+ *
+ * A free buffer holds the freelist link followed by the pool's magic
+ * number.  The magic number is cleared when the buffer is handed out, and
+ * not finding it on a sampled allocation means the buffer was modified after
+ * it was freed.  Once handed out, those bytes belong to the client and may
+ * hold anything, so the magic number is only a hint.  Whether a buffer is
+ * free is decided by its membership in the freelist.
+ */
+
+typedef struct pool_free
+{
+    struct pool_free *nxtfree;      // Next buffer in freelist
+    unsigned int      magicnum;     // Marks the buffer as free
+} POOLFREE;
+
+#define POOL_PAGE_SIZE       65536  // Bytes of buffers in a page, at least
+#define POOL_SAMPLE_INTERVAL 64     // Check one in this many allocs and frees
+
+#endif // LEAN_POOLS
+
 typedef struct pooldata
 {
     size_t pool_client_size;        // Size in bytes of a buffer as seen by client.
     size_t pool_alloc_size;         // Size as allocated from system.
     unsigned int poolmagic;         // Magic number specific to this pool
+#if defined(LEAN_POOLS)
+    POOLFREE *free_head;            // Buffer freelist head
+    POOLPAGE *page_head;            // Page chain head
+    size_t pool_page_bufs;          // Buffers carved from each page
+#else
     POOLHDR *free_head;             // Buffer freelist head
     POOLHDR *chain_head;            // Buffer chain head
+#endif // LEAN_POOLS
     UINT64 tot_alloc;               // Total buffers allocated
     UINT64 num_alloc;               // Number of buffers currently allocated
     UINT64 max_alloc;               // Max # buffers allocated at one time
     UINT64 num_lost;                // Buffers lost due to corruption
 } POOL;
 
-static POOL pools[NUM_POOLS];
-static const UTF8 *poolnames[] =
-{
-    T("Lbufs"),
-    T("Sbufs"),
-    T("Mbufs"),
-    T("Bools"),
-    T("Descs"),
-    T("Qentries"),
-    T("Pcaches"),
-    T("Lbufrefs"),
-    T("Regrefs"),
-    T("Strings")
-};
+static POOL pools[NUM_POOLS];
+
+/*! \brief Slab from which an evaluation arena hands out buffers.
+ *
+ * Buffers are carved from the data area which follows this structure by
+ * bumping pFree.  They carry the same POOLHDR and POOLFTR as pool buffers,
+ * but with the complement of the pool's magic number, so that pool_free()
+ * can tell them apart.  A slab whose buffers are all freed is rewound.  A
+ * slab which still has live buffers when its command finishes is pinned and
+ * deleted when the last of those buffers is freed.
+ */
+
+typedef struct arena_slab
+{
+    struct arena_slab *next;        // Next slab in the arena or spare list
+    UTF8              *pFree;       // First unused byte of the data area
+    UTF8              *pEnd;        // End of the data area
+    size_t             nLive;       // Buffers handed out and not yet freed
+    bool               bPinned;     // Outlived the command that made it
+    UINT64             align;       // Not used.
+} ARENA_SLAB;
+
+#define ARENA_ROUND(n)   (((n) + 7) & ~((size_t)7))
+#define ARENA_BUF(n)     ARENA_ROUND(sizeof(POOLHDR) + (n) + sizeof(POOLFTR))
+#define ARENA_SLAB_DATA  (4*ARENA_BUF(LBUF_SIZE))
+#define ARENA_SPARE_MAX  8
+
+static struct
+{
+    int         nDepth;             // Nesting of pool_arena_open()
+    bool        bActive;            // Allocations are being taken from slabs
+    ARENA_SLAB *pSlabs;             // Slabs used by this command, newest first
+    ARENA_SLAB *pSpare;             // Empty slabs kept for the next command
+    ARENA_SLAB *pPinned;            // Slabs kept alive by escaped buffers
+    int         nSpare;             // Number of spare slabs
+    int         nSlabs;             // Slabs used by this command
+    int         nSlabsMax;          // High-water mark of nSlabs
+    int         nPinned;            // Slabs kept alive by escaped buffers
+    size_t      nBytes;             // Bytes in live buffers for this command
+    size_t      nBytesMax;          // High-water mark of nBytes
+    UINT64      nCommands;          // Commands run with an active arena
+    UINT64      tot_alloc;          // Total buffers taken from slabs
+    UINT64      tot_escaped;        // Buffers which outlived their command
+#if defined(LEAN_POOLS)
+    ARENA_SLAB **apIndex;           // Every slab, in address order
+    int         nIndex;             // Slabs in apIndex
+    int         nIndexMax;          // Capacity of apIndex
+#endif // LEAN_POOLS
+} arena;
+
+#if defined(LEAN_POOLS)
+static int nPoolSample = POOL_SAMPLE_INTERVAL;
+#endif // LEAN_POOLS
+
+static const UTF8 *poolnames[] =
+{
+    T("Lbufs"),
+    T("Sbufs"),
+    T("Mbufs"),
+    T("Bools"),
+    T("Descs"),
+    T("Qentries"),
+    T("Pcaches"),
+    T("Lbufrefs"),
+    T("Regrefs"),
+    T("Strings")
+};
+
+/*! \brief Initialize a buffer pool.
+ *
+ * This is done once. The client size, magic, and allocation size are chosen
+ * at this time, and the free list and in-use list are initialized to empty.
+ * After this initialization, allocations can be done.
+ *
+ * \param poolnum  An integer uniquely indicating which pool.
+ * \param poolsize The size of the client area this pool supports.
+ * \return         None.
+ */
+
+void pool_init(int poolnum, int poolsize)
+{
+    pools[poolnum].pool_client_size = poolsize;
+#if defined(LEAN_POOLS)
+    size_t nAlloc = (static_cast<size_t>(poolsize) + 7) & ~((size_t)7);
+    if (nAlloc < sizeof(POOLFREE))
+    {
+        nAlloc = sizeof(POOLFREE);
+    }
+    pools[poolnum].pool_alloc_size  = nAlloc;
+    pools[poolnum].pool_page_bufs   = (POOL_PAGE_SIZE + nAlloc - 1)/nAlloc;
+    pools[poolnum].page_head = NULL;
+#else
+    pools[poolnum].pool_alloc_size  = poolsize + sizeof(POOLHDR) + sizeof(POOLFTR);
+    mux_assert(pools[poolnum].pool_client_size < pools[poolnum].pool_alloc_size);
+    pools[poolnum].chain_head = NULL;
+#endif // LEAN_POOLS
+    pools[poolnum].poolmagic = CRC32_ProcessInteger2(poolnum, poolsize);
+    pools[poolnum].free_head = NULL;
+    pools[poolnum].tot_alloc = 0;
+    pools[poolnum].num_alloc = 0;
+    pools[poolnum].max_alloc = 0;
+    pools[poolnum].num_lost = 0;
+}
+
+/*! \brief Helper function for logging pool errors.
+ *
+ * Rather than have similar code spread throughout the pool manager, this
+ * helper function glosses over access to the logging functions.
+ *
+ * \param logsys   Primary logging tag.
+ * \param logflag  Event class.
+ * \param poolnum  Which pool.
+ * \param tag      Client tag of problem buffer.
+ * \param ph       Buffer or pool header address.
+ * \param action   Action that discovered the problem.
+ * \param reason   prose to explain.
+ * \param file     File name of caller.
+ * \param line     Line number of caller.
+ * \return         None.
+ */
+
+static void pool_err
+(
+    __in const UTF8 *logsys,
+    int              logflag,
+    int              poolnum,
+    __in const UTF8 *tag,
+    __in const void *ph,
+    __in const UTF8 *action,
+    __in const UTF8 *reason,
+    __in const UTF8 *file,
+    const int        line
+)
+{
+    if (0 == mudstate.logging)
+    {
+        STARTLOG(logflag, logsys, "ALLOC");
+        Log.tinyprintf(T("%s[%d] (tag %s) %s in %s line %d at %p. (%s)"), action,
+            pools[poolnum].pool_client_size, tag, reason, file, line, ph,
+            mudstate.debug_cmd);
+        ENDLOG;
+    }
+    else if (LOG_ALLOCATE != logflag)
+    {
+        Log.tinyprintf(T(ENDLINE "***< %s[%d] (tag %s) %s in %s line %d at %p. >***"),
+            action, pools[poolnum].pool_client_size, tag, reason, file, line, ph);
+    }
+}
+
+#if defined(LEAN_POOLS)
+
+/*! \brief Determines whether a pointer is to a buffer in a lean pool.
+ *
+ * \param poolnum  Which pool.
+ * \param p        Pointer to check.
+ * \return         true if p is the start of one of the pool's buffers.
+ */
+
+static bool pool_owns(int poolnum, __in const void *p)
+{
+    const UTF8 *q = static_cast<const UTF8 *>(p);
+    for (POOLPAGE *pg = pools[poolnum].page_head; NULL != pg; pg = pg->next)
+    {
+        const UTF8 *pBase = reinterpret_cast<const UTF8 *>(pg + 1);
+        if (  pBase <= q
+           && q < pg->pEnd)
+        {
+            return 0 == static_cast<size_t>(q - pBase) % pools[poolnum].pool_alloc_size;
+        }
+    }
+    return false;
+}
+
+/*! \brief Determines whether a buffer is on the freelist of a lean pool.
+ *
+ * The walk is bounded by the number of free buffers so that a damaged
+ * freelist cannot send it around forever.
+ *
+ * \param poolnum  Which pool.
+ * \param pb       Buffer to look for.
+ * \return         true if pb is free.
+ */
+
+static bool pool_on_freelist(int poolnum, __in const POOLFREE *pb)
+{
+    UINT64 n = pools[poolnum].max_alloc - pools[poolnum].num_alloc;
+    for (const POOLFREE *q = pools[poolnum].free_head; NULL != q && 0 < n; q = q->nxtfree, n--)
+    {
+        if (q == pb)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static int DCL_CDECL pool_page_compare(const void *a, const void *b)
+{
+    const POOLPAGE *pa = *static_cast<POOLPAGE * const *>(a);
+    const POOLPAGE *pb = *static_cast<POOLPAGE * const *>(b);
+    if (pa < pb)
+    {
+        return -1;
+    }
+    return (pb < pa) ? 1 : 0;
+}
+
+/*! \brief Finds the free buffers of a lean pool.
+ *
+ * Once a buffer is handed out, the bytes where a free buffer keeps its magic
+ * number belong to the client, so they cannot say whether the buffer is
+ * free.  Instead, the freelist is walked, and each buffer on it is marked in
+ * a map with one entry per buffer, page by page.  The pages are sorted by
+ * address so that the page holding each buffer can be found by binary
+ * search.  The walk stops at a link which does not lead to a buffer of the
+ * pool or which leads back to a buffer already marked.
+ *
+ * \param poolnum  Which pool.
+ * \param papg     Receives the pages in address order, to be deleted.
+ * \param pnPages  Receives the number of pages.
+ * \param pabFree  Receives the map of free buffers, to be deleted.
+ * \param pnFree   Receives the number of free buffers marked.
+ * \return         false if out of memory.
+ */
+
+static bool pool_map_free
+(
+    int poolnum,
+    __out POOLPAGE ***papg,
+    __out size_t *pnPages,
+    __out bool **pabFree,
+    __out size_t *pnFree
+)
+{
+    size_t nAlloc = pools[poolnum].pool_alloc_size;
+    size_t nBufs  = pools[poolnum].pool_page_bufs;
+
+    size_t nPages = 0;
+    POOLPAGE *pg;
+    for (pg = pools[poolnum].page_head; NULL != pg; pg = pg->next)
+    {
+        nPages++;
+    }
+
+    POOLPAGE **apg = NULL;
+    bool *abFree = NULL;
+    try
+    {
+        apg = new POOLPAGE *[nPages];
+        abFree = new bool[nPages*nBufs];
+    }
+    catch (...)
+    {
+        ; // Nothing.
+    }
+
+    if (  NULL == apg
+       || NULL == abFree)
+    {
+        delete [] apg;
+        return false;
+    }
+
+    size_t i = 0;
+    for (pg = pools[poolnum].page_head; NULL != pg; pg = pg->next)
+    {
+        apg[i++] = pg;
+    }
+    qsort(apg, nPages, sizeof(POOLPAGE *), pool_page_compare);
+    memset(abFree, 0, nPages*nBufs*sizeof(bool));
+
+    size_t nFree = 0;
+    for (POOLFREE *pb = pools[poolnum].free_head; NULL != pb; pb = pb->nxtfree)
+    {
+        const UTF8 *q = reinterpret_cast<const UTF8 *>(pb);
+        size_t lo = 0;
+        size_t hi = nPages;
+        while (lo < hi)
+        {
+            size_t mid = lo + (hi - lo)/2;
+            if (q < apg[mid]->pEnd)
+            {
+                hi = mid;
+            }
+            else
+            {
+                lo = mid + 1;
+            }
+        }
+
+        if (nPages == lo)
+        {
+            break;
+        }
+
+        const UTF8 *pBase = reinterpret_cast<const UTF8 *>(apg[lo] + 1);
+        if (q < pBase)
+        {
+            break;
+        }
+
+        size_t nOffset = static_cast<size_t>(q - pBase);
+        if (0 != nOffset % nAlloc)
+        {
+            break;
+        }
+
+        bool *pbFree = abFree + lo*nBufs + nOffset/nAlloc;
+        if (*pbFree)
+        {
+            break;
+        }
+        *pbFree = true;
+        nFree++;
+    }
+
+    *papg = apg;
+    *pnPages = nPages;
+    *pabFree = abFree;
+    *pnFree = nFree;
+    return true;
+}
+
+/*! \brief Validates the freelist of a lean pool.
+ *
+ * Lean pools keep no list of buffers in use, so only the free buffers can be
+ * checked.  Each must belong to the pool and still carry its magic number.
+ * The freelist is cut off at the first buffer which does not, and the rest
+ * of it is leaked rather than risk a crash.
+ *
+ * \param poolnum  Which pool.
+ * \param tag      Client tag of problem buffer.
+ * \param file     File name of caller.
+ * \param line     Line number of caller.
+ * \return         None.
+ */
+
+static void pool_vfy
+(
+    int poolnum,
+    __in const UTF8 *tag,
+    __in const UTF8 *file,
+    const int line
+)
+{
+    POOLFREE **ppb = &pools[poolnum].free_head;
+    while (NULL != *ppb)
+    {
+        POOLFREE *pb = *ppb;
+        if (  !pool_owns(poolnum, pb)
+           || pb->magicnum != pools[poolnum].poolmagic)
+        {
+            pool_err(T("BUG"), LOG_ALWAYS, poolnum, tag, pb, T("Verify"),
+                T("freelist corrupted (clearing freelist)"), file, line);
+            *ppb = NULL;
+            return;
+        }
+        ppb = &pb->nxtfree;
+    }
+}
+
+#else
+
+/*! \brief Validates the buffers in the in-use list.
+ *
+ * This walks the in-use list, validates that all the buffers in the list go
+ * with the pool in which they appear and that all the magic is correct.  If
+ * a buffer is found to be compromised, part of the list is intentionally
+ * leaked rather than risk a crash.
+ *
+ * \param poolnum  Which pool.
+ * \param tag      Client tag of problem buffer.
+ * \param file     File name of caller.
+ * \param line     Line number of caller.
+ * \return         None.
+ */
+
+static void pool_vfy
+(
+    int poolnum,
+    __in const UTF8 *tag,
+    __in const UTF8 *file,
+    const int line
+)
+{
+    POOLHDR *lastph = NULL;
+    size_t psize = pools[poolnum].pool_client_size;
+    for (POOLHDR *ph = pools[poolnum].chain_head; NULL != ph; lastph = ph, ph = ph->next)
+    {
+        UTF8 *h = (UTF8 *)ph;
+        h += sizeof(POOLHDR);
+        h += pools[poolnum].pool_client_size;
+        POOLFTR *pf = (POOLFTR *) h;
+
+        if (ph->magicnum != pools[poolnum].poolmagic)
+        {
+            pool_err(T("BUG"), LOG_ALWAYS, poolnum, tag, ph, T("Verify"),
+                     T("header corrupted (clearing freelist)"), file, line);
+
+            // Break the header chain at this point so we don't
+            // generate an error for EVERY alloc and free, also we
+            // can't continue the scan because the next pointer might
+            // be trash too.
+            //
+            if (NULL != lastph)
+            {
+                lastph->next = NULL;
+            }
+            else
+            {
+                pools[poolnum].chain_head = NULL;
+            }
+
+            // It's not safe to continue.
+            //
+            return;
+        }
+
+        if (pf->magicnum != pools[poolnum].poolmagic)
+        {
+            pool_err(T("BUG"), LOG_ALWAYS, poolnum, tag, ph, T("Verify"),
+                T("footer corrupted"), file, line);
+            pf->magicnum = pools[poolnum].poolmagic;
+        }
+
+        if (ph->pool_size != psize)
+        {
+            pool_err(T("BUG"), LOG_ALWAYS, poolnum, tag, ph,
+                 T("Verify"), T("header has incorrect size"), file, line);
+        }
+    }
+}
+
+#endif // LEAN_POOLS
+
+static void pool_check(const UTF8 *tag, const UTF8 *file, const int line)
+{
+    int i;
+    for (i = 0; i < NUM_POOLS; i++)
+    {
+        pool_vfy(i, tag, file, line);
+    }
+}
+
+#if defined(LEAN_POOLS)
+
+/*! \brief Finds the arena slab whose data area holds an address.
+ *
+ * \param p        Address to look up.
+ * \return         Position of the slab in arena.apIndex, or -1 if none.
+ */
+
+static int arena_index_find(__in const void *p)
+{
+    const UTF8 *q = static_cast<const UTF8 *>(p);
+    int lo = 0;
+    int hi = arena.nIndex - 1;
+    while (lo <= hi)
+    {
+        int mid = lo + (hi - lo)/2;
+        ARENA_SLAB *ps = arena.apIndex[mid];
+        if (q < reinterpret_cast<const UTF8 *>(ps + 1))
+        {
+            hi = mid - 1;
+        }
+        else if (ps->pEnd <= q)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            return mid;
+        }
+    }
+    return -1;
+}
+
+#endif // LEAN_POOLS
+
+/*! \brief Allocates a slab for the evaluation arena.
+ *
+ * With LEAN_POOLS, the slab is also entered in arena.apIndex so that
+ * pool_free() can recognize its buffers by address.
+ *
+ * \return         New slab, or NULL if out of memory.
+ */
+
+static ARENA_SLAB *arena_slab_new(void)
+{
+#if defined(LEAN_POOLS)
+    if (arena.nIndex == arena.nIndexMax)
+    {
+        int nMax = (0 == arena.nIndexMax) ? 16 : 2*arena.nIndexMax;
+        ARENA_SLAB **ap = NULL;
+        try
+        {
+            ap = new ARENA_SLAB *[nMax];
+        }
+        catch (...)
+        {
+            ; // Nothing.
+        }
+
+        if (NULL == ap)
+        {
+            return NULL;
+        }
+
+        for (int i = 0; i < arena.nIndex; i++)
+        {
+            ap[i] = arena.apIndex[i];
+        }
+        delete [] arena.apIndex;
+        arena.apIndex = ap;
+        arena.nIndexMax = nMax;
+    }
+#endif // LEAN_POOLS
+
+    ARENA_SLAB *ps = NULL;
+    try
+    {
+        ps = reinterpret_cast<ARENA_SLAB *>(new char[sizeof(ARENA_SLAB) + ARENA_SLAB_DATA]);
+    }
+    catch (...)
+    {
+        ; // Nothing.
+    }
+
+    if (NULL == ps)
+    {
+        return NULL;
+    }
+    ps->pEnd = reinterpret_cast<UTF8 *>(ps + 1) + ARENA_SLAB_DATA;
+
+#if defined(LEAN_POOLS)
+    int i = arena.nIndex++;
+    while (  0 < i
+          && ps < arena.apIndex[i-1])
+    {
+        arena.apIndex[i] = arena.apIndex[i-1];
+        i--;
+    }
+    arena.apIndex[i] = ps;
+#endif // LEAN_POOLS
+    return ps;
+}
+
+/*! \brief Releases a slab of the evaluation arena.
+ *
+ * \param ps       Slab which is on none of the arena's lists.
+ * \return         None.
+ */
+
+static void arena_slab_delete(ARENA_SLAB *ps)
+{
+#if defined(LEAN_POOLS)
+    int i = arena_index_find(ps + 1);
+    mux_assert(0 <= i);
+    arena.nIndex--;
+    for ( ; i < arena.nIndex; i++)
+    {
+        arena.apIndex[i] = arena.apIndex[i+1];
+    }
+#endif // LEAN_POOLS
+    char *p = reinterpret_cast<char *>(ps);
+    delete [] p;
+}
+
+/*! \brief Takes a buffer for the current command from the arena.
+ *
+ * \param poolnum  Which pool the buffer stands in for.
+ * \param tag      Client tag.
+ * \param file     File name of caller.
+ * \param line     Line number of caller.
+ * \return         Client area, or NULL if no slab could be had.
+ */
+
+static UTF8 *arena_alloc
+(
+    int poolnum,
+    __in const UTF8 *tag,
+    __in const UTF8 *file,
+    const int line
+)
+{
+    size_t nClient = pools[poolnum].pool_client_size;
+    size_t n = ARENA_BUF(nClient);
+
+    ARENA_SLAB *ps = arena.pSlabs;
+    if (  NULL == ps
+       || static_cast<size_t>(ps->pEnd - ps->pFree) < n)
+    {
+        if (NULL != arena.pSpare)
+        {
+            ps = arena.pSpare;
+            arena.pSpare = ps->next;
+            arena.nSpare--;
+        }
+        else
+        {
+            ps = arena_slab_new();
+            if (NULL == ps)
+            {
+                return NULL;
+            }
+        }
+        ps->pFree = reinterpret_cast<UTF8 *>(ps + 1);
+        ps->nLive = 0;
+        ps->bPinned = false;
+        ps->next = arena.pSlabs;
+        arena.pSlabs = ps;
+        arena.nSlabs++;
+        if (arena.nSlabsMax < arena.nSlabs)
+        {
+            arena.nSlabsMax = arena.nSlabs;
+        }
+    }
+
+    POOLHDR *ph = reinterpret_cast<POOLHDR *>(ps->pFree);
+    ps->pFree += n;
+    ps->nLive++;
+
+    UTF8 *p = (UTF8 *)(ph + 1);
+    POOLFTR *pf = (POOLFTR *)(p + nClient);
+    ph->magicnum = ~pools[poolnum].poolmagic;
+    ph->bFree = false;
+    ph->pool_size = nClient;
+    ph->next = NULL;
+    ph->nxtfree = NULL;
+    ph->slab = ps;
+    ph->u.buf_tag = tag;
+    pf->magicnum = ~pools[poolnum].poolmagic;
+    *((unsigned int *)p) = 0;
+
+    arena.tot_alloc++;
+    arena.nBytes += n;
+    if (arena.nBytesMax < arena.nBytes)
+    {
+        arena.nBytesMax = arena.nBytes;
+    }
+
+    if (  (LOG_ALLOCATE & mudconf.log_options)
+       && mudstate.logging == 0
+       && start_log(T("DBG"), T("ALLOC")))
+    {
+        Log.tinyprintf(T("Alloc[%d] (tag %s) in %s line %d arena buffer at %p. (%s)"),
+            nClient, tag, file, line, ph, mudstate.debug_cmd);
+        end_log();
+    }
+    return p;
+}
+
+/*! \brief Returns a buffer to the arena slab it came from.
+ *
+ * The last buffer carved from a slab is given back immediately, and a slab
+ * with no live buffers is rewound, so nested evaluation reuses the same
+ * memory.
+ *
+ * \param poolnum  Which pool the buffer stands in for.
+ * \param buf      Client area.
+ * \param file     File name of caller.
+ * \param line     Line number of caller.
+ * \return         None.
+ */
+
+static void arena_free(int poolnum, __in UTF8 *buf, __in const UTF8 *file, const int line)
+{
+    POOLHDR *ph = ((POOLHDR *)buf) - 1;
+    size_t nClient = pools[poolnum].pool_client_size;
+    POOLFTR *pf = (POOLFTR *)(buf + nClient);
+
+    if (pf->magicnum != ~pools[poolnum].poolmagic)
+    {
+        pool_err(T("BUG"), LOG_ALWAYS, poolnum, ph->u.buf_tag, ph, T("Free"),
+            T("corrupted arena buffer footer"), file, line);
+        pf->magicnum = ~pools[poolnum].poolmagic;
+    }
+
+    if (ph->bFree)
+    {
+        pool_err(T("BUG"), LOG_BUGS, poolnum, ph->u.buf_tag, ph, T("Free"),
+            T("arena buffer already freed"), file, line);
+        return;
+    }
+
+    if (  (LOG_ALLOCATE & mudconf.log_options)
+       && mudstate.logging == 0
+       && start_log(T("DBG"), T("ALLOC")))
+    {
+        Log.tinyprintf(T("Free[%d] (tag %s) in %s line %d arena buffer at %p. (%s)"),
+            nClient, ph->u.buf_tag, file, line, ph, mudstate.debug_cmd);
+        end_log();
+    }
+    ph->bFree = true;
+
+    ARENA_SLAB *ps = ph->slab;
+    size_t n = ARENA_BUF(nClient);
+    ps->nLive--;
+    if (ps->bPinned)
+    {
+        if (0 == ps->nLive)
+        {
+            ARENA_SLAB **pps = &arena.pPinned;
+            while (*pps != ps)
+            {
+                pps = &(*pps)->next;
+            }
+            *pps = ps->next;
+            arena_slab_delete(ps);
+            arena.nPinned--;
+        }
+        return;
+    }
+
+    arena.nBytes -= n;
+    if (0 == ps->nLive)
+    {
+        ps->pFree = reinterpret_cast<UTF8 *>(ps + 1);
+        if (arena.pSlabs != ps)
+        {
+            // Only the newest slab is carved from, so an older slab which
+            // has emptied goes back to the spare list.
+            //
+            ARENA_SLAB **pps = &arena.pSlabs;
+            while (*pps != ps)
+            {
+                pps = &(*pps)->next;
+            }
+            *pps = ps->next;
+            ps->next = arena.pSpare;
+            arena.pSpare = ps;
+            arena.nSpare++;
+            arena.nSlabs--;
+        }
+    }
+    else if (reinterpret_cast<UTF8 *>(ph) + n == ps->pFree)
+    {
+        ps->pFree = reinterpret_cast<UTF8 *>(ph);
+    }
+}
+
+/*! \brief Begins a command.
+ *
+ * While at least one command is open and eval_arena is enabled, sbufs,
+ * mbufs, and lbufs come from the evaluation arena instead of the pools.
+ * Calls nest, and only the outermost pool_arena_close() releases anything.
+ * The arena stays off while paranoid_allocate is on so that every buffer
+ * remains on a pool chain where it can be checked.
+ *
+ * \return         None.
+ */
+
+void pool_arena_open(void)
+{
+    if (0 == arena.nDepth++)
+    {
+        arena.bActive = (  mudconf.eval_arena
+                        && !mudconf.paranoid_alloc);
+        if (arena.bActive)
+        {
+            arena.nCommands++;
+        }
+    }
+}
+
+/*! \brief Ends a command and releases the arena.
+ *
+ * Empty slabs are kept for the next command.  A slab which still holds
+ * buffers is pinned, so buffers which outlive their command remain valid.
+ *
+ * \return         None.
+ */
+
+void pool_arena_close(void)
+{
+    mux_assert(0 < arena.nDepth);
+    if (0 != --arena.nDepth)
+    {
+        return;
+    }
+
+    ARENA_SLAB *ps = arena.pSlabs;
+    while (NULL != ps)
+    {
+        ARENA_SLAB *psNext = ps->next;
+        if (0 != ps->nLive)
+        {
+            ps->next = arena.pPinned;
+            arena.pPinned = ps;
+            ps->bPinned = true;
+            arena.nPinned++;
+            arena.tot_escaped += ps->nLive;
+        }
+        else if (arena.nSpare < ARENA_SPARE_MAX)
+        {
+            ps->next = arena.pSpare;
+            arena.pSpare = ps;
+            arena.nSpare++;
+        }
+        else
+        {
+            arena_slab_delete(ps);
+        }
+        ps = psNext;
+    }
+    while (ARENA_SPARE_MAX < arena.nSpare)
+    {
+        ps = arena.pSpare;
+        arena.pSpare = ps->next;
+        arena.nSpare--;
+        arena_slab_delete(ps);
+    }
+    arena.pSlabs = NULL;
+    arena.nSlabs = 0;
+    arena.nBytes = 0;
+    arena.bActive = false;
+}
+
+/*! \brief Allocates a buffer which is expected to outlive the command.
+ *
+ * This is the escape hatch from the evaluation arena.  The buffer always
+ * comes from the pool and is freed in the usual way.
+ *
+ * \param poolnum  Which pool.
+ * \param tag      Client tag.
+ * \param file     File name of caller.
+ * \param line     Line number of caller.
+ * \return         Client area.
+ */
+
+UTF8 *pool_alloc_keep(int poolnum, __in const UTF8 *tag, __in const UTF8 *file, const int line)
+{
+    bool bActive = arena.bActive;
+    arena.bActive = false;
+    UTF8 *p;
+    if (POOL_LBUF == poolnum)
+    {
+        p = pool_alloc_lbuf(tag, file, line);
+    }
+    else
+    {
+        p = pool_alloc(poolnum, tag, file, line);
+    }
+    arena.bActive = bActive;
+    return p;
+}
+
+#if defined(LEAN_POOLS)
 
-/*! \brief Initialize a buffer pool.
+/*! \brief Determines whether a buffer came from the evaluation arena.
  *
- * This is done once. The client size, magic, and allocation size are chosen
- * at this time, and the free list and in-use list are initialized to empty.
- * After this initialization, allocations can be done.
+ * Lean pool buffers have no header, so arena buffers are recognized by
+ * address instead of by magic number, with a binary search of every slab.
  *
- * \param poolnum  An integer uniquely indicating which pool.
- * \param poolsize The size of the client area this pool supports.
- * \return         None.
+ * \param buf      Client area.
+ * \return         true if buf lies in an arena slab.
  */
 
-void pool_init(int poolnum, int poolsize)
+static bool arena_owns(__in const UTF8 *buf)
 {
-    pools[poolnum].pool_client_size = poolsize;
-    pools[poolnum].pool_alloc_size  = poolsize + sizeof(POOLHDR) + sizeof(POOLFTR);
-    mux_assert(pools[poolnum].pool_client_size < pools[poolnum].pool_alloc_size);
-    pools[poolnum].poolmagic = CRC32_ProcessInteger2(poolnum, poolsize);
-    pools[poolnum].free_head = NULL;
-    pools[poolnum].chain_head = NULL;
-    pools[poolnum].tot_alloc = 0;
-    pools[poolnum].num_alloc = 0;
-    pools[poolnum].max_alloc = 0;
-    pools[poolnum].num_lost = 0;
+    return 0 <= arena_index_find(buf);
 }
 
-/*! \brief Helper function for logging pool errors.
- *
- * Rather than have similar code spread throughout the pool manager, this
- * helper function glosses over access to the logging functions.
+/*! \brief Adds a page of buffers to a lean pool.
  *
- * \param logsys   Primary logging tag.
- * \param logflag  Event class.
  * \param poolnum  Which pool.
- * \param tag      Client tag of problem buffer.
- * \param ph       Pool header address.
- * \param action   Action that discovered the problem.
- * \param reason   prose to explain.
- * \param file     File name of caller.
- * \param line     Line number of caller.
- * \return         None.
+ * \return         New head of the freelist, or NULL if out of memory.
  */
 
-static void pool_err
-(
-    __in const UTF8 *logsys,
-    int              logflag,
-    int              poolnum,
-    __in const UTF8 *tag,
-    __in POOLHDR    *ph,
-    __in const UTF8 *action,
-    __in const UTF8 *reason,
-    __in const UTF8 *file,
-    const int        line
-)
+static POOLFREE *pool_grow(int poolnum)
 {
-    if (0 == mudstate.logging)
+    size_t nAlloc = pools[poolnum].pool_alloc_size;
+    size_t nBufs  = pools[poolnum].pool_page_bufs;
+
+    POOLPAGE *pg = NULL;
+    try
     {
-        STARTLOG(logflag, logsys, "ALLOC");
-        Log.tinyprintf(T("%s[%d] (tag %s) %s in %s line %d at %p. (%s)"), action,
-            pools[poolnum].pool_client_size, tag, reason, file, line, ph,
-            mudstate.debug_cmd);
-        ENDLOG;
+        pg = reinterpret_cast<POOLPAGE *>(new char[sizeof(POOLPAGE) + nBufs*nAlloc]);
     }
-    else if (LOG_ALLOCATE != logflag)
+    catch (...)
     {
-        Log.tinyprintf(T(ENDLINE "***< %s[%d] (tag %s) %s in %s line %d at %p. >***"),
-            action, pools[poolnum].pool_client_size, tag, reason, file, line, ph);
+        ; // Nothing.
+    }
+
+    if (NULL == pg)
+    {
+        return NULL;
+    }
+
+    UTF8 *pBase = reinterpret_cast<UTF8 *>(pg + 1);
+    pg->pEnd = pBase + nBufs*nAlloc;
+    pg->next = pools[poolnum].page_head;
+    pools[poolnum].page_head = pg;
+
+    // Thread the new buffers onto the freelist in address order.
+    //
+    POOLFREE *pHead = pools[poolnum].free_head;
+    for (size_t i = nBufs; 0 < i; i--)
+    {
+        POOLFREE *pb = reinterpret_cast<POOLFREE *>(pBase + (i-1)*nAlloc);
+        pb->nxtfree = pHead;
+        pb->magicnum = pools[poolnum].poolmagic;
+        pHead = pb;
     }
+    pools[poolnum].free_head = pHead;
+    pools[poolnum].max_alloc += nBufs;
+    return pHead;
 }
 
-/*! \brief Validates the buffers in the in-use list.
+/*! \brief Decides whether this allocation or free is checked.
  *
- * This walks the in-use list, validates that all the buffers in the list go
- * with the pool in which they appear and that all the magic is correct.  If
- * a buffer is found to be compromised, part of the list is intentionally
- * leaked rather than risk a crash.
+ * \return         true once every POOL_SAMPLE_INTERVAL calls, or always
+ *                 while paranoid_allocate is on.
+ */
+
+static inline bool pool_sample(void)
+{
+    if (  0 == --nPoolSample
+       || mudconf.paranoid_alloc)
+    {
+        nPoolSample = POOL_SAMPLE_INTERVAL;
+        return true;
+    }
+    return false;
+}
+
+/*! \brief Takes a buffer from a lean pool.
+ *
+ * Outside of a sampled call, this is a pop from the freelist.  A sampled
+ * call makes sure the freelist head and its successor belong to the pool,
+ * and that the buffer was not written to while it was free.
  *
  * \param poolnum  Which pool.
- * \param tag      Client tag of problem buffer.
+ * \param tag      Client tag.
  * \param file     File name of caller.
  * \param line     Line number of caller.
- * \return         None.
+ * \return         Client area.
  */
 
-static void pool_vfy
+static UTF8 *pool_alloc_lean
 (
     int poolnum,
     __in const UTF8 *tag,
@@ -175,65 +1064,143 @@ static void pool_vfy
     const int line
 )
 {
-    POOLHDR *lastph = NULL;
-    size_t psize = pools[poolnum].pool_client_size;
-    for (POOLHDR *ph = pools[poolnum].chain_head; NULL != ph; lastph = ph, ph = ph->next)
+    POOLFREE *pb = pools[poolnum].free_head;
+    if (pool_sample())
     {
-        UTF8 *h = (UTF8 *)ph;
-        h += sizeof(POOLHDR);
-        h += pools[poolnum].pool_client_size;
-        POOLFTR *pf = (POOLFTR *) h;
-
-        if (ph->magicnum != pools[poolnum].poolmagic)
+        if (mudconf.paranoid_alloc)
         {
-            pool_err(T("BUG"), LOG_ALWAYS, poolnum, tag, ph, T("Verify"),
-                     T("header corrupted (clearing freelist)"), file, line);
-
-            // Break the header chain at this point so we don't
-            // generate an error for EVERY alloc and free, also we
-            // can't continue the scan because the next pointer might
-            // be trash too.
-            //
-            if (NULL != lastph)
-            {
-                lastph->next = NULL;
-            }
-            else
-            {
-                pools[poolnum].chain_head = NULL;
-            }
+            pool_check(tag, file, line);
+            pb = pools[poolnum].free_head;
+        }
 
-            // It's not safe to continue.
+        if (  NULL != pb
+           && (  !pool_owns(poolnum, pb)
+              || (  NULL != pb->nxtfree
+                 && !pool_owns(poolnum, pb->nxtfree))))
+        {
+            // The freelist is damaged.  Throw it away and start a new one.
             //
-            return;
+            pool_err(T("BUG"), LOG_ALWAYS, poolnum, tag, pb, T("Alloc"),
+                T("corrupted freelist (clearing freelist)"), file, line);
+            pools[poolnum].num_lost += pools[poolnum].max_alloc
+                                    -  pools[poolnum].num_alloc;
+            pools[poolnum].max_alloc = pools[poolnum].num_alloc;
+            pools[poolnum].free_head = NULL;
+            pb = NULL;
         }
-
-        if (pf->magicnum != pools[poolnum].poolmagic)
+        else if (  NULL != pb
+                && pb->magicnum != pools[poolnum].poolmagic)
         {
-            pool_err(T("BUG"), LOG_ALWAYS, poolnum, tag, ph, T("Verify"),
-                T("footer corrupted"), file, line);
-            pf->magicnum = pools[poolnum].poolmagic;
+            pool_err(T("BUG"), LOG_PROBLEMS, poolnum, tag, pb, T("Alloc"),
+                T("buffer modified after free"), file, line);
         }
+    }
 
-        if (ph->pool_size != psize)
+    if (NULL == pb)
+    {
+        pb = pool_grow(poolnum);
+        if (NULL == pb)
         {
-            pool_err(T("BUG"), LOG_ALWAYS, poolnum, tag, ph,
-                 T("Verify"), T("header has incorrect size"), file, line);
+            ISOUTOFMEMORY(pb);
+            return NULL;
         }
     }
+
+    pools[poolnum].free_head = pb->nxtfree;
+    pools[poolnum].tot_alloc++;
+    pools[poolnum].num_alloc++;
+
+    if (  (LOG_ALLOCATE & mudconf.log_options)
+       && mudstate.logging == 0
+       && start_log(T("DBG"), T("ALLOC")))
+    {
+        Log.tinyprintf(T("Alloc[%d] (tag %s) in %s line %d buffer at %p. (%s)"),
+            pools[poolnum].pool_client_size, tag, file, line, pb,
+            mudstate.debug_cmd);
+        end_log();
+    }
+
+    pb->magicnum = 0;
+    UTF8 *p = reinterpret_cast<UTF8 *>(pb);
+    *((unsigned int *)p) = 0;
+    return p;
 }
 
-static void pool_check(const UTF8 *tag, const UTF8 *file, const int line)
+/*! \brief Returns a buffer to a lean pool.
+ *
+ * Freeing a buffer which is already free is always caught.  Whether the
+ * buffer belongs to the pool at all is checked only on sampled calls.
+ *
+ * \param poolnum  Which pool.
+ * \param buf      Client area.
+ * \param file     File name of caller.
+ * \param line     Line number of caller.
+ * \return         None.
+ */
+
+static void pool_free_lean(int poolnum, __in UTF8 *buf, __in const UTF8 *file, const int line)
 {
-    int i;
-    for (i = 0; i < NUM_POOLS; i++)
+    POOLFREE *pb = reinterpret_cast<POOLFREE *>(buf);
+    if (pool_sample())
     {
-        pool_vfy(i, tag, file, line);
+        if (mudconf.paranoid_alloc)
+        {
+            pool_check(T("unknown"), file, line);
+        }
+
+        if (!pool_owns(poolnum, buf))
+        {
+            pool_err(T("BUG"), LOG_ALWAYS, poolnum, T("unknown"), buf, T("Free"),
+                T("Attempt to free into a different pool."), file, line);
+            return;
+        }
+    }
+
+    // The magic number may also be client data, so a match is confirmed
+    // against the freelist.
+    //
+    if (  pb->magicnum == pools[poolnum].poolmagic
+       && pool_on_freelist(poolnum, pb))
+    {
+        pool_err(T("BUG"), LOG_BUGS, poolnum, T("unknown"), buf, T("Free"),
+            T("buffer already freed"), file, line);
+        return;
+    }
+
+    if (  (LOG_ALLOCATE & mudconf.log_options)
+       && mudstate.logging == 0
+       && start_log(T("DBG"), T("ALLOC")))
+    {
+        Log.tinyprintf(T("Free[%d] in %s line %d buffer at %p. (%s)"),
+            pools[poolnum].pool_client_size, file, line, buf,
+            mudstate.debug_cmd);
+        end_log();
     }
+
+    pb->magicnum = pools[poolnum].poolmagic;
+    pb->nxtfree = pools[poolnum].free_head;
+    pools[poolnum].free_head = pb;
+    pools[poolnum].num_alloc--;
 }
 
+#endif // LEAN_POOLS
+
 UTF8 *pool_alloc(int poolnum, __in const UTF8 *tag, __in const UTF8 *file, const int line)
 {
+    if (  arena.bActive
+       && (  POOL_SBUF == poolnum
+          || POOL_MBUF == poolnum))
+    {
+        UTF8 *p = arena_alloc(poolnum, tag, file, line);
+        if (NULL != p)
+        {
+            return p;
+        }
+    }
+
+#if defined(LEAN_POOLS)
+    return pool_alloc_lean(poolnum, tag, file, line);
+#else
     if (mudconf.paranoid_alloc)
     {
         pool_check(tag, file, line);
@@ -299,6 +1266,7 @@ UTF8 *pool_alloc(int poolnum, __in const UTF8 *tag, __in const UTF8 *file, const
         ph->next = pools[poolnum].chain_head;
         ph->nxtfree = NULL;
         ph->magicnum = pools[poolnum].poolmagic;
+        ph->bFree = true;
         ph->pool_size = pools[poolnum].pool_client_size;
         pf->magicnum = pools[poolnum].poolmagic;
         *((unsigned int *)p) = pools[poolnum].poolmagic;
@@ -307,6 +1275,7 @@ UTF8 *pool_alloc(int poolnum, __in const UTF8 *tag, __in const UTF8 *file, const
     }
 
     ph->u.buf_tag = tag;
+    ph->bFree = false;
     pools[poolnum].tot_alloc++;
     pools[poolnum].num_alloc++;
 
@@ -330,10 +1299,23 @@ UTF8 *pool_alloc(int poolnum, __in const UTF8 *tag, __in const UTF8 *file, const
     }
     *pui = 0;
     return p;
+#endif // LEAN_POOLS
 }
 
 UTF8 *pool_alloc_lbuf(__in const UTF8 *tag, __in const UTF8 *file, const int line)
 {
+    if (arena.bActive)
+    {
+        UTF8 *p = arena_alloc(POOL_LBUF, tag, file, line);
+        if (NULL != p)
+        {
+            return p;
+        }
+    }
+
+#if defined(LEAN_POOLS)
+    return pool_alloc_lean(POOL_LBUF, tag, file, line);
+#else
     if (mudconf.paranoid_alloc)
     {
         pool_check(tag, file, line);
@@ -399,6 +1381,7 @@ UTF8 *pool_alloc_lbuf(__in const UTF8 *tag, __in const UTF8 *file, const int lin
         ph->next = pools[POOL_LBUF].chain_head;
         ph->nxtfree = NULL;
         ph->magicnum = pools[POOL_LBUF].poolmagic;
+        ph->bFree = true;
         ph->pool_size = LBUF_SIZE;
         pf->magicnum = pools[POOL_LBUF].poolmagic;
         *((unsigned int *)p) = pools[POOL_LBUF].poolmagic;
@@ -407,6 +1390,7 @@ UTF8 *pool_alloc_lbuf(__in const UTF8 *tag, __in const UTF8 *file, const int lin
     }
 
     ph->u.buf_tag = tag;
+    ph->bFree = false;
     pools[POOL_LBUF].tot_alloc++;
     pools[POOL_LBUF].num_alloc++;
 
@@ -429,6 +1413,7 @@ UTF8 *pool_alloc_lbuf(__in const UTF8 *tag, __in const UTF8 *file, const int lin
     }
     *pui = 0;
     return p;
+#endif // LEAN_POOLS
 }
 
 void pool_free(int poolnum, __in UTF8 *buf, __in const UTF8 *file, const int line)
@@ -440,7 +1425,23 @@ void pool_free(int poolnum, __in UTF8 *buf, __in const UTF8 *file, const int lin
         ENDLOG
         return;
     }
+#if defined(LEAN_POOLS)
+    if (  (  NULL != arena.pSlabs
+          || NULL != arena.pPinned)
+       && arena_owns(buf))
+    {
+        arena_free(poolnum, buf, file, line);
+        return;
+    }
+    pool_free_lean(poolnum, buf, file, line);
+#else
     POOLHDR *ph = ((POOLHDR *)buf) - 1;
+    if (ph->magicnum == ~pools[poolnum].poolmagic)
+    {
+        arena_free(poolnum, buf, file, line);
+        return;
+    }
+
     POOLFTR *pf = (POOLFTR *)(buf + pools[poolnum].pool_client_size);
     unsigned int *pui = (unsigned int *)buf;
 
@@ -493,7 +1494,7 @@ void pool_free(int poolnum, __in UTF8 *buf, __in const UTF8 *file, const int lin
     // Make sure we aren't freeing an already free buffer.  If we are, log an
     // error, otherwise update the pool header and stats.
     //
-    if (*pui == pools[poolnum].poolmagic)
+    if (ph->bFree)
     {
         pool_err(T("BUG"), LOG_BUGS, poolnum, ph->u.buf_tag, ph, T("Free"),
                  T("buffer already freed"), file, line);
@@ -501,10 +1502,12 @@ void pool_free(int poolnum, __in UTF8 *buf, __in const UTF8 *file, const int lin
     else
     {
         *pui = pools[poolnum].poolmagic;
+        ph->bFree = true;
         ph->nxtfree = pools[poolnum].free_head;
         pools[poolnum].free_head = ph;
         pools[poolnum].num_alloc--;
     }
+#endif // LEAN_POOLS
 }
 
 void pool_free_lbuf(__in_ecount(LBUF_SIZE) UTF8 *buf, __in const UTF8 *file, const int line)
@@ -516,7 +1519,23 @@ void pool_free_lbuf(__in_ecount(LBUF_SIZE) UTF8 *buf, __in const UTF8 *file, con
         ENDLOG
         return;
     }
+#if defined(LEAN_POOLS)
+    if (  (  NULL != arena.pSlabs
+          || NULL != arena.pPinned)
+       && arena_owns(buf))
+    {
+        arena_free(POOL_LBUF, buf, file, line);
+        return;
+    }
+    pool_free_lean(POOL_LBUF, buf, file, line);
+#else
     POOLHDR *ph = ((POOLHDR *)buf) - 1;
+    if (ph->magicnum == ~pools[POOL_LBUF].poolmagic)
+    {
+        arena_free(POOL_LBUF, buf, file, line);
+        return;
+    }
+
     POOLFTR *pf = (POOLFTR *)(buf + LBUF_SIZE);
     unsigned int *pui = (unsigned int *)buf;
 
@@ -528,7 +1547,7 @@ void pool_free_lbuf(__in_ecount(LBUF_SIZE) UTF8 *buf, __in const UTF8 *file, con
     if (  ph->magicnum != pools[POOL_LBUF].poolmagic
        || pf->magicnum != pools[POOL_LBUF].poolmagic
        || ph->pool_size != LBUF_SIZE
-       || *pui == pools[POOL_LBUF].poolmagic)
+       || ph->bFree)
     {
         if (ph->magicnum != pools[POOL_LBUF].poolmagic)
         {
@@ -561,7 +1580,7 @@ void pool_free_lbuf(__in_ecount(LBUF_SIZE) UTF8 *buf, __in const UTF8 *file, con
 
         // If we are freeing a buffer that was already free, report an error.
         //
-        if (*pui == pools[POOL_LBUF].poolmagic)
+        if (ph->bFree)
         {
             pool_err(T("BUG"), LOG_BUGS, POOL_LBUF, ph->u.buf_tag, ph, T("Free"),
                 T("buffer already freed"), file, line);
@@ -581,11 +1600,40 @@ void pool_free_lbuf(__in_ecount(LBUF_SIZE) UTF8 *buf, __in const UTF8 *file, con
     // Update the pool header and stats.
     //
     *pui = pools[POOL_LBUF].poolmagic;
+    ph->bFree = true;
     ph->nxtfree = pools[POOL_LBUF].free_head;
     pools[POOL_LBUF].free_head = ph;
     pools[POOL_LBUF].num_alloc--;
+#endif // LEAN_POOLS
+}
+
+#if defined(LEAN_POOLS)
+
+static void pool_trace(dbref player, int poolnum, __in const UTF8 *text)
+{
+    notify(player, tprintf(T("----- %s -----"), text));
+
+    POOLPAGE **apg;
+    size_t nPages;
+    bool *abFree;
+    size_t nFree;
+    if (!pool_map_free(poolnum, &apg, &nPages, &abFree, &nFree))
+    {
+        notify(player, T("*** OUT OF MEMORY, ABORTING SCAN ***"));
+        return;
+    }
+    size_t nUsed = nPages*pools[poolnum].pool_page_bufs - nFree;
+    delete [] apg;
+    delete [] abFree;
+
+    // Lean buffers do not carry the tags of the code that allocated them.
+    //
+    notify(player, tprintf(T("%d untagged %s in use"), static_cast<int>(nUsed), text));
+    notify(player, tprintf(T("%d free %s"), static_cast<int>(nFree), text));
 }
 
+#else
+
 static void pool_trace(dbref player, int poolnum, __in const UTF8 *text)
 {
     POOLHDR *ph;
@@ -600,10 +1648,7 @@ static void pool_trace(dbref player, int poolnum, __in const UTF8 *text)
                        numfree, text));
             return;
         }
-        char *h = (char *)ph;
-        h += sizeof(POOLHDR);
-        unsigned int *ibuf = (unsigned int *)h;
-        if (*ibuf != pools[poolnum].poolmagic)
+        if (!ph->bFree)
         {
             notify(player, ph->u.buf_tag);
         }
@@ -615,6 +1660,23 @@ static void pool_trace(dbref player, int poolnum, __in const UTF8 *text)
     notify(player, tprintf(T("%d free %s"), numfree, text));
 }
 
+#endif // LEAN_POOLS
+
+static void list_arenastats(dbref player)
+{
+    UTF8 buff[MBUF_SIZE];
+    UTF8 *p = buff;
+    notify(player, T("Eval Arena    Commands     Allocs   HighWater  Slabs  Escaped  Pinned"));
+    p += LeftJustifyString(p,  12, mudconf.eval_arena ? T("Enabled") : T("Disabled")); *p++ = ' ';
+    p += RightJustifyNumber(p,  9, arena.nCommands,   ' '); *p++ = ' ';
+    p += RightJustifyNumber(p, 10, arena.tot_alloc,   ' '); *p++ = ' ';
+    p += RightJustifyNumber(p, 11, arena.nBytesMax,   ' '); *p++ = ' ';
+    p += RightJustifyNumber(p,  6, arena.nSlabsMax,   ' '); *p++ = ' ';
+    p += RightJustifyNumber(p,  8, arena.tot_escaped, ' '); *p++ = ' ';
+    p += RightJustifyNumber(p,  7, arena.nPinned,     ' '); *p++ = '\0';
+    notify(player, buff);
+}
+
 void list_bufstats(dbref player)
 {
     notify(player, T("Buffer Stats  Size      InUse      Total           Allocs   Lost"));
@@ -631,6 +1693,8 @@ void list_bufstats(dbref player)
         p += RightJustifyNumber(p,  6, pools[i].num_lost,         ' '); *p++ = '\0';
         notify(player, buff);
     }
+
+    list_arenastats(player);
 }
 
 void list_buftrace(dbref player)
@@ -640,11 +1704,112 @@ void list_buftrace(dbref player)
     {
         pool_trace(player, i, poolnames[i]);
     }
+    list_arenastats(player);
+}
+
+/*! \brief Counts every buffer handed out so far by the pools and the arena.
+ *
+ * The benchmark mode samples this before and after a run to report
+ * allocations per operation.
+ *
+ * \return         Running total of allocations.
+ */
+UINT64 pool_total_allocs(void)
+{
+    UINT64 nTotal = arena.tot_alloc;
+    for (int i = 0; i < NUM_POOLS; i++)
+    {
+        nTotal += pools[i].tot_alloc;
+    }
+    return nTotal;
+}
+
+/*! \brief Reports the usage of one pool.
+ *
+ * \param poolnum    Which pool.
+ * \param pnSize     Size of each buffer as seen by its user.
+ * \param pnInUse    Buffers currently allocated.
+ * \param pnMax      Most buffers allocated at one time.
+ * \param pnTotal    Buffers handed out so far.
+ * \return           Name of the pool.
+ */
+const UTF8 *pool_stats(int poolnum, size_t *pnSize, UINT64 *pnInUse,
+    UINT64 *pnMax, UINT64 *pnTotal)
+{
+    *pnSize   = pools[poolnum].pool_client_size;
+    *pnInUse  = pools[poolnum].num_alloc;
+    *pnMax    = pools[poolnum].max_alloc;
+    *pnTotal  = pools[poolnum].tot_alloc;
+    return poolnames[poolnum];
 }
 
 void pool_reset(void)
 {
     int i;
+#if defined(LEAN_POOLS)
+    for (i = 0; i < NUM_POOLS; i++)
+    {
+        POOLPAGE **apg;
+        size_t nPages;
+        bool *abFree;
+        size_t nFree;
+        if (!pool_map_free(i, &apg, &nPages, &abFree, &nFree))
+        {
+            continue;
+        }
+
+        // Release pages with no buffers in use, and rebuild the page chain
+        // and the freelist, in address order, from the pages which remain.
+        // Buffers cut off from a damaged freelist are kept as if in use.
+        //
+        size_t nAlloc = pools[i].pool_alloc_size;
+        size_t nBufs  = pools[i].pool_page_bufs;
+        POOLPAGE *pgHead = NULL;
+        POOLFREE *pHead = NULL;
+        UINT64 nKept = 0;
+        for (size_t j = nPages; 0 < j; j--)
+        {
+            POOLPAGE *pg = apg[j-1];
+            const bool *pbFree = abFree + (j-1)*nBufs;
+            size_t k;
+            size_t nFreeInPage = 0;
+            for (k = 0; k < nBufs; k++)
+            {
+                if (pbFree[k])
+                {
+                    nFreeInPage++;
+                }
+            }
+
+            if (nFreeInPage == nBufs)
+            {
+                char *q = reinterpret_cast<char *>(pg);
+                delete [] q;
+                continue;
+            }
+
+            UTF8 *pBase = reinterpret_cast<UTF8 *>(pg + 1);
+            for (k = nBufs; 0 < k; k--)
+            {
+                if (pbFree[k-1])
+                {
+                    POOLFREE *pb = reinterpret_cast<POOLFREE *>(pBase + (k-1)*nAlloc);
+                    pb->nxtfree = pHead;
+                    pHead = pb;
+                }
+            }
+            pg->next = pgHead;
+            pgHead = pg;
+            nKept += nBufs;
+        }
+        delete [] apg;
+        delete [] abFree;
+
+        pools[i].page_head = pgHead;
+        pools[i].free_head = pHead;
+        pools[i].max_alloc = nKept;
+    }
+#else
     for (i = 0; i < NUM_POOLS; i++)
     {
         POOLHDR *newchain = NULL;
@@ -652,11 +1817,8 @@ void pool_reset(void)
         POOLHDR *ph;
         for (ph = pools[i].chain_head; ph != NULL; ph = phnext)
         {
-            char *h = (char *)ph;
             phnext = ph->next;
-            h += sizeof(POOLHDR);
-            unsigned int *ibuf = (unsigned int *)h;
-            if (*ibuf == pools[i].poolmagic)
+            if (ph->bFree)
             {
                 char *p = reinterpret_cast<char *>(ph);
                 delete [] p;
@@ -673,4 +1835,15 @@ void pool_reset(void)
         pools[i].free_head = NULL;
         pools[i].max_alloc = pools[i].num_alloc;
     }
+#endif // LEAN_POOLS
+
+    while (NULL != arena.pSpare)
+    {
+        ARENA_SLAB *ps = arena.pSpare;
+        arena.pSpare = ps->next;
+        arena_slab_delete(ps);
+    }
+    arena.nSpare = 0;
+    arena.nSlabsMax = arena.nSlabs;
+    arena.nBytesMax = arena.nBytes;
 }
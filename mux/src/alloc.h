@@ -38,6 +38,11 @@ extern void pool_free_lbuf(__in_ecount(LBUF_SIZE) UTF8 *, __in const UTF8 *, int
 extern void list_bufstats(dbref);
 extern void list_buftrace(dbref);
 extern void pool_reset(void);
+extern void pool_arena_open(void);
+extern void pool_arena_close(void);
+extern UTF8 *pool_alloc_keep(int, __in const UTF8 *, __in const UTF8 *, int);
+extern UINT64 pool_total_allocs(void);
+extern const UTF8 *pool_stats(int, size_t *, UINT64 *, UINT64 *, UINT64 *);
 
 #define alloc_lbuf(s)    pool_alloc_lbuf((UTF8 *)s, (UTF8 *)__FILE__, __LINE__)
 #define free_lbuf(b)     pool_free_lbuf((UTF8 *)(b), (UTF8 *)__FILE__, __LINE__)
@@ -45,6 +50,9 @@ extern void pool_reset(void);
 #define free_mbuf(b)     pool_free(POOL_MBUF,(UTF8 *)(b), (UTF8 *)__FILE__, __LINE__)
 #define alloc_sbuf(s)    pool_alloc(POOL_SBUF, (UTF8 *)s, (UTF8 *)__FILE__, __LINE__)
 #define free_sbuf(b)     pool_free(POOL_SBUF,(UTF8 *)(b), (UTF8 *)__FILE__, __LINE__)
+#define alloc_lbuf_keep(s) pool_alloc_keep(POOL_LBUF, (UTF8 *)s, (UTF8 *)__FILE__, __LINE__)
+#define alloc_mbuf_keep(s) pool_alloc_keep(POOL_MBUF, (UTF8 *)s, (UTF8 *)__FILE__, __LINE__)
+#define alloc_sbuf_keep(s) pool_alloc_keep(POOL_SBUF, (UTF8 *)s, (UTF8 *)__FILE__, __LINE__)
 #define alloc_bool(s)    (struct boolexp *)pool_alloc(POOL_BOOL, (UTF8 *)s, (UTF8 *)__FILE__, __LINE__)
 #define free_bool(b)     pool_free(POOL_BOOL,(UTF8 *)(b), (UTF8 *)__FILE__, __LINE__)
 #define alloc_qentry(s)  (BQUE *)pool_alloc(POOL_QENTRY, (UTF8 *)s, (UTF8 *)__FILE__, __LINE__)
@@ -49,6 +49,7 @@ typedef struct tagCacheEntryHeader
 static PCENT_HDR pCacheHead = 0;
 static PCENT_HDR pCacheTail = 0;
 static size_t CacheSize = 0;
+static INT64 CacheEvictions = 0;
 
 int cache_init(const UTF8 *game_dir_file, const UTF8 *game_pag_file,
     int nCachePages)
@@ -213,10 +214,21 @@ static void ADD_ENTRY(PCENT_HDR pEntry)
     }
 }
 
+// Once the cache is full, every insertion evicts something, so evictions
+// are counted and given to the flight recorder at most once a second.
+//
+static INT64 CacheEvictionsRecorded = 0;
+static CLinearTimeAbsolute ltaCacheRecorded;
+
 static void TrimCache(void)
 {
     // Check to see if the cache needs to be trimmed.
     //
+    if (CacheSize <= mudconf.max_cache_size)
+    {
+        return;
+    }
+
     while (CacheSize > mudconf.max_cache_size)
     {
         // Blow something away.
@@ -230,11 +242,31 @@ static void TrimCache(void)
 
         REMOVE_ENTRY(pCacheEntry);
         CacheSize -= pCacheEntry->nSize;
+        CacheEvictions++;
         hashdeleteLEN(&(pCacheEntry->attrKey), sizeof(Aname),
             &mudstate.acache_htab);
         MEMFREE(pCacheEntry);
         pCacheEntry = NULL;
     }
+
+    CLinearTimeAbsolute ltaNow;
+    ltaNow.GetUTC();
+    if (ltaCacheRecorded + time_1s <= ltaNow)
+    {
+        flight_record(FLIGHT_CACHE, mudstate.curr_executor, mudstate.curr_enactor,
+            CacheEvictions - CacheEvictionsRecorded, T("attrcache"));
+        CacheEvictionsRecorded = CacheEvictions;
+        ltaCacheRecorded = ltaNow;
+    }
+}
+
+// cache_stats: Report the bytes held by the attribute cache and how many
+// entries have been pushed out of it to stay under max_cache_size.
+//
+void cache_stats(size_t *pnBytes, INT64 *pnEvictions)
+{
+    *pnBytes = CacheSize;
+    *pnEvictions = CacheEvictions;
 }
 
 const UTF8 *cache_get(Aname *nam, size_t *pLen)
@@ -18,6 +18,10 @@
 
 #include <signal.h>
 
+#if defined(UNIX_NETWORKING_THREADS)
+#include <pthread.h>
+#endif // UNIX_NETWORKING_THREADS
+
 #include "attrs.h"
 #include "command.h"
 #include "file_c.h"
@@ -27,6 +31,7 @@
 #if defined(HAVE_DLOPEN) && defined(STUB_SLAVE)
 extern QUEUE_INFO Queue_In;
 extern QUEUE_INFO Queue_Out;
+extern QUEUE_INFO Queue_Frame;
 #endif
 
 #ifdef SOLARIS
@@ -54,6 +59,10 @@ static DESC *new_connection(PortInfo *Port, int *piError);
 #endif
 static bool process_input(DESC *);
 static int make_nonblocking(SOCKET s);
+#if defined(UNIX_NETWORKING)
+static void process_input_helper(DESC *d, char *pBytes, int nBytes);
+static bool write_output(DESC *d);
+#endif // UNIX_NETWORKING
 
 pid_t game_pid;
 
@@ -400,6 +409,7 @@ void CleanUpStubSlaveSocket(void)
         }
         stubslave_socket = INVALID_SOCKET;
     }
+    Pipe_CloseRing();
 }
 
 void WaitOnStubSlaveProcess(void)
@@ -415,7 +425,9 @@ void WaitOnStubSlaveProcess(void)
  *
  * This spawns the stub slave process and creates a socket-oriented,
  * bi-directional communication path between that process and this
- * process. Any existing slave process is killed.
+ * process. Where possible, the frames are carried by a pair of rings in
+ * shared memory instead, and the socket is kept only as the connection to
+ * the process. Any existing slave process is killed.
  *
  * \param executor dbref of Executor.
  * \param caller   dbref of Caller.
@@ -429,6 +441,9 @@ void boot_stubslave(dbref executor, dbref caller, dbref enactor, int)
     int sv[2];
     int i;
     int maxfds;
+    int aRing[3];
+    UTF8 aRingArg[3*12];
+    bool bRing;
 
 #ifdef HAVE_GETDTABLESIZE
     maxfds = getdtablesize();
@@ -439,12 +454,27 @@ void boot_stubslave(dbref executor, dbref caller, dbref enactor, int)
     CleanUpStubSlaveSocket();
     WaitOnStubSlaveProcess();
 
-    if (socketpair(AF_UNIX, SOCK_DGRAM, 0, sv) < 0)
+    // A sequenced-packet socket keeps the boundaries stubslave writes and,
+    // unlike a datagram socket, reads as end-of-file once stubslave is gone.
+    // Fall back to datagrams where it is not supported.
+    //
+    if (  socketpair(AF_UNIX, SOCK_SEQPACKET, 0, sv) < 0
+       && socketpair(AF_UNIX, SOCK_DGRAM, 0, sv) < 0)
     {
         pFailedFunc = "socketpair() error: ";
         goto failure;
     }
 
+    // If the rings cannot be created, the socket carries everything.  The
+    // stubslave is told which descriptors to use as its own wake-up (our
+    // peer) and which to signal (ours).
+    //
+    bRing = MUX_SUCCEEDED(Pipe_CreateRing(&aRing[0], &aRing[1], &aRing[2]));
+    if (bRing)
+    {
+        mux_sprintf(aRingArg, sizeof(aRingArg), T("%d,%d,%d"), aRing[0], aRing[2], aRing[1]);
+    }
+
     // Set to nonblocking.
     //
     if (make_nonblocking(sv[0]) < 0)
@@ -463,6 +493,11 @@ void boot_stubslave(dbref executor, dbref caller, dbref enactor, int)
         pFailedFunc = "fork() error: ";
         mux_close(sv[0]);
         mux_close(sv[1]);
+        if (bRing)
+        {
+            mux_close(aRing[0]);
+            Pipe_CloseRing();
+        }
         goto failure;
 
     case 0:
@@ -498,13 +533,45 @@ void boot_stubslave(dbref executor, dbref caller, dbref enactor, int)
         }
         for (i = 3; i < maxfds; i++)
         {
-            mux_close(i);
+            if (  !bRing
+               || (  i != aRing[0]
+                  && i != aRing[1]
+                  && i != aRing[2]))
+            {
+                mux_close(i);
+            }
+        }
+
+        if (bRing)
+        {
+            fcntl(aRing[0], F_SETFD, 0);
+            fcntl(aRing[1], F_SETFD, 0);
+            fcntl(aRing[2], F_SETFD, 0);
+        }
+
+        if (bRing)
+        {
+            execlp("bin/stubslave", "stubslave", (char *)aRingArg, (char *)NULL);
+        }
+        else
+        {
+            execlp("bin/stubslave", "stubslave", (char *)NULL);
         }
-        execlp("bin/stubslave", "stubslave", (char *)NULL);
         _exit(1);
     }
     mux_close(sv[1]);
 
+    if (bRing)
+    {
+        // Our mapping of the rings outlives the descriptor.
+        //
+        mux_close(aRing[0]);
+        if (maxd <= Pipe_GetRingHandle())
+        {
+            maxd = Pipe_GetRingHandle() + 1;
+        }
+    }
+
     stubslave_socket = sv[0];
     DebugTotalSockets++;
     if (make_nonblocking(stubslave_socket) < 0)
@@ -522,6 +589,10 @@ void boot_stubslave(dbref executor, dbref caller, dbref enactor, int)
     STARTLOG(LOG_ALWAYS, "NET", "STUB");
     log_text(T("Stub slave started on fd "));
     log_number(stubslave_socket);
+    if (bRing)
+    {
+        log_text(T(" using shared-memory rings"));
+    }
     ENDLOG;
     return;
 
@@ -559,7 +630,10 @@ failure:
 
 static int StubSlaveRead(void)
 {
-    char buf[LBUF_SIZE];
+    // The socket is datagram-oriented, and stubslave writes up to a full
+    // queue block at a time.  A shorter read would discard the remainder.
+    //
+    static char buf[QUEUE_BLOCK_SIZE];
 
     int len = mux_read(stubslave_socket, buf, sizeof(buf));
     if (len < 0)
@@ -581,6 +655,15 @@ static int StubSlaveRead(void)
     }
     else if (0 == len)
     {
+        // stubslave never writes an empty packet, so this is end-of-file.
+        //
+        CleanUpStubSlaveSocket();
+        WaitOnStubSlaveProcess();
+
+        STARTLOG(LOG_ALWAYS, "NET", "STUB");
+        log_text(T("stubslave closed its socket. Stubslave stopped."));
+        ENDLOG;
+
         return -1;
     }
 
@@ -1412,128 +1495,1431 @@ void shovechars(int nPorts, PortInfo aPorts[])
 
 #elif defined(UNIX_NETWORKING)
 
-#if defined(UNIX_NETWORKING_SELECT)
+static void undo_autodark(DESC *d)
+{
+    if (d->flags & DS_AUTODARK)
+    {
+        // Clear the DS_AUTODARK on every related session.
+        //
+        DESC *d1;
+        DESC_ITER_PLAYER(d->player, d1)
+        {
+            d1->flags &= ~DS_AUTODARK;
+        }
+        s_Flags(d->player, FLAG_WORD1, Flags(d->player) & ~DARK);
+    }
+}
 
-#define CheckInput(x)     FD_ISSET(x, &input_set)
-#define CheckOutput(x)    FD_ISSET(x, &output_set)
+#if defined(UNIX_NETWORKING_THREADS)
 
-void shovechars(int nPorts, PortInfo aPorts[])
+// Threaded network I/O.
+//
+// When io_threads is set, each connection is served by one of a few I/O
+// threads.  The thread selects on its sockets, reads and decodes telnet with
+// process_input_helper(), and writes out the output queue.  Complete command
+// lines go to the main thread through a lock-free, multiple-producer,
+// single-consumer queue, and are saved there with save_command(), so
+// commands still run one at a time on the main thread.
+//
+// Each I/O thread has a mutex covering the input decoding state and the
+// output queue of every descriptor it serves.  The thread holds it except
+// while waiting in select(), and the main thread takes it through
+// lock_descriptor() whenever it touches that state.
+//
+
+#define IO_MAX_THREADS 16
+
+// io_thread of a descriptor whose socket is closed but which messages in
+// the queue still name.
+//
+#define IO_DEFUNCT (-2)
+
+typedef struct io_message IO_MESSAGE;
+struct io_message
 {
-    fd_set input_set, output_set;
-    int found;
-    DESC *d, *dnext, *newd;
-    unsigned int avail_descriptors;
-    int maxfds;
-    int i;
+    IO_MESSAGE * volatile next;
+    int    iType;
+    DESC  *d;
+    void  *pv;
+    size_t n;
+};
 
-    mudstate.debug_cmd = T("< shovechars_select >");
+#define IOM_LINE  0 // A command line of n bytes follows the message.
+#define IOM_CLOSE 1 // The connection has failed or was closed.
+#define IOM_FREE  2 // pv is to be freed by the main thread.
 
-    CLinearTimeAbsolute ltaLastSlice;
-    ltaLastSlice.GetUTC();
+typedef struct
+{
+    pthread_t       thread;
+    pthread_mutex_t mutex;
+    int             fdWake[2];
+    bool            bWakePending;
+    bool            bDirty;
+    bool            bShutdown;
+    unsigned int    iChange;    // Advanced whenever aDesc changes.
+    DESC          **aDesc;
+    int             nDesc;
+    int             nAlloc;
+} IO_THREAD;
+
+static IO_THREAD aIoThreads[IO_MAX_THREADS];
+static int       nIoThreads = 0;
+static pthread_t MainThread;
+
+// Producers exchange each message into pIoHead, and the main thread alone
+// takes them from pIoTail.  IoStub keeps the list from ever being empty.
+//
+static IO_MESSAGE            IoStub;
+static IO_MESSAGE * volatile pIoHead = &IoStub;
+static IO_MESSAGE           *pIoTail = &IoStub;
+static int                   fdMainWake[2] = { -1, -1 };
+static volatile int          bMainWakePending = 0;
 
-#ifdef HAVE_GETDTABLESIZE
-    maxfds = getdtablesize();
-#else // HAVE_GETDTABLESIZE
-    maxfds = sysconf(_SC_OPEN_MAX);
-#endif // HAVE_GETDTABLESIZE
+bool on_io_thread(void)
+{
+    return (  0 < nIoThreads
+           && !pthread_equal(pthread_self(), MainThread));
+}
 
-    avail_descriptors = maxfds - 7;
+/*! \brief Take the lock covering a descriptor's network state.
+ *
+ * The lock is recursive.  It is only needed on the main thread, and only
+ * while an I/O thread serves the descriptor.
+ *
+ * \param d        Player connection.
+ * \return         true if the lock was taken and unlock_descriptor() is due.
+ */
 
-    while (!mudstate.shutdown_flag)
+bool lock_descriptor(DESC *d)
+{
+    if (0 <= d->io_thread)
     {
-        CLinearTimeAbsolute ltaCurrent;
-        ltaCurrent.GetUTC();
-        update_quotas(ltaLastSlice, ltaCurrent);
+        pthread_mutex_lock(&aIoThreads[d->io_thread].mutex);
+        return true;
+    }
+    return false;
+}
 
-        // Check the scheduler.
-        //
-        scheduler.RunTasks(ltaCurrent);
-        CLinearTimeAbsolute ltaWakeUp;
-        if (scheduler.WhenNext(&ltaWakeUp))
+void unlock_descriptor(DESC *d)
+{
+    IO_THREAD *pt = &aIoThreads[d->io_thread];
+    pt->bDirty = true;
+    pthread_mutex_unlock(&pt->mutex);
+}
+
+// The caller holds pt->mutex.
+//
+static void io_wake_thread(IO_THREAD *pt)
+{
+    if (!pt->bWakePending)
+    {
+        pt->bWakePending = true;
+        char ch = 0;
+        if (mux_write(pt->fdWake[1], &ch, 1) < 0)
         {
-            if (ltaWakeUp < ltaCurrent)
-            {
-                ltaWakeUp = ltaCurrent;
-            }
+            ; // The pipe is full, so a wakeup is waiting already.
         }
-        else
+    }
+}
+
+static void io_wake_main(void)
+{
+    if (__sync_bool_compare_and_swap(&bMainWakePending, 0, 1))
+    {
+        char ch = 0;
+        if (mux_write(fdMainWake[1], &ch, 1) < 0)
         {
-            CLinearTimeDelta ltd = time_30m;
-            ltaWakeUp = ltaCurrent + ltd;
+            ; // The pipe is full, so a wakeup is waiting already.
         }
+    }
+}
 
-        if (mudstate.shutdown_flag)
+static void io_drain_pipe(int fd)
+{
+    char buf[64];
+    while (0 < mux_read(fd, buf, sizeof(buf)))
+    {
+        ; // Nothing.
+    }
+}
+
+static void io_push(IO_MESSAGE *m)
+{
+    m->next = NULL;
+    __sync_synchronize();
+    IO_MESSAGE *prev = __sync_lock_test_and_set(&pIoHead, m);
+    prev->next = m;
+}
+
+static IO_MESSAGE *io_pop(void)
+{
+    IO_MESSAGE *tail = pIoTail;
+    IO_MESSAGE *next = tail->next;
+    if (&IoStub == tail)
+    {
+        if (NULL == next)
         {
-            break;
+            return NULL;
         }
+        pIoTail = next;
+        tail = next;
+        next = next->next;
+    }
 
-        FD_ZERO(&input_set);
-        FD_ZERO(&output_set);
+    if (NULL != next)
+    {
+        pIoTail = next;
+        return tail;
+    }
 
-#if defined(HAVE_WORKING_FORK) && defined(STUB_SLAVE)
-        // Listen for replies from the stubslave socket.
-        //
-        if (!IS_INVALID_SOCKET(stubslave_socket))
+    // A producer which has exchanged itself into pIoHead but not yet linked
+    // itself in will wake us again when it has.
+    //
+    if (tail != pIoHead)
+    {
+        return NULL;
+    }
+
+    io_push(&IoStub);
+    next = tail->next;
+    if (NULL != next)
+    {
+        pIoTail = next;
+        return tail;
+    }
+    return NULL;
+}
+
+/*! \brief Queue a message from an I/O thread to the main thread.
+ *
+ * \param iType    IOM_LINE, IOM_CLOSE, or IOM_FREE.
+ * \param d        Player connection it concerns.
+ * \param pv       Pointer for IOM_FREE.
+ * \param pText    Line for IOM_LINE.
+ * \param n        Length of pText.
+ * \return         None.
+ */
+
+static void io_post(int iType, DESC *d, void *pv, const UTF8 *pText, size_t n)
+{
+    IO_MESSAGE *m = (IO_MESSAGE *)MEMALLOC(sizeof(IO_MESSAGE) + n + 1);
+    ISOUTOFMEMORY(m);
+    m->iType = iType;
+    m->d = d;
+    m->pv = pv;
+    m->n = n;
+    UTF8 *pLine = (UTF8 *)(m + 1);
+    if (0 < n)
+    {
+        memcpy(pLine, pText, n);
+    }
+    pLine[n] = '\0';
+
+    __sync_fetch_and_add(&d->io_pending, 1);
+    io_push(m);
+}
+
+/*! \brief Handle everything the I/O threads have queued for the main thread.
+ *
+ * \return         None.
+ */
+
+static void io_drain(void)
+{
+    IO_MESSAGE *m;
+    while (NULL != (m = io_pop()))
+    {
+        DESC *d = m->d;
+        int nPending = __sync_sub_and_fetch(&d->io_pending, 1);
+        if (IO_DEFUNCT == d->io_thread)
         {
-            FD_SET(stubslave_socket, &input_set);
-            if (0 < Pipe_QueueLength(&Queue_Out))
+            if (IOM_FREE == m->iType)
             {
-                FD_SET(stubslave_socket, &output_set);
+                MEMFREE(m->pv);
+            }
+            if (0 == nPending)
+            {
+                free_desc(d);
             }
         }
-#endif // HAVE_WORKING_FORK && STUB_SLAVE
+        else if (IOM_LINE == m->iType)
+        {
+            undo_autodark(d);
+            CBLK *cmd = (CBLK *)alloc_lbuf("io_drain");
+            memcpy(cmd->cmd, m + 1, m->n + 1);
+            save_command(d, cmd);
+        }
+        else if (IOM_CLOSE == m->iType)
+        {
+            shutdownsock(d, R_SOCKDIED);
+        }
+        else
+        {
+            MEMFREE(m->pv);
+        }
+        MEMFREE(m);
+    }
+}
 
-        // Listen for new connections if there are free descriptors.
-        //
-        if (ndescriptors < avail_descriptors)
+/*! \brief Wake each I/O thread whose descriptors the main thread has touched.
+ *
+ * This is done once per pass of shovechars(), so that output from a burst
+ * of commands goes out together.
+ *
+ * \return         None.
+ */
+
+static void io_flush(void)
+{
+    for (int i = 0; i < nIoThreads; i++)
+    {
+        IO_THREAD *pt = &aIoThreads[i];
+        pthread_mutex_lock(&pt->mutex);
+        if (pt->bDirty)
         {
-            for (i = 0; i < nPorts; i++)
-            {
-                FD_SET(aPorts[i].socket, &input_set);
-            }
+            pt->bDirty = false;
+            io_wake_thread(pt);
         }
+        pthread_mutex_unlock(&pt->mutex);
+    }
+}
 
-#if defined(HAVE_WORKING_FORK)
-        // Listen for replies from the slave socket.
-        //
-        if (!IS_INVALID_SOCKET(slave_socket))
+void io_input_drained(DESC *d)
+{
+    if (lock_descriptor(d))
+    {
+        if (IO_THROTTLED == d->io_state)
         {
-            FD_SET(slave_socket, &input_set);
+            d->io_state = IO_OPEN;
         }
-#endif // HAVE_WORKING_FORK
+        unlock_descriptor(d);
+    }
+}
 
-        // Mark sockets that we want to test for change in status.
+// Read from a socket on its I/O thread.  Returns true if anything was
+// queued for the main thread.
+//
+static bool io_read(DESC *d)
+{
+    char buf[LBUF_SIZE];
+    int got = mux_socket_read(d, buf, sizeof(buf), 0);
+    if (  IS_SOCKET_ERROR(got)
+       || 0 == got)
+    {
+        int iSocketError = SOCKET_LAST_ERROR;
+        if (  IS_SOCKET_ERROR(got)
+           && (  iSocketError == SOCKET_EWOULDBLOCK
+#ifdef SOCKET_EAGAIN
+              || iSocketError == SOCKET_EAGAIN
+#endif // SOCKET_EAGAIN
+              || iSocketError == SOCKET_EINTR))
+        {
+            return false;
+        }
+        d->io_state = IO_CLOSING;
+        io_post(IOM_CLOSE, d, NULL, NULL, 0);
+        return true;
+    }
+    process_input_helper(d, buf, got);
+    return (IO_THROTTLED == d->io_state);
+}
+
+static void *io_thread_main(void *arg)
+{
+    IO_THREAD *pt = (IO_THREAD *)arg;
+    fd_set input_set, output_set;
+
+    pthread_mutex_lock(&pt->mutex);
+    while (!pt->bShutdown)
+    {
+        // A connection is not read while lines from it wait to be run.
         //
-        DESC_ITER_ALL(d)
+        FD_ZERO(&input_set);
+        FD_ZERO(&output_set);
+        FD_SET(pt->fdWake[0], &input_set);
+        int maxfd = pt->fdWake[0];
+        for (int i = 0; i < pt->nDesc; i++)
         {
-            if (!d->input_head)
+            DESC *d = pt->aDesc[i];
+            if (IO_OPEN == d->io_state)
             {
                 FD_SET(d->descriptor, &input_set);
             }
-            if (d->output_head)
+            if (  NULL != d->output_head
+               && IO_CLOSING != d->io_state)
             {
                 FD_SET(d->descriptor, &output_set);
             }
+            if (maxfd < d->descriptor)
+            {
+                maxfd = d->descriptor;
+            }
         }
+        unsigned int iChange = pt->iChange;
+        pthread_mutex_unlock(&pt->mutex);
 
-        // Wait for something to happen.
-        //
-        struct timeval timeout;
-        CLinearTimeDelta ltdTimeout = ltaWakeUp - ltaCurrent;
-        ltdTimeout.ReturnTimeValueStruct(&timeout);
-        found = select(maxd, &input_set, &output_set, (fd_set *) NULL,
-                   &timeout);
+        int found = select(maxfd + 1, &input_set, &output_set, NULL, NULL);
 
+        pthread_mutex_lock(&pt->mutex);
         if (IS_SOCKET_ERROR(found))
         {
-            int iSocketError = SOCKET_LAST_ERROR;
-            if (iSocketError == SOCKET_EBADF)
-            {
-                // This one is bad, as it results in a spiral of
-                // doom, unless we can figure out what the bad file
-                // descriptor is and get rid of it.
-                //
-                log_perror(T("NET"), T("FAIL"), T("checking for activity"), T("select"));
+            continue;
+        }
+
+        if (FD_ISSET(pt->fdWake[0], &input_set))
+        {
+            io_drain_pipe(pt->fdWake[0]);
+            pt->bWakePending = false;
+        }
+
+        // If a descriptor came or went during select(), its socket number
+        // may now belong to some other connection.
+        //
+        if (iChange != pt->iChange)
+        {
+            continue;
+        }
+
+        bool bPosted = false;
+        for (int i = 0; i < pt->nDesc; i++)
+        {
+            DESC *d = pt->aDesc[i];
+            if (  FD_ISSET(d->descriptor, &input_set)
+               && io_read(d))
+            {
+                bPosted = true;
+            }
+            if (  FD_ISSET(d->descriptor, &output_set)
+               && IO_CLOSING != d->io_state
+               && !write_output(d))
+            {
+                d->io_state = IO_CLOSING;
+                io_post(IOM_CLOSE, d, NULL, NULL, 0);
+                bPosted = true;
+            }
+        }
+
+        if (bPosted)
+        {
+            io_wake_main();
+        }
+    }
+    pthread_mutex_unlock(&pt->mutex);
+    return NULL;
+}
+
+static bool io_open_pipe(int fd[2])
+{
+    if (pipe(fd) < 0)
+    {
+        log_perror(T("NET"), T("FAIL"), T("io_threads"), T("pipe"));
+        return false;
+    }
+    make_nonblocking(fd[0]);
+    make_nonblocking(fd[1]);
+    fcntl(fd[0], F_SETFD, FD_CLOEXEC);
+    fcntl(fd[1], F_SETFD, FD_CLOEXEC);
+    return true;
+}
+
+static void io_close_pipe(int fd[2])
+{
+    mux_close(fd[0]);
+    mux_close(fd[1]);
+    fd[0] = fd[1] = -1;
+}
+
+/*! \brief Give a descriptor's socket to the least-busy I/O thread.
+ *
+ * \param d        Player connection.
+ * \return         None.
+ */
+
+static void io_attach(DESC *d)
+{
+    if (  0 == nIoThreads
+       || IS_INVALID_SOCKET(d->descriptor)
+       || FD_SETSIZE <= d->descriptor)
+    {
+        return;
+    }
+
+    int iThread = 0;
+    for (int i = 1; i < nIoThreads; i++)
+    {
+        if (aIoThreads[i].nDesc < aIoThreads[iThread].nDesc)
+        {
+            iThread = i;
+        }
+    }
+
+    IO_THREAD *pt = &aIoThreads[iThread];
+    pthread_mutex_lock(&pt->mutex);
+    if (pt->nDesc == pt->nAlloc)
+    {
+        int nAlloc = (0 == pt->nAlloc) ? 64 : 2*pt->nAlloc;
+        DESC **aDesc = (DESC **)MEMREALLOC(pt->aDesc, nAlloc * sizeof(DESC *));
+        ISOUTOFMEMORY(aDesc);
+        pt->aDesc = aDesc;
+        pt->nAlloc = nAlloc;
+    }
+
+    // Partial input held in pool buffers moves to the heap.
+    //
+    if (NULL != d->raw_input)
+    {
+        CBLK *p = (CBLK *)MEMALLOC(LBUF_SIZE);
+        ISOUTOFMEMORY(p);
+        memcpy(p, d->raw_input, LBUF_SIZE);
+        d->raw_input_at = p->cmd + (d->raw_input_at - d->raw_input->cmd);
+        free_lbuf(d->raw_input);
+        d->raw_input = p;
+    }
+    if (NULL != d->aOption)
+    {
+        unsigned char *p = (unsigned char *)MEMALLOC(SBUF_SIZE);
+        ISOUTOFMEMORY(p);
+        memcpy(p, d->aOption, SBUF_SIZE);
+        free_sbuf(d->aOption);
+        d->aOption = p;
+    }
+
+    d->io_thread = iThread;
+    d->io_slot = pt->nDesc;
+    d->io_state = (NULL == d->input_head) ? IO_OPEN : IO_THROTTLED;
+    pt->aDesc[pt->nDesc++] = d;
+    pt->iChange++;
+    io_wake_thread(pt);
+    pthread_mutex_unlock(&pt->mutex);
+}
+
+/*! \brief Take a descriptor's socket back from its I/O thread.
+ *
+ * Once this returns, the I/O thread will not touch the descriptor again,
+ * though messages about it may still be queued.
+ *
+ * \param d        Player connection.
+ * \return         None.
+ */
+
+static void io_detach(DESC *d)
+{
+    if (d->io_thread < 0)
+    {
+        return;
+    }
+
+    IO_THREAD *pt = &aIoThreads[d->io_thread];
+    pthread_mutex_lock(&pt->mutex);
+    DESC *dLast = pt->aDesc[--pt->nDesc];
+    pt->aDesc[d->io_slot] = dLast;
+    dLast->io_slot = d->io_slot;
+    pt->iChange++;
+
+    if (NULL != d->raw_input)
+    {
+        CBLK *p = (CBLK *)alloc_lbuf_keep("process_input.raw");
+        memcpy(p, d->raw_input, LBUF_SIZE);
+        d->raw_input_at = p->cmd + (d->raw_input_at - d->raw_input->cmd);
+        MEMFREE(d->raw_input);
+        d->raw_input = p;
+    }
+    if (NULL != d->aOption)
+    {
+        unsigned char *p = (unsigned char *)alloc_sbuf_keep("process_input.sb");
+        memcpy(p, d->aOption, SBUF_SIZE);
+        MEMFREE(d->aOption);
+        d->aOption = p;
+    }
+
+    d->io_thread = -1;
+    d->io_slot = -1;
+    io_wake_thread(pt);
+    pthread_mutex_unlock(&pt->mutex);
+}
+
+/*! \brief Start the I/O threads and give them the existing connections.
+ *
+ * \return         None.
+ */
+
+static void start_io_threads(void)
+{
+    int nThreads = mudconf.io_threads;
+    if (IO_MAX_THREADS < nThreads)
+    {
+        nThreads = IO_MAX_THREADS;
+    }
+    if (  nThreads <= 0
+       || !io_open_pipe(fdMainWake))
+    {
+        return;
+    }
+    if (maxd <= fdMainWake[0])
+    {
+        maxd = fdMainWake[0] + 1;
+    }
+    MainThread = pthread_self();
+
+    // The I/O threads take no signals.
+    //
+    sigset_t all, old;
+    sigfillset(&all);
+    pthread_sigmask(SIG_SETMASK, &all, &old);
+
+    for (int i = 0; i < nThreads; i++)
+    {
+        IO_THREAD *pt = &aIoThreads[nIoThreads];
+        memset(pt, 0, sizeof(IO_THREAD));
+        if (!io_open_pipe(pt->fdWake))
+        {
+            break;
+        }
+
+        pthread_mutexattr_t attr;
+        pthread_mutexattr_init(&attr);
+        pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+        pthread_mutex_init(&pt->mutex, &attr);
+        pthread_mutexattr_destroy(&attr);
+
+        if (0 != pthread_create(&pt->thread, NULL, io_thread_main, pt))
+        {
+            pthread_mutex_destroy(&pt->mutex);
+            io_close_pipe(pt->fdWake);
+            break;
+        }
+        nIoThreads++;
+    }
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+
+    if (0 == nIoThreads)
+    {
+        io_close_pipe(fdMainWake);
+        return;
+    }
+
+    STARTLOG(LOG_STARTUP, "NET", "IO");
+    log_text(T("Started "));
+    log_number(nIoThreads);
+    log_text(T(" network I/O threads."));
+    ENDLOG;
+
+    DESC *d;
+    DESC_ITER_ALL(d)
+    {
+        io_attach(d);
+    }
+}
+
+/*! \brief Stop the I/O threads and take back their connections.
+ *
+ * Needed before @restart passes the sockets on, and at shutdown.
+ *
+ * \return         None.
+ */
+
+void stop_io_threads(void)
+{
+    if (0 == nIoThreads)
+    {
+        return;
+    }
+
+    int i;
+    for (i = 0; i < nIoThreads; i++)
+    {
+        IO_THREAD *pt = &aIoThreads[i];
+        pthread_mutex_lock(&pt->mutex);
+        pt->bShutdown = true;
+        io_wake_thread(pt);
+        pthread_mutex_unlock(&pt->mutex);
+        pthread_join(pt->thread, NULL);
+    }
+
+    DESC *d;
+    DESC_ITER_ALL(d)
+    {
+        io_detach(d);
+    }
+    io_drain();
+
+    for (i = 0; i < nIoThreads; i++)
+    {
+        IO_THREAD *pt = &aIoThreads[i];
+        pthread_mutex_destroy(&pt->mutex);
+        io_close_pipe(pt->fdWake);
+        if (NULL != pt->aDesc)
+        {
+            MEMFREE(pt->aDesc);
+            pt->aDesc = NULL;
+        }
+    }
+    nIoThreads = 0;
+    io_close_pipe(fdMainWake);
+}
+
+#endif // UNIX_NETWORKING_THREADS
+
+#if defined(UNIX_NETWORKING_SELECT)
+
+// Metrics page.
+//
+// When metrics_port is set, the server also listens on that port of the
+// loopback interface and answers each HTTP request there with a Prometheus
+// text exposition of its internal counters.  The sockets are non-blocking
+// and serviced from the same select() as player connections.  The page is
+// built in one pass from counters the server already keeps, so a scrape
+// costs about as much as an @list.
+//
+
+#define METRICS_MAX_CLIENTS  4
+#define METRICS_REQUEST_SIZE 1024
+
+typedef struct
+{
+    SOCKET s;
+    CLinearTimeAbsolute ltaAccepted;
+    size_t nRequest;
+    char   aRequest[METRICS_REQUEST_SIZE];
+    char  *pResponse;
+    size_t nResponse;
+    size_t nSent;
+} METRICS_CLIENT;
+
+typedef struct
+{
+    char  *p;
+    size_t n;
+    size_t nAlloc;
+} METRICS_PAGE;
+
+static SOCKET metrics_socket = INVALID_SOCKET;
+static METRICS_CLIENT aMetricsClients[METRICS_MAX_CLIENTS];
+static int nMetricsClients = 0;
+
+static void metrics_append(METRICS_PAGE *pg, const UTF8 *fmt, ...)
+{
+    UTF8 buff[MBUF_SIZE];
+    va_list ap;
+    va_start(ap, fmt);
+    size_t n = mux_vsnprintf(buff, sizeof(buff), fmt, ap);
+    va_end(ap);
+
+    if (pg->nAlloc < pg->n + n)
+    {
+        size_t nAlloc = 2*pg->nAlloc + n;
+        char *p = (char *)MEMALLOC(nAlloc);
+        ISOUTOFMEMORY(p);
+        if (NULL != pg->p)
+        {
+            memcpy(p, pg->p, pg->n);
+            MEMFREE(pg->p);
+        }
+        pg->p = p;
+        pg->nAlloc = nAlloc;
+    }
+    memcpy(pg->p + pg->n, buff, n);
+    pg->n += n;
+}
+
+static void metrics_family(METRICS_PAGE *pg, const UTF8 *pName,
+    const UTF8 *pType, const UTF8 *pHelp)
+{
+    metrics_append(pg, T("# HELP %s %s\n# TYPE %s %s\n"), pName, pHelp,
+        pName, pType);
+}
+
+/*! \brief Builds the metrics page.
+ *
+ * \param pg       Page to append to.
+ * \return         None.
+ */
+
+static void metrics_build(METRICS_PAGE *pg)
+{
+    CLinearTimeAbsolute ltaNow;
+    ltaNow.GetUTC();
+    CLinearTimeDelta ltdUp = ltaNow - mudstate.start_time;
+
+    metrics_family(pg, T("netmux_uptime_seconds"), T("gauge"),
+        T("Seconds since the server started."));
+    metrics_append(pg, T("netmux_uptime_seconds %lld\n"),
+        (INT64)ltdUp.ReturnSeconds());
+
+    metrics_family(pg, T("netmux_restarts_total"), T("counter"),
+        T("@restarts since the server started."));
+    metrics_append(pg, T("netmux_restarts_total %u\n"), mudstate.restart_count);
+
+    metrics_family(pg, T("netmux_objects"), T("gauge"),
+        T("Objects in the database."));
+    metrics_append(pg, T("netmux_objects %d\n"), mudstate.db_top);
+
+    // Connections and their queues.
+    //
+    int nConnected = 0;
+    size_t nOutput = 0;
+    size_t nOutputMax = 0;
+    size_t nInput = 0;
+    DESC *d;
+    DESC_ITER_ALL(d)
+    {
+        if (d->flags & DS_CONNECTED)
+        {
+            nConnected++;
+        }
+        nOutput += d->output_size;
+        if (nOutputMax < d->output_size)
+        {
+            nOutputMax = d->output_size;
+        }
+        nInput += d->input_size;
+    }
+
+    metrics_family(pg, T("netmux_connections"), T("gauge"),
+        T("Open network connections."));
+    metrics_append(pg, T("netmux_connections %u\n"), ndescriptors);
+
+    metrics_family(pg, T("netmux_players_connected"), T("gauge"),
+        T("Connections logged in to a player."));
+    metrics_append(pg, T("netmux_players_connected %d\n"), nConnected);
+
+    metrics_family(pg, T("netmux_commands_total"), T("counter"),
+        T("Commands received from connections."));
+    metrics_append(pg, T("netmux_commands_total %lld\n"),
+        (INT64)mudstate.commands_total);
+
+    metrics_family(pg, T("netmux_output_backlog_bytes"), T("gauge"),
+        T("Output queued for all connections."));
+    metrics_append(pg, T("netmux_output_backlog_bytes %lld\n"),
+        (INT64)nOutput);
+
+    metrics_family(pg, T("netmux_output_backlog_max_bytes"), T("gauge"),
+        T("Output queued for the most backed-up connection."));
+    metrics_append(pg, T("netmux_output_backlog_max_bytes %lld\n"),
+        (INT64)nOutputMax);
+
+    metrics_family(pg, T("netmux_input_backlog_bytes"), T("gauge"),
+        T("Input received but not yet run as commands."));
+    metrics_append(pg, T("netmux_input_backlog_bytes %lld\n"),
+        (INT64)nInput);
+
+    // Scheduler.
+    //
+    static const struct
+    {
+        int iPriority;
+        const UTF8 *pName;
+    } aPriorities[] =
+    {
+        { PRIORITY_SYSTEM,  T("system")  },
+        { PRIORITY_PLAYER,  T("player")  },
+        { PRIORITY_OBJECT,  T("object")  },
+        { PRIORITY_SUSPEND, T("suspend") }
+    };
+    metrics_family(pg, T("netmux_queue_tasks"), T("gauge"),
+        T("Scheduled tasks by priority, ready to run or waiting for their time."));
+    for (size_t i = 0; i < sizeof(aPriorities)/sizeof(aPriorities[0]); i++)
+    {
+        int nReady, nWaiting;
+        scheduler.CountTasks(aPriorities[i].iPriority, &nReady, &nWaiting);
+        metrics_append(pg, T("netmux_queue_tasks{priority=\"%s\",state=\"ready\"} %d\n"),
+            aPriorities[i].pName, nReady);
+        metrics_append(pg, T("netmux_queue_tasks{priority=\"%s\",state=\"waiting\"} %d\n"),
+            aPriorities[i].pName, nWaiting);
+    }
+
+#if !defined(MEMORY_BASED)
+    // Attribute cache and the hash file beneath it.
+    //
+    unsigned int nHashSize;
+    int nEntries, nMaxScan;
+    INT64 nDeletes, nScans, nHits, nChecks;
+    mudstate.acache_htab.GetStats(&nHashSize, &nEntries, &nDeletes, &nScans,
+        &nHits, &nChecks, &nMaxScan);
+
+    size_t nCacheBytes;
+    INT64 nEvictions;
+    cache_stats(&nCacheBytes, &nEvictions);
+
+    metrics_family(pg, T("netmux_attr_cache_hits_total"), T("counter"),
+        T("Attribute fetches answered from the cache."));
+    metrics_append(pg, T("netmux_attr_cache_hits_total %lld\n"), nHits);
+
+    metrics_family(pg, T("netmux_attr_cache_misses_total"), T("counter"),
+        T("Attribute fetches which went to the hash file."));
+    metrics_append(pg, T("netmux_attr_cache_misses_total %lld\n"), nScans - nHits);
+
+    metrics_family(pg, T("netmux_attr_cache_evictions_total"), T("counter"),
+        T("Attributes pushed out of the cache by max_cache_size."));
+    metrics_append(pg, T("netmux_attr_cache_evictions_total %lld\n"), nEvictions);
+
+    metrics_family(pg, T("netmux_attr_cache_bytes"), T("gauge"),
+        T("Bytes held by the attribute cache."));
+    metrics_append(pg, T("netmux_attr_cache_bytes %lld\n"), (INT64)nCacheBytes);
+
+    metrics_family(pg, T("netmux_hashfile_page_reads_total"), T("counter"),
+        T("Pages read from the attribute hash file."));
+    metrics_append(pg, T("netmux_hashfile_page_reads_total %d\n"), cs_dbreads);
+
+    metrics_family(pg, T("netmux_hashfile_page_writes_total"), T("counter"),
+        T("Pages written to the attribute hash file."));
+    metrics_append(pg, T("netmux_hashfile_page_writes_total %d\n"), cs_dbwrites);
+
+    metrics_family(pg, T("netmux_hashfile_syncs_total"), T("counter"),
+        T("Times the hash file cache was flushed to disk."));
+    metrics_append(pg, T("netmux_hashfile_syncs_total %d\n"), cs_syncs);
+#endif // MEMORY_BASED
+
+    // Buffer pools.
+    //
+    static const UTF8 *aPoolFamilies[4][3] =
+    {
+        { T("netmux_pool_buffers_in_use"),  T("gauge"),   T("Buffers currently allocated from each pool.") },
+        { T("netmux_pool_buffers_peak"),    T("gauge"),   T("Most buffers allocated from each pool at one time.") },
+        { T("netmux_pool_allocations_total"), T("counter"), T("Buffers handed out by each pool.") },
+        { T("netmux_pool_buffer_bytes"),    T("gauge"),   T("Size of the buffers in each pool.") }
+    };
+    for (int iFamily = 0; iFamily < 4; iFamily++)
+    {
+        metrics_family(pg, aPoolFamilies[iFamily][0], aPoolFamilies[iFamily][1],
+            aPoolFamilies[iFamily][2]);
+        for (int i = 0; i < NUM_POOLS; i++)
+        {
+            size_t nSize;
+            UINT64 nInUse, nMax, nTotal;
+            const UTF8 *pName = pool_stats(i, &nSize, &nInUse, &nMax, &nTotal);
+            INT64 aValues[4] = { (INT64)nInUse, (INT64)nMax, (INT64)nTotal, (INT64)nSize };
+            metrics_append(pg, T("%s{pool=\"%s\"} %lld\n"),
+                aPoolFamilies[iFamily][0], pName, aValues[iFamily]);
+        }
+    }
+
+    // Hash tables, as in @list hashstats.
+    //
+    static const struct
+    {
+        const UTF8 *pName;
+        CHashTable *pht;
+    } aTables[] =
+    {
+        { T("commands"),      &mudstate.command_htab    },
+        { T("logout_cmds"),   &mudstate.logout_cmd_htab },
+        { T("functions"),     &mudstate.func_htab       },
+        { T("flags"),         &mudstate.flags_htab      },
+        { T("powers"),        &mudstate.powers_htab     },
+        { T("attr_names"),    &mudstate.attr_name_htab  },
+        { T("vattr_names"),   &mudstate.vattr_name_htab },
+        { T("player_names"),  &mudstate.player_htab     },
+        { T("descriptors"),   &mudstate.desc_htab       },
+        { T("fwdlists"),      &mudstate.fwdlist_htab    },
+        { T("parents"),       &mudstate.parent_htab     },
+        { T("mail"),          &mudstate.mail_htab       },
+        { T("channels"),      &mudstate.channel_htab    },
+#if defined(MEMORY_BASED)
+        { T("attr_values"),   &mudstate.atr_value_htab  },
+#endif // MEMORY_BASED
+    };
+    static const UTF8 *aTableFamilies[3][3] =
+    {
+        { T("netmux_hash_entries"),       T("gauge"),   T("Entries in each internal hash table.") },
+        { T("netmux_hash_lookups_total"), T("counter"), T("Lookups in each internal hash table.") },
+        { T("netmux_hash_hits_total"),    T("counter"), T("Lookups which found an entry.") }
+    };
+    for (int iFamily = 0; iFamily < 3; iFamily++)
+    {
+        metrics_family(pg, aTableFamilies[iFamily][0], aTableFamilies[iFamily][1],
+            aTableFamilies[iFamily][2]);
+        for (size_t i = 0; i < sizeof(aTables)/sizeof(aTables[0]); i++)
+        {
+            unsigned int nTableSize;
+            int nTableEntries, nTableMaxScan;
+            INT64 nTableDeletes, nTableScans, nTableHits, nTableChecks;
+            aTables[i].pht->GetStats(&nTableSize, &nTableEntries,
+                &nTableDeletes, &nTableScans, &nTableHits, &nTableChecks,
+                &nTableMaxScan);
+            INT64 aValues[3] = { nTableEntries, nTableScans, nTableHits };
+            metrics_append(pg, T("%s{table=\"%s\"} %lld\n"),
+                aTableFamilies[iFamily][0], aTables[i].pName, aValues[iFamily]);
+        }
+    }
+
+    // Checkpoint dumps.
+    //
+    metrics_family(pg, T("netmux_dumps_total"), T("counter"),
+        T("Checkpoint dumps finished."));
+    metrics_append(pg, T("netmux_dumps_total %u\n"), mudstate.dump_count);
+
+    metrics_family(pg, T("netmux_dump_last_stall_seconds"), T("gauge"),
+        T("How long the last dump held up the game."));
+    metrics_append(pg, T("netmux_dump_last_stall_seconds %s\n"),
+        mudstate.dump_stall.ReturnSecondsString(3));
+
+    metrics_family(pg, T("netmux_dump_last_duration_seconds"), T("gauge"),
+        T("How long the last dump took to finish, including any forked child."));
+    metrics_append(pg, T("netmux_dump_last_duration_seconds %s\n"),
+        mudstate.dump_duration.ReturnSecondsString(3));
+
+#if defined(HAVE_WORKING_FORK)
+    metrics_family(pg, T("netmux_dump_in_progress"), T("gauge"),
+        T("Whether a forked dump is still running."));
+    metrics_append(pg, T("netmux_dump_in_progress %d\n"), mudstate.dumping ? 1 : 0);
+#endif // HAVE_WORKING_FORK
+
+#ifdef HAVE_GETRUSAGE
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    CLinearTimeDelta ltdCPU;
+    ltdCPU.SetTimeValueStruct(&usage.ru_utime);
+    CLinearTimeDelta ltdSys;
+    ltdSys.SetTimeValueStruct(&usage.ru_stime);
+    ltdCPU += ltdSys;
+
+    metrics_family(pg, T("process_cpu_seconds_total"), T("counter"),
+        T("User and system CPU time used by the server."));
+    metrics_append(pg, T("process_cpu_seconds_total %s\n"),
+        ltdCPU.ReturnSecondsString(3));
+#endif // HAVE_GETRUSAGE
+}
+
+static void metrics_close_client(int i)
+{
+    METRICS_CLIENT *mc = &aMetricsClients[i];
+    if (0 == SOCKET_CLOSE(mc->s))
+    {
+        DebugTotalSockets--;
+    }
+    if (NULL != mc->pResponse)
+    {
+        MEMFREE(mc->pResponse);
+    }
+
+    nMetricsClients--;
+    if (i != nMetricsClients)
+    {
+        *mc = aMetricsClients[nMetricsClients];
+    }
+}
+
+/*! \brief Answers a complete request.
+ *
+ * Only GET of / or /metrics returns the page.  Anything else gets a short
+ * error.
+ *
+ * \param mc       Client whose request has arrived.
+ * \return         None.
+ */
+
+static void metrics_respond(METRICS_CLIENT *mc)
+{
+    const char *pStatus;
+    METRICS_PAGE body = { NULL, 0, 0 };
+    if (  0 == strncmp(mc->aRequest, "GET / ", 6)
+       || 0 == strncmp(mc->aRequest, "GET /metrics ", 13)
+       || 0 == strncmp(mc->aRequest, "GET /metrics?", 13))
+    {
+        pStatus = "200 OK";
+        metrics_build(&body);
+    }
+    else if (0 == strncmp(mc->aRequest, "GET ", 4))
+    {
+        pStatus = "404 Not Found";
+        metrics_append(&body, T("Not found.\n"));
+    }
+    else
+    {
+        pStatus = "405 Method Not Allowed";
+        metrics_append(&body, T("Only GET is supported.\n"));
+    }
+
+    METRICS_PAGE page = { NULL, 0, 0 };
+    metrics_append(&page, T("HTTP/1.0 %s\r\n"
+        "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+        "Content-Length: %u\r\n"
+        "Connection: close\r\n\r\n"), pStatus, (unsigned int)body.n);
+    mc->pResponse = (char *)MEMALLOC(page.n + body.n);
+    ISOUTOFMEMORY(mc->pResponse);
+    memcpy(mc->pResponse, page.p, page.n);
+    memcpy(mc->pResponse + page.n, body.p, body.n);
+    mc->nResponse = page.n + body.n;
+    mc->nSent = 0;
+    MEMFREE(page.p);
+    MEMFREE(body.p);
+}
+
+static void metrics_open(void)
+{
+    if (  mudconf.metrics_port <= 0
+       || 65535 < mudconf.metrics_port)
+    {
+        return;
+    }
+
+    MUX_ADDRINFO hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_protocol = IPPROTO_TCP;
+    hints.ai_flags = AI_PASSIVE;
+
+    UTF8 sPort[20];
+    UTF8 *bufc = sPort;
+    safe_ltoa(mudconf.metrics_port, sPort, &bufc);
+    *bufc = '\0';
+
+    MUX_ADDRINFO *servinfo;
+    if (0 != mux_getaddrinfo(T("127.0.0.1"), sPort, &hints, &servinfo))
+    {
+        return;
+    }
+
+    SOCKET s;
+    if (make_socket(&s, servinfo))
+    {
+        if (FD_SETSIZE <= s)
+        {
+            if (0 == SOCKET_CLOSE(s))
+            {
+                DebugTotalSockets--;
+            }
+        }
+        else
+        {
+            make_nonblocking(s);
+            fcntl(s, F_SETFD, FD_CLOEXEC);
+            if (maxd <= s)
+            {
+                maxd = s + 1;
+            }
+            metrics_socket = s;
+            STARTLOG(LOG_ALWAYS, "NET", "METRC");
+            log_text(T("Serving metrics on 127.0.0.1 port "));
+            log_number(mudconf.metrics_port);
+            ENDLOG;
+        }
+    }
+    mux_freeaddrinfo(servinfo);
+}
+
+static void metrics_close(void)
+{
+    while (0 < nMetricsClients)
+    {
+        metrics_close_client(nMetricsClients - 1);
+    }
+    if (!IS_INVALID_SOCKET(metrics_socket))
+    {
+        if (0 == SOCKET_CLOSE(metrics_socket))
+        {
+            DebugTotalSockets--;
+        }
+        metrics_socket = INVALID_SOCKET;
+    }
+}
+
+static void metrics_select(fd_set *pInput, fd_set *pOutput,
+    CLinearTimeAbsolute *pltaWakeUp)
+{
+    if (IS_INVALID_SOCKET(metrics_socket))
+    {
+        return;
+    }
+
+    CLinearTimeAbsolute ltaNow;
+    ltaNow.GetUTC();
+
+    FD_SET(metrics_socket, pInput);
+    for (int i = 0; i < nMetricsClients; i++)
+    {
+        // Wake up in time to drop a client which never finishes.
+        //
+        CLinearTimeAbsolute ltaExpires = aMetricsClients[i].ltaAccepted + time_15s;
+        if (ltaExpires < ltaNow)
+        {
+            ltaExpires = ltaNow;
+        }
+        if (ltaExpires < *pltaWakeUp)
+        {
+            *pltaWakeUp = ltaExpires;
+        }
+
+        if (NULL == aMetricsClients[i].pResponse)
+        {
+            FD_SET(aMetricsClients[i].s, pInput);
+        }
+        else
+        {
+            FD_SET(aMetricsClients[i].s, pOutput);
+        }
+    }
+}
+
+/*! \brief Accepts, reads from, and writes to metrics connections.
+ *
+ * Nothing here blocks.  A connection which has not finished within fifteen
+ * seconds is dropped, and connections beyond METRICS_MAX_CLIENTS are
+ * closed as soon as they are accepted.
+ *
+ * \param pInput   Sockets select() found readable.
+ * \param pOutput  Sockets select() found writable.
+ * \return         None.
+ */
+
+static void metrics_service(fd_set *pInput, fd_set *pOutput)
+{
+    if (IS_INVALID_SOCKET(metrics_socket))
+    {
+        return;
+    }
+
+    CLinearTimeAbsolute ltaNow;
+    ltaNow.GetUTC();
+
+    if (FD_ISSET(metrics_socket, pInput))
+    {
+        SOCKET s = accept(metrics_socket, NULL, NULL);
+        if (!IS_INVALID_SOCKET(s))
+        {
+            DebugTotalSockets++;
+            if (  METRICS_MAX_CLIENTS <= nMetricsClients
+               || FD_SETSIZE <= s)
+            {
+                if (0 == SOCKET_CLOSE(s))
+                {
+                    DebugTotalSockets--;
+                }
+            }
+            else
+            {
+                make_nonblocking(s);
+                fcntl(s, F_SETFD, FD_CLOEXEC);
+                if (maxd <= s)
+                {
+                    maxd = s + 1;
+                }
+                METRICS_CLIENT *mc = &aMetricsClients[nMetricsClients++];
+                mc->s = s;
+                mc->ltaAccepted = ltaNow;
+                mc->nRequest = 0;
+                mc->pResponse = NULL;
+                mc->nResponse = 0;
+                mc->nSent = 0;
+            }
+        }
+    }
+
+    for (int i = nMetricsClients - 1; 0 <= i; i--)
+    {
+        METRICS_CLIENT *mc = &aMetricsClients[i];
+        if (  NULL == mc->pResponse
+           && FD_ISSET(mc->s, pInput))
+        {
+            int n = SOCKET_READ(mc->s, mc->aRequest + mc->nRequest,
+                sizeof(mc->aRequest) - 1 - mc->nRequest, 0);
+            if (n <= 0)
+            {
+                if (  0 == n
+                   || SOCKET_LAST_ERROR != SOCKET_EWOULDBLOCK)
+                {
+                    metrics_close_client(i);
+                }
+                continue;
+            }
+            mc->nRequest += n;
+            mc->aRequest[mc->nRequest] = '\0';
+
+            // The request line is all we look at, but waiting for the
+            // blank line keeps us from closing on a client still sending
+            // headers.
+            //
+            if (  NULL != strstr(mc->aRequest, "\r\n\r\n")
+               || NULL != strstr(mc->aRequest, "\n\n")
+               || sizeof(mc->aRequest) - 1 == mc->nRequest)
+            {
+                metrics_respond(mc);
+            }
+        }
+
+        if (  NULL != mc->pResponse
+           && (  FD_ISSET(mc->s, pOutput)
+              || 0 == mc->nSent))
+        {
+            int n = SOCKET_WRITE(mc->s, mc->pResponse + mc->nSent,
+                mc->nResponse - mc->nSent, 0);
+            if (0 < n)
+            {
+                mc->nSent += n;
+            }
+            if (  mc->nResponse == mc->nSent
+               || (  n < 0
+                  && SOCKET_LAST_ERROR != SOCKET_EWOULDBLOCK))
+            {
+                metrics_close_client(i);
+                continue;
+            }
+        }
+
+        if (mc->ltaAccepted + time_15s <= ltaNow)
+        {
+            metrics_close_client(i);
+        }
+    }
+}
+
+#define CheckInput(x)     FD_ISSET(x, &input_set)
+#define CheckOutput(x)    FD_ISSET(x, &output_set)
+
+void shovechars(int nPorts, PortInfo aPorts[])
+{
+    fd_set input_set, output_set;
+    int found;
+    DESC *d, *dnext, *newd;
+    unsigned int avail_descriptors;
+    int maxfds;
+    int i;
+
+    mudstate.debug_cmd = T("< shovechars_select >");
+
+    CLinearTimeAbsolute ltaLastSlice;
+    ltaLastSlice.GetUTC();
+
+#ifdef HAVE_GETDTABLESIZE
+    maxfds = getdtablesize();
+#else // HAVE_GETDTABLESIZE
+    maxfds = sysconf(_SC_OPEN_MAX);
+#endif // HAVE_GETDTABLESIZE
+
+    avail_descriptors = maxfds - 7;
+
+#if defined(UNIX_NETWORKING_THREADS)
+    start_io_threads();
+#endif // UNIX_NETWORKING_THREADS
+    metrics_open();
+
+    while (!mudstate.shutdown_flag)
+    {
+        CLinearTimeAbsolute ltaCurrent;
+        ltaCurrent.GetUTC();
+        update_quotas(ltaLastSlice, ltaCurrent);
+
+        // Check the scheduler.
+        //
+        scheduler.RunTasks(ltaCurrent);
+        CLinearTimeAbsolute ltaWakeUp;
+        if (scheduler.WhenNext(&ltaWakeUp))
+        {
+            if (ltaWakeUp < ltaCurrent)
+            {
+                ltaWakeUp = ltaCurrent;
+            }
+        }
+        else
+        {
+            CLinearTimeDelta ltd = time_30m;
+            ltaWakeUp = ltaCurrent + ltd;
+        }
+
+        if (mudstate.shutdown_flag)
+        {
+            break;
+        }
+
+        FD_ZERO(&input_set);
+        FD_ZERO(&output_set);
+
+#if defined(HAVE_WORKING_FORK) && defined(STUB_SLAVE)
+        // Listen for replies from the stubslave socket.
+        //
+        if (!IS_INVALID_SOCKET(stubslave_socket))
+        {
+            // The socket is read even with rings, since that is how we
+            // learn that stubslave has gone away.
+            //
+            FD_SET(stubslave_socket, &input_set);
+            int fdRing = Pipe_GetRingHandle();
+            if (0 <= fdRing)
+            {
+                // Queued frames go straight into the ring.  If it is full,
+                // the stubslave wakes us when it has made room.
+                //
+                Pipe_WriteRing(&Queue_Out);
+                FD_SET(fdRing, &input_set);
+            }
+            else if (0 < Pipe_QueueLength(&Queue_Out))
+            {
+                FD_SET(stubslave_socket, &output_set);
+            }
+        }
+#endif // HAVE_WORKING_FORK && STUB_SLAVE
+
+        // Listen for new connections if there are free descriptors.
+        //
+        if (ndescriptors < avail_descriptors)
+        {
+            for (i = 0; i < nPorts; i++)
+            {
+                FD_SET(aPorts[i].socket, &input_set);
+            }
+        }
+
+#if defined(HAVE_WORKING_FORK)
+        // Listen for replies from the slave socket.
+        //
+        if (!IS_INVALID_SOCKET(slave_socket))
+        {
+            FD_SET(slave_socket, &input_set);
+        }
+#endif // HAVE_WORKING_FORK
+
+#if defined(UNIX_NETWORKING_THREADS)
+        // Hear from the I/O threads, and let them know about new output.
+        //
+        if (0 < nIoThreads)
+        {
+            FD_SET(fdMainWake[0], &input_set);
+            io_flush();
+        }
+#endif // UNIX_NETWORKING_THREADS
+
+        metrics_select(&input_set, &output_set, &ltaWakeUp);
+
+        // Mark sockets that we want to test for change in status.
+        //
+        DESC_ITER_ALL(d)
+        {
+#if defined(UNIX_NETWORKING_THREADS)
+            if (0 <= d->io_thread)
+            {
+                continue;
+            }
+#endif // UNIX_NETWORKING_THREADS
+            if (!d->input_head)
+            {
+                FD_SET(d->descriptor, &input_set);
+            }
+            if (d->output_head)
+            {
+                FD_SET(d->descriptor, &output_set);
+            }
+        }
+
+        // Wait for something to happen.
+        //
+        struct timeval timeout;
+        CLinearTimeDelta ltdTimeout = ltaWakeUp - ltaCurrent;
+        ltdTimeout.ReturnTimeValueStruct(&timeout);
+        found = select(maxd, &input_set, &output_set, (fd_set *) NULL,
+                   &timeout);
+
+        if (IS_SOCKET_ERROR(found))
+        {
+            int iSocketError = SOCKET_LAST_ERROR;
+            if (iSocketError == SOCKET_EBADF)
+            {
+                // This one is bad, as it results in a spiral of
+                // doom, unless we can figure out what the bad file
+                // descriptor is and get rid of it.
+                //
+                log_perror(T("NET"), T("FAIL"), T("checking for activity"), T("select"));
 
                 // Search for a bad socket amoungst the players.
                 //
@@ -1610,6 +2996,13 @@ void shovechars(int nPorts, PortInfo aPorts[])
         //
         if (!IS_INVALID_SOCKET(stubslave_socket))
         {
+            int fdRing = Pipe_GetRingHandle();
+            if (  0 <= fdRing
+               && CheckInput(fdRing))
+            {
+                Pipe_ReadRing(&Queue_In);
+            }
+
             if (CheckInput(stubslave_socket))
             {
                 while (0 == StubSlaveRead())
@@ -1618,11 +3011,18 @@ void shovechars(int nPorts, PortInfo aPorts[])
                 }
             }
 
-            Pipe_DecodeFrames(CHANNEL_INVALID, &Queue_Out);
+            // Frames are assembled apart from Queue_Out.  A frame which
+            // arrives in pieces must not be sent back to stubslave.
+            //
+            Pipe_DecodeFrames(CHANNEL_INVALID, &Queue_Frame);
 
             if (!IS_INVALID_SOCKET(stubslave_socket))
             {
-                if (CheckOutput(stubslave_socket))
+                if (0 <= fdRing)
+                {
+                    Pipe_WriteRing(&Queue_Out);
+                }
+                else if (CheckOutput(stubslave_socket))
                 {
                     StubSlaveWrite();
                 }
@@ -1654,28 +3054,41 @@ void shovechars(int nPorts, PortInfo aPorts[])
                 }
             }
         }
+        metrics_service(&input_set, &output_set);
+
+#if defined(UNIX_NETWORKING_THREADS)
+        // Take lines and disconnects from the I/O threads.
+        //
+        if (0 < nIoThreads)
+        {
+            if (CheckInput(fdMainWake[0]))
+            {
+                io_drain_pipe(fdMainWake[0]);
+            }
+            bMainWakePending = 0;
+            __sync_synchronize();
+            io_drain();
+        }
+#endif // UNIX_NETWORKING_THREADS
 
         // Check for activity on user sockets.
         //
         DESC_SAFEITER_ALL(d, dnext)
         {
+#if defined(UNIX_NETWORKING_THREADS)
+            if (0 <= d->io_thread)
+            {
+                continue;
+            }
+#endif // UNIX_NETWORKING_THREADS
+
             // Process input from sockets with pending input.
             //
             if (CheckInput(d->descriptor))
             {
                 // Undo autodark
                 //
-                if (d->flags & DS_AUTODARK)
-                {
-                    // Clear the DS_AUTODARK on every related session.
-                    //
-                    DESC *d1;
-                    DESC_ITER_PLAYER(d->player, d1)
-                    {
-                        d1->flags &= ~DS_AUTODARK;
-                    }
-                    db[d->player].fs.word[FLAG_WORD1] &= ~DARK;
-                }
+                undo_autodark(d);
 
                 // Process received data.
                 //
@@ -1694,6 +3107,11 @@ void shovechars(int nPorts, PortInfo aPorts[])
             }
         }
     }
+    metrics_close();
+
+#if defined(UNIX_NETWORKING_THREADS)
+    stop_io_threads();
+#endif // UNIX_NETWORKING_THREADS
 }
 
 #endif // UNIX_NETWORKING_SELECT
@@ -1715,10 +3133,18 @@ extern "C" MUX_RESULT DCL_API pipepump(void)
     FD_ZERO(&input_set);
     FD_ZERO(&output_set);
 
-    // Listen for replies from the stubslave socket.
+    // Listen for replies from the stubslave socket.  As in shovechars(), the
+    // socket is read even with rings so that we notice when stubslave dies
+    // instead of waiting on the ring forever.
     //
     FD_SET(stubslave_socket, &input_set);
-    if (0 < Pipe_QueueLength(&Queue_Out))
+    int fdRing = Pipe_GetRingHandle();
+    if (0 <= fdRing)
+    {
+        Pipe_WriteRing(&Queue_Out);
+        FD_SET(fdRing, &input_set);
+    }
+    else if (0 < Pipe_QueueLength(&Queue_Out))
     {
         FD_SET(stubslave_socket, &output_set);
     }
@@ -1752,21 +3178,30 @@ extern "C" MUX_RESULT DCL_API pipepump(void)
 
     // Get data from from stubslave.
     //
+    if (  0 <= fdRing
+       && CheckInput(fdRing))
+    {
+        Pipe_ReadRing(&Queue_In);
+    }
+
     if (CheckInput(stubslave_socket))
     {
         while (0 == StubSlaveRead())
         {
             ; // Nothing.
         }
-    }
 
-    if (!IS_INVALID_SOCKET(stubslave_socket))
-    {
-        if (CheckOutput(stubslave_socket))
+        if (IS_INVALID_SOCKET(stubslave_socket))
         {
-            StubSlaveWrite();
+            return MUX_E_FAIL;
         }
     }
+
+    if (  fdRing < 0
+       && CheckOutput(stubslave_socket))
+    {
+        StubSlaveWrite();
+    }
     return MUX_S_OK;
 }
 #endif // HAVE_WORKINGFORK && STUB_SLAVE
@@ -1897,6 +3332,10 @@ DESC *new_connection(PortInfo *Port, int *piSocketError)
 
         TelnetSetup(d);
 
+#if defined(UNIX_NETWORKING_THREADS)
+        io_attach(d);
+#endif // UNIX_NETWORKING_THREADS
+
         // Initalize everything before sending the sitemon info, so that we
         // can pass the descriptor, d.
         //
@@ -2128,9 +3567,18 @@ void shutdownsock(DESC *d, int reason)
         d->doing[0] = '\0';
         d->quota = mudconf.cmd_quota_max;
         d->last_time = d->connected_at;
+#if defined(UNIX_NETWORKING_THREADS)
+        bool bLocked = lock_descriptor(d);
+#endif // UNIX_NETWORKING_THREADS
         d->input_tot = d->input_size;
         d->output_tot = 0;
-        d->encoding = d->negotiated_encoding;
+        SetDescriptorEncoding(d, d->negotiated_encoding);
+#if defined(UNIX_NETWORKING_THREADS)
+        if (bLocked)
+        {
+            unlock_descriptor(d);
+        }
+#endif // UNIX_NETWORKING_THREADS
 
         welcome_user(d);
     }
@@ -2174,6 +3622,10 @@ void shutdownsock(DESC *d, int reason)
     }
 #elif defined(UNIX_NETWORKING)
 
+#if defined(UNIX_NETWORKING_THREADS)
+        io_detach(d);
+#endif // UNIX_NETWORKING_THREADS
+
 #ifdef UNIX_SSL
         if (d->ssl_session)
         {
@@ -2204,7 +3656,18 @@ void shutdownsock(DESC *d, int reason)
         // If we don't have queued IOs, then we can free these, now.
         //
         freeqs(d);
-        free_desc(d);
+#if defined(UNIX_NETWORKING_THREADS)
+        if (0 < d->io_pending)
+        {
+            // The last message still naming this descriptor frees it.
+            //
+            d->io_thread = IO_DEFUNCT;
+        }
+        else
+#endif // UNIX_NETWORKING_THREADS
+        {
+            free_desc(d);
+        }
         ndescriptors--;
     }
 #endif // WINDOWS_NETWORKING
@@ -2384,17 +3847,11 @@ DESC *initializesock(SOCKET s, MUX_SOCKADDR *msa)
     d->raw_input = NULL;
     d->raw_input_at = NULL;
     d->nOption = 0;
+    d->aOption = NULL;
     d->raw_input_state = NVT_IS_NORMAL;
     d->raw_codepoint_state = CL_PRINT_START_STATE;
     d->raw_codepoint_length = 0;
-    for (int i = 0; i < 256; i++)
-    {
-        d->nvt_him_state[i] = OPTION_NO;
-    }
-    for (int i = 0; i < 256; i++)
-    {
-        d->nvt_us_state[i] = OPTION_NO;
-    }
+    InitOptionState(d);
     d->ttype = NULL;
     d->encoding = mudconf.default_charset;
     d->negotiated_encoding = mudconf.default_charset;
@@ -2402,6 +3859,12 @@ DESC *initializesock(SOCKET s, MUX_SOCKADDR *msa)
     d->width = 78;
     d->quota = mudconf.cmd_quota_max;
     d->program_data = NULL;
+#if defined(UNIX_NETWORKING_THREADS)
+    d->io_thread = -1;
+    d->io_slot = -1;
+    d->io_state = IO_OPEN;
+    d->io_pending = 0;
+#endif // UNIX_NETWORKING_THREADS
     d->address = *msa;
     msa->ntop(d->addr, sizeof(d->addr));
 
@@ -2439,6 +3902,37 @@ DESC *initializesock(SOCKET s, MUX_SOCKADDR *msa)
     return d;
 }
 
+/*! \brief Change the character set used on a connection.
+ *
+ * \param d          Player connection.
+ * \param iEncoding  One of the CHARSET_* values.
+ * \return           None.
+ */
+
+void SetDescriptorEncoding(DESC *d, int iEncoding)
+{
+#if defined(UNIX_NETWORKING_THREADS)
+    bool bLocked = lock_descriptor(d);
+#endif // UNIX_NETWORKING_THREADS
+
+    if (  CHARSET_UTF8 == iEncoding
+       && CHARSET_UTF8 != d->encoding)
+    {
+        // Since we are changing to the UTF-8 character set, the printable
+        // state machine needs to be initialized.
+        //
+        d->raw_codepoint_state = CL_PRINT_START_STATE;
+    }
+    d->encoding = iEncoding;
+
+#if defined(UNIX_NETWORKING_THREADS)
+    if (bLocked)
+    {
+        unlock_descriptor(d);
+    }
+#endif // UNIX_NETWORKING_THREADS
+}
+
 #if defined(WINDOWS_NETWORKING)
 
 /*! \brief Service network request for more output to a specific descriptor.
@@ -2570,26 +4064,16 @@ void process_output(void *dvoid, int bHandleShutdown)
 
 #elif defined(UNIX_NETWORKING)
 
-/*! \brief Service network request for more output to a specific descriptor.
+/*! \brief Write as much of the output queue as the socket will take.
  *
- * This function is called when the network wants to consume more data, but it
- * must also be called to kick-start output to the network, so truthfully, the
- * call can come from shovechars or the output routines.  Currently, this is
- * not being called by the task queue, but it is in a form that is callable by
- * the task queue.
+ * With threaded network I/O, the caller holds the descriptor's lock.
  *
- * \param dvoid             Network descriptor state.
- * \param bHandleShutdown   Whether the shutdownsock() call is being handled..
- * \return                  None.
+ * \param d                 Network descriptor state.
+ * \return                  false if the connection has failed.
  */
 
-void process_output(void *dvoid, int bHandleShutdown)
+static bool write_output(DESC *d)
 {
-    DESC *d = (DESC *)dvoid;
-
-    const UTF8 *cmdsave = mudstate.debug_cmd;
-    mudstate.debug_cmd = T("< process_output >");
-
     TBLOCK *tb = d->output_head;
     while (NULL != tb)
     {
@@ -2611,7 +4095,6 @@ void process_output(void *dvoid, int bHandleShutdown)
 #else
                 int iSocketError = SOCKET_LAST_ERROR;
 #endif
-                mudstate.debug_cmd = cmdsave;
 
                 if (  SOCKET_EWOULDBLOCK   == iSocketError
 #ifdef SOCKET_EAGAIN
@@ -2628,12 +4111,9 @@ void process_output(void *dvoid, int bHandleShutdown)
                     // the exactly same buffer.
                     //
                     tb->hdr.flags |= TBLK_FLAG_LOCKED;
+                    return true;
                 }
-                else if (bHandleShutdown)
-                {
-                    shutdownsock(d, R_SOCKDIED);
-                }
-                return;
+                return false;
             }
             d->output_size -= cnt;
             tb->hdr.nchars -= cnt;
@@ -2649,8 +4129,46 @@ void process_output(void *dvoid, int bHandleShutdown)
             d->output_tail = NULL;
         }
     }
+    return true;
+}
+
+/*! \brief Service network request for more output to a specific descriptor.
+ *
+ * This function is called when the network wants to consume more data, but it
+ * must also be called to kick-start output to the network, so truthfully, the
+ * call can come from shovechars or the output routines.  Currently, this is
+ * not being called by the task queue, but it is in a form that is callable by
+ * the task queue.
+ *
+ * \param dvoid             Network descriptor state.
+ * \param bHandleShutdown   Whether the shutdownsock() call is being handled..
+ * \return                  None.
+ */
+
+void process_output(void *dvoid, int bHandleShutdown)
+{
+    DESC *d = (DESC *)dvoid;
+
+    const UTF8 *cmdsave = mudstate.debug_cmd;
+    mudstate.debug_cmd = T("< process_output >");
+
+#if defined(UNIX_NETWORKING_THREADS)
+    bool bLocked = lock_descriptor(d);
+    bool bWritten = write_output(d);
+    if (bLocked)
+    {
+        unlock_descriptor(d);
+    }
+#else // UNIX_NETWORKING_THREADS
+    bool bWritten = write_output(d);
+#endif // UNIX_NETWORKING_THREADS
 
     mudstate.debug_cmd = cmdsave;
+    if (  !bWritten
+       && bHandleShutdown)
+    {
+        shutdownsock(d, R_SOCKDIED);
+    }
 }
 
 #endif // UNIX_NETWORKING
@@ -2862,6 +4380,93 @@ static void SendWont(DESC *d, unsigned char chOption)
     queue_write_LEN(d, aWont, sizeof(aWont));
 }
 
+/*! \brief Find the negotiation state kept for a telnet option.
+ *
+ * Only options which are not OPTION_NO on both sides are kept.
+ *
+ * \param d        Player connection context.
+ * \param chOption Telnet Option
+ * \return         The slot for the option, or NULL.
+ */
+
+static NVT_OPTION_STATE *FindOptionState(DESC *d, unsigned char chOption)
+{
+    for (int i = 0; i < d->nvt_nstate; i++)
+    {
+        if (chOption == d->nvt_state[i].option)
+        {
+            return d->nvt_state + i;
+        }
+    }
+    return NULL;
+}
+
+/*! \brief Record both sides' negotiation state for a telnet option.
+ *
+ * A slot is taken when either side leaves OPTION_NO and given back when
+ * both return to it. If every slot is in use, the option stays OPTION_NO,
+ * which is the same as refusing it.
+ *
+ * \param d         Player connection context.
+ * \param chOption  Telnet Option
+ * \param iHimState Other side's state.
+ * \param iUsState  Our side's state.
+ * \return          None.
+ */
+
+static void StoreOptionState(DESC *d, unsigned char chOption, int iHimState, int iUsState)
+{
+    NVT_OPTION_STATE *pos = FindOptionState(d, chOption);
+    if (  OPTION_NO == iHimState
+       && OPTION_NO == iUsState)
+    {
+        if (NULL != pos)
+        {
+            *pos = d->nvt_state[--d->nvt_nstate];
+        }
+        return;
+    }
+
+    if (NULL == pos)
+    {
+        if (NVT_OPTION_SLOTS <= d->nvt_nstate)
+        {
+            return;
+        }
+        pos = d->nvt_state + d->nvt_nstate++;
+        pos->option = chOption;
+    }
+    pos->him = static_cast<unsigned char>(iHimState);
+    pos->us  = static_cast<unsigned char>(iUsState);
+}
+
+/*! \brief Put every telnet option back in the OPTION_NO state.
+ *
+ * \param d        Player connection context.
+ * \return         None.
+ */
+
+void InitOptionState(DESC *d)
+{
+    d->nvt_nstate = 0;
+}
+
+/*! \brief Set the negotiation state of an option without acting on it.
+ *
+ * Used when reloading connections across a @restart.
+ *
+ * \param d         Player connection context.
+ * \param chOption  Telnet Option
+ * \param iHimState Other side's state.
+ * \param iUsState  Our side's state.
+ * \return          None.
+ */
+
+void RestoreOptionState(DESC *d, unsigned char chOption, int iHimState, int iUsState)
+{
+    StoreOptionState(d, chOption, iHimState, iUsState);
+}
+
 /*! \brief Return the other side's negotiation state.
  *
  * The negotiation of each optional feature of telnet can be in one of six
@@ -2878,7 +4483,8 @@ static void SendWont(DESC *d, unsigned char chOption)
 
 int HimState(DESC *d, unsigned char chOption)
 {
-    return d->nvt_him_state[chOption];
+    NVT_OPTION_STATE *pos = FindOptionState(d, chOption);
+    return (NULL == pos) ? OPTION_NO : pos->him;
 }
 
 /*! \brief Return our side's negotiation state.
@@ -2897,14 +4503,15 @@ int HimState(DESC *d, unsigned char chOption)
 
 int UsState(DESC *d, unsigned char chOption)
 {
-    return d->nvt_us_state[chOption];
+    NVT_OPTION_STATE *pos = FindOptionState(d, chOption);
+    return (NULL == pos) ? OPTION_NO : pos->us;
 }
 
 void SendCharsetRequest(DESC *d, bool fDefacto = false)
 {
-    if (  OPTION_YES == d->nvt_us_state[(unsigned char)TELNET_CHARSET]
+    if (  OPTION_YES == UsState(d, (unsigned char)TELNET_CHARSET)
        || (  fDefacto
-          && OPTION_YES == d->nvt_him_state[(unsigned char)TELNET_CHARSET]))
+          && OPTION_YES == HimState(d, (unsigned char)TELNET_CHARSET)))
     {
         unsigned char aCharsets[] = ";UTF-8;ISO-8859-1;ISO-8859-2;US-ASCII;CP437";
         SendSb(d, TELNET_CHARSET, TELNETSB_REQUEST, aCharsets, sizeof(aCharsets)-1);
@@ -2914,8 +4521,8 @@ void SendCharsetRequest(DESC *d, bool fDefacto = false)
 void DefactoCharsetCheck(DESC *d)
 {
     if (  NULL != d->ttype
-       && OPTION_NO == d->nvt_us_state[(unsigned char)TELNET_CHARSET]
-       && OPTION_YES == d->nvt_him_state[(unsigned char)TELNET_CHARSET]
+       && OPTION_NO == UsState(d, (unsigned char)TELNET_CHARSET)
+       && OPTION_YES == HimState(d, (unsigned char)TELNET_CHARSET)
        && mux_stricmp(d->ttype, T("mushclient")) == 0)
     {
         SendCharsetRequest(d, true);
@@ -2932,7 +4539,7 @@ void DefactoCharsetCheck(DESC *d)
 
 static void SetHimState(DESC *d, unsigned char chOption, int iHimState)
 {
-    d->nvt_him_state[chOption] = iHimState;
+    StoreOptionState(d, chOption, iHimState, UsState(d, chOption));
 
     if (OPTION_YES == iHimState)
     {
@@ -2979,7 +4586,7 @@ static void SetHimState(DESC *d, unsigned char chOption, int iHimState)
 
 static void SetUsState(DESC *d, unsigned char chOption, int iUsState)
 {
-    d->nvt_us_state[chOption] = iUsState;
+    StoreOptionState(d, chOption, HimState(d, chOption), iUsState);
 
     if (OPTION_YES == iUsState)
     {
@@ -3211,6 +4818,103 @@ void TelnetSetup(DESC *d)
 #endif
 }
 
+/*! \brief Allocate the buffer for a partly-received line.
+ *
+ * \param d        Player connection on which the input arrived.
+ * \param pp       Set to where the next byte of the line goes.
+ * \param ppend    Set to the end of the buffer.
+ * \return         None.
+ */
+
+static void start_raw_input(DESC *d, UTF8 **pp, UTF8 **ppend)
+{
+#if defined(UNIX_NETWORKING_THREADS)
+    // The buffer pools are not thread-safe, so an I/O thread uses the heap.
+    //
+    if (0 <= d->io_thread)
+    {
+        d->raw_input = (CBLK *)MEMALLOC(LBUF_SIZE);
+        ISOUTOFMEMORY(d->raw_input);
+    }
+    else
+#endif // UNIX_NETWORKING_THREADS
+    {
+        d->raw_input = (CBLK *) alloc_lbuf_keep("process_input.raw");
+    }
+    d->raw_input_at = d->raw_input->cmd;
+    *pp    = d->raw_input->cmd;
+    *ppend = d->raw_input->cmd + (LBUF_SIZE - sizeof(CBLKHDR) - 1);
+}
+
+/*! \brief Release the partly-received line and subnegotiation buffers.
+ *
+ * \param d        Player connection.
+ * \param bLine    Whether to release the line buffer.
+ * \param bOption  Whether to release the subnegotiation buffer.
+ * \return         None.
+ */
+
+static void free_raw_input(DESC *d, bool bLine, bool bOption)
+{
+#if defined(UNIX_NETWORKING_THREADS)
+    bool bHeap = (0 <= d->io_thread);
+#endif // UNIX_NETWORKING_THREADS
+    if (  bLine
+       && NULL != d->raw_input)
+    {
+#if defined(UNIX_NETWORKING_THREADS)
+        if (bHeap)
+        {
+            MEMFREE(d->raw_input);
+        }
+        else
+#endif // UNIX_NETWORKING_THREADS
+        {
+            free_lbuf(d->raw_input);
+        }
+        d->raw_input = NULL;
+        d->raw_input_at = NULL;
+    }
+
+    if (  bOption
+       && NULL != d->aOption)
+    {
+#if defined(UNIX_NETWORKING_THREADS)
+        if (bHeap)
+        {
+            MEMFREE(d->aOption);
+        }
+        else
+#endif // UNIX_NETWORKING_THREADS
+        {
+            free_sbuf(d->aOption);
+        }
+        d->aOption = NULL;
+    }
+}
+
+/*! \brief Queue a short ASCII reply to something received from the client.
+ *
+ * An I/O thread cannot use queue_string(), and these strings need none of
+ * its color or character set conversions there.
+ *
+ * \param d        Player connection.
+ * \param s        Reply.
+ * \return         None.
+ */
+
+static void queue_nvt_string(DESC *d, const UTF8 *s)
+{
+#if defined(UNIX_NETWORKING_THREADS)
+    if (on_io_thread())
+    {
+        queue_write(d, (const char *)s);
+        return;
+    }
+#endif // UNIX_NETWORKING_THREADS
+    queue_string(d, s);
+}
+
 /*! \brief Parse raw data from network connection into command lines and
  * Telnet indications.
  *
@@ -3241,24 +4945,72 @@ static void process_input_helper(DESC *d, char *pBytes, int nBytes)
     const size_t nCp437 = sizeof(szCp437) - 1;
     const size_t nUSASCII = sizeof(szUSASCII) - 1;
 
-    if (!d->raw_input)
-    {
-        d->raw_input = (CBLK *) alloc_lbuf("process_input.raw");
-        d->raw_input_at = d->raw_input->cmd;
-    }
-
     size_t nInputBytes = 0;
     size_t nLostBytes  = 0;
 
-    UTF8 *p    = d->raw_input_at;
-    UTF8 *pend = d->raw_input->cmd + (LBUF_SIZE - sizeof(CBLKHDR) - 1);
+    // The line buffer is allocated when the first byte of a line arrives,
+    // and the subnegotiation buffer when IAC SB does.
+    //
+    UTF8 *p    = NULL;
+    UTF8 *pend = NULL;
+    if (d->raw_input)
+    {
+        p    = d->raw_input_at;
+        pend = d->raw_input->cmd + (LBUF_SIZE - sizeof(CBLKHDR) - 1);
+    }
 
-    unsigned char *q    = d->aOption + d->nOption;
-    unsigned char *qend = d->aOption + SBUF_SIZE - 1;
+    unsigned char *q    = NULL;
+    unsigned char *qend = NULL;
+    if (d->aOption)
+    {
+        q    = d->aOption + d->nOption;
+        qend = d->aOption + SBUF_SIZE - 1;
+    }
 
     int n = nBytes;
     while (n--)
     {
+        if (  NVT_IS_NORMAL == d->raw_input_state
+           && (  CHARSET_UTF8 != d->encoding
+              || CL_PRINT_START_STATE == d->raw_codepoint_state))
+        {
+            // Copy any run of printable ASCII directly, leaving the state
+            // machines for IAC, CR, LF, BS, DEL, other controls and
+            // non-ASCII bytes.
+            //
+            size_t nRun = utf8_printable_span((const UTF8 *)pBytes, n + 1);
+            if (  0 < nRun
+               && NULL == d->raw_input)
+            {
+                start_raw_input(d, &p, &pend);
+            }
+
+            // The Latin-1, Latin-2 and CP437 translations below never use
+            // the last byte before pend, so neither does this.
+            //
+            size_t nRoom = pend - p;
+            if (  CHARSET_UTF8 != d->encoding
+               && CHARSET_ASCII != d->encoding
+               && 0 < nRoom)
+            {
+                nRoom--;
+            }
+
+            if (nRoom < nRun)
+            {
+                nRun = nRoom;
+            }
+            if (0 < nRun)
+            {
+                memcpy(p, pBytes, nRun);
+                p += nRun;
+                pBytes += nRun;
+                nInputBytes += nRun;
+                n -= static_cast<int>(nRun - 1);
+                continue;
+            }
+        }
+
         unsigned char ch = (unsigned char)*pBytes;
         int iAction = nvt_input_action_table[d->raw_input_state][nvt_input_xlat_table[ch]];
         switch (iAction)
@@ -3266,6 +5018,11 @@ static void process_input_helper(DESC *d, char *pBytes, int nBytes)
         case 1:
             // Action 1 - Accept CHR(X).
             //
+            if (NULL == d->raw_input)
+            {
+                start_raw_input(d, &p, &pend);
+            }
+
             if (CHARSET_UTF8 == d->encoding)
             {
                 // Execute UTF-8 state machine.
@@ -3463,16 +5220,17 @@ static void process_input_helper(DESC *d, char *pBytes, int nBytes)
 
             if (NVT_DEL == ch)
             {
-                queue_string(d, T("\b \b"));
+                queue_nvt_string(d, T("\b \b"));
             }
             else
             {
-                queue_string(d, T(" \b"));
+                queue_nvt_string(d, T(" \b"));
             }
 
             // Rewind until we pass the first byte of a UTF-8 sequence.
             //
-            while (d->raw_input->cmd < p)
+            while (  NULL != d->raw_input
+                  && d->raw_input->cmd < p)
             {
                 nInputBytes--;
                 p--;
@@ -3499,14 +5257,28 @@ static void process_input_helper(DESC *d, char *pBytes, int nBytes)
                 d->raw_codepoint_state = CL_PRINT_START_STATE;
             }
 
-            *p = '\0';
-            if (d->raw_input->cmd < p)
+            if (  NULL != d->raw_input
+               && d->raw_input->cmd < p)
             {
-                save_command(d, d->raw_input);
-                d->raw_input = (CBLK *) alloc_lbuf("process_input.raw");
-
-                p = d->raw_input_at = d->raw_input->cmd;
-                pend = d->raw_input->cmd + (LBUF_SIZE - sizeof(CBLKHDR) - 1);
+#if defined(UNIX_NETWORKING_THREADS)
+                if (0 <= d->io_thread)
+                {
+                    // Pass a copy of the line to the main thread, and keep
+                    // the buffer for the next one.
+                    //
+                    io_post(IOM_LINE, d, NULL, d->raw_input->cmd, p - d->raw_input->cmd);
+                    d->io_state = IO_THROTTLED;
+                    p = d->raw_input->cmd;
+                }
+                else
+#endif // UNIX_NETWORKING_THREADS
+                {
+                    *p = '\0';
+                    save_command(d, d->raw_input);
+                    d->raw_input = NULL;
+                    d->raw_input_at = NULL;
+                    p = pend = NULL;
+                }
             }
             break;
 
@@ -3549,7 +5321,22 @@ static void process_input_helper(DESC *d, char *pBytes, int nBytes)
         case 10:
             // Action 10 - Transition to the Have_IAC_SB state.
             //
-            q = d->aOption;
+            if (NULL == d->aOption)
+            {
+#if defined(UNIX_NETWORKING_THREADS)
+                if (0 <= d->io_thread)
+                {
+                    d->aOption = (unsigned char *)MEMALLOC(SBUF_SIZE);
+                    ISOUTOFMEMORY(d->aOption);
+                }
+                else
+#endif // UNIX_NETWORKING_THREADS
+                {
+                    d->aOption = (unsigned char *)alloc_sbuf_keep("process_input.sb");
+                }
+            }
+            q    = d->aOption;
+            qend = d->aOption + SBUF_SIZE - 1;
             d->raw_input_state = NVT_IS_HAVE_IAC_SB;
             break;
 
@@ -3562,7 +5349,7 @@ static void process_input_helper(DESC *d, char *pBytes, int nBytes)
         case 12:
             // Action 12 - Respond to IAC AYT and return to the Normal state.
             //
-            queue_string(d, T("\r\n[Yes]\r\n"));
+            queue_nvt_string(d, T("\r\n[Yes]\r\n"));
             d->raw_input_state = NVT_IS_NORMAL;
             break;
 
@@ -3744,7 +5531,19 @@ static void process_input_helper(DESC *d, char *pBytes, int nBytes)
                         {
                             if (NULL != d->ttype)
                             {
-                                MEMFREE(d->ttype);
+#if defined(UNIX_NETWORKING_THREADS)
+                                // The main thread may be reading the old
+                                // terminal type, so it frees it.
+                                //
+                                if (0 <= d->io_thread)
+                                {
+                                    io_post(IOM_FREE, d, d->ttype, NULL, 0);
+                                }
+                                else
+#endif // UNIX_NETWORKING_THREADS
+                                {
+                                    MEMFREE(d->ttype);
+                                }
                                 d->ttype = NULL;
                             }
                             d->ttype = (UTF8 *)MEMALLOC(nTermType+1);
@@ -4076,25 +5875,34 @@ static void process_input_helper(DESC *d, char *pBytes, int nBytes)
         pBytes++;
     }
 
-    if (  d->raw_input->cmd < p
+    if (  NULL != d->raw_input
+       && d->raw_input->cmd < p
        && p <= pend)
     {
         d->raw_input_at = p;
     }
     else
     {
-        free_lbuf(d->raw_input);
-        d->raw_input = NULL;
-        d->raw_input_at = NULL;
+        free_raw_input(d, true, false);
     }
 
-    if (  d->aOption <= q
-       && q < qend)
+    if (  NULL != d->aOption
+       && (  NVT_IS_HAVE_IAC_SB == d->raw_input_state
+          || NVT_IS_HAVE_IAC_SB_IAC == d->raw_input_state))
     {
-        d->nOption = q - d->aOption;
+        if (  d->aOption <= q
+           && q < qend)
+        {
+            d->nOption = q - d->aOption;
+        }
+        else
+        {
+            d->nOption = 0;
+        }
     }
     else
     {
+        free_raw_input(d, false, true);
         d->nOption = 0;
     }
     d->input_tot  += nBytes;
@@ -4634,6 +6442,12 @@ static void DCL_CDECL sighandler(int sig)
                         // obtain its process id from fork().
                         //
                     }
+                    CLinearTimeAbsolute ltaDone;
+                    ltaDone.GetUTC();
+                    mudstate.dump_duration = ltaDone - mudstate.dump_started;
+                    flight_record(FLIGHT_DUMP, NOTHING, NOTHING,
+                        mudstate.dump_duration.ReturnMicroseconds(), T("done"));
+                    mudstate.dump_count++;
                     mudstate.dumping = false;
                     local_dump_complete_signal();
 #if defined(TINYMUX_MODULES)
@@ -4705,6 +6519,7 @@ static void DCL_CDECL sighandler(int sig)
 #endif // SIGXCPU
         // Time for a normal and short-winded shutdown.
         //
+        flight_write(sig);
         check_panicking(sig);
         log_signal(sig);
         raw_broadcast(0, T("GAME: Caught signal %s, exiting."), SignalDesc(sig));
@@ -4734,8 +6549,10 @@ static void DCL_CDECL sighandler(int sig)
 #endif // SIGSYS
 #endif // UNIX_SIGNALS
 
-        // Panic save + restart.
+        // Panic save + restart.  The flight recorder goes first, as what
+        // follows is not safe in a signal handler and may not return.
         //
+        flight_write(sig);
         Log.Flush();
         check_panicking(sig);
         log_signal(sig);
@@ -4832,6 +6649,7 @@ static void DCL_CDECL sighandler(int sig)
 
         // Coredump.
         //
+        flight_write(sig);
         log_signal(sig);
         report();
 
@@ -5262,7 +7080,7 @@ void ProcessWindowsTCP(DWORD dwTimeout)
                 {
                     d1->flags &= ~DS_AUTODARK;
                 }
-                db[d->player].fs.word[FLAG_WORD1] &= ~DARK;
+                s_Flags(d->player, FLAG_WORD1, Flags(d->player) & ~DARK);
             }
 
             // process the player's input
@@ -1287,6 +1287,13 @@ static void process_cmdent(CMDENT *cmdp, UTF8 *switchp, dbref executor, dbref ca
             dbref enactor, int eval, bool interactive, UTF8 *arg, UTF8 *unp_command,
             const UTF8 *cargs[], int ncargs)
 {
+    // Time the command under the name of the first built-in it reaches.
+    //
+    if (NULL == mudstate.latency_cmd)
+    {
+        mudstate.latency_cmd = cmdp->cmdname;
+    }
+
     // Perform object type checks.
     //
     if (Invalid_Objtype(executor))
@@ -3728,7 +3735,9 @@ static void list_hashstats(dbref player)
     list_hashstat(player, T("Excl. $-cmds"), &mudstate.parent_htab);
     list_hashstat(player, T("Mail Messages"), &mudstate.mail_htab);
     list_hashstat(player, T("Channel Names"), &mudstate.channel_htab);
-#if !defined(MEMORY_BASED)
+#if defined(MEMORY_BASED)
+    list_hashstat(player, T("Attr. Values"), &mudstate.atr_value_htab);
+#else // MEMORY_BASED
     list_hashstat(player, T("Attr. Cache"), &mudstate.acache_htab);
 #endif // MEMORY_BASED
     for (int i = 0; i < mudstate.nHelpDesc; i++)
@@ -3925,6 +3934,9 @@ static void list_rlevels(dbref player)
 #define LIST_RESOURCES  23
 #define LIST_GUESTS     24
 #define LIST_MODULES    25
+#define LIST_PROFILE    27
+#define LIST_LATENCY    28
+#define LIST_MEMORY     29
 #ifdef REALITY_LVLS
 #define LIST_RLEVELS    26
 #endif
@@ -3945,12 +3957,15 @@ NAMETAB list_names[] =
     {T("functions"),          2,  CA_PUBLIC,  LIST_FUNCTIONS},
     {T("globals"),            2,  CA_WIZARD,  LIST_GLOBALS},
     {T("hashstats"),          1,  CA_WIZARD,  LIST_HASHSTATS},
+    {T("latency"),            2,  CA_WIZARD,  LIST_LATENCY},
     {T("logging"),            1,  CA_GOD,     LIST_LOGGING},
+    {T("memory"),             2,  CA_WIZARD,  LIST_MEMORY},
     {T("modules"),            1,  CA_WIZARD,  LIST_MODULES},
     {T("options"),            1,  CA_PUBLIC,  LIST_OPTIONS},
     {T("permissions"),        2,  CA_WIZARD,  LIST_PERMS},
     {T("powers"),             2,  CA_WIZARD,  LIST_POWERS},
     {T("process"),            2,  CA_WIZARD,  LIST_PROCESS},
+    {T("profile"),            2,  CA_WIZARD,  LIST_PROFILE},
     {T("resources"),          1,  CA_WIZARD,  LIST_RESOURCES},
     {T("site_information"),   2,  CA_WIZARD,  LIST_SITEINFO},
     {T("switches"),           2,  CA_PUBLIC,  LIST_SWITCHES},
@@ -4073,6 +4088,43 @@ void do_list(dbref executor, dbref caller, dbref enactor, int eval, int key,
     case LIST_MODULES:
         list_modules(executor);
         break;
+    case LIST_MEMORY:
+        list_memory(executor);
+        break;
+    case LIST_PROFILE:
+        s_option = mux_strtok_parse(&tts);
+        if (NULL == s_option)
+        {
+            list_profile(executor);
+        }
+        else if (string_prefix(T("reset"), s_option))
+        {
+            profile_reset(executor);
+        }
+        else if (string_prefix(T("write"), s_option))
+        {
+            profile_write(executor);
+        }
+        else
+        {
+            notify(executor, T("Unknown profile action.  Use reset or write."));
+        }
+        break;
+    case LIST_LATENCY:
+        s_option = mux_strtok_parse(&tts);
+        if (NULL == s_option)
+        {
+            list_latency(executor);
+        }
+        else if (string_prefix(T("reset"), s_option))
+        {
+            latency_reset(executor);
+        }
+        else
+        {
+            notify(executor, T("Unknown latency action.  Use reset."));
+        }
+        break;
 #ifdef REALITY_LVLS
     case LIST_RLEVELS:
         list_rlevels(executor);
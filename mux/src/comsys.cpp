@@ -64,6 +64,401 @@ static void do_setnewtitle(dbref player, struct channel *ch, UTF8 *pValidatedTit
     }
 }
 
+// Channel history is kept in a fixed-size ring on each channel rather than
+// in HISTORY_n attributes on the channel object, so a busy channel does not
+// rewrite an attribute for every line. The ring is written to comsys.db at
+// dump time.
+//
+static void chanhist_init(struct channel *ch)
+{
+    ch->hist       = NULL;
+    ch->hist_max   = 0;
+    ch->hist_count = 0;
+    ch->hist_next  = 0;
+}
+
+// Returns the i-th oldest message in the ring.
+//
+static struct chanmsg *chanhist_entry(struct channel *ch, int i)
+{
+    return ch->hist + iMod(ch->hist_next - ch->hist_count + i, ch->hist_max);
+}
+
+static void chanhist_free(struct channel *ch)
+{
+    for (int i = 0; i < ch->hist_count; i++)
+    {
+        MEMFREE(chanhist_entry(ch, i)->msg);
+    }
+    if (NULL != ch->hist)
+    {
+        MEMFREE(ch->hist);
+    }
+    chanhist_init(ch);
+}
+
+// Change the size of the ring, keeping the most recent messages which still
+// fit.
+//
+static void chanhist_resize(struct channel *ch, int nMax)
+{
+    if (nMax == ch->hist_max)
+    {
+        return;
+    }
+    else if (nMax <= 0)
+    {
+        chanhist_free(ch);
+        return;
+    }
+
+    struct chanmsg *hist = (struct chanmsg *)MEMALLOC(nMax * sizeof(struct chanmsg));
+    ISOUTOFMEMORY(hist);
+
+    int nDrop = 0;
+    if (nMax < ch->hist_count)
+    {
+        nDrop = ch->hist_count - nMax;
+    }
+
+    int i;
+    for (i = 0; i < nDrop; i++)
+    {
+        MEMFREE(chanhist_entry(ch, i)->msg);
+    }
+
+    int nKeep = ch->hist_count - nDrop;
+    for (i = 0; i < nKeep; i++)
+    {
+        hist[i] = *chanhist_entry(ch, nDrop + i);
+    }
+
+    if (NULL != ch->hist)
+    {
+        MEMFREE(ch->hist);
+    }
+    ch->hist       = hist;
+    ch->hist_max   = nMax;
+    ch->hist_count = nKeep;
+    ch->hist_next  = iMod(nKeep, nMax);
+}
+
+static void chanhist_add
+(
+    struct channel *ch,
+    const CLinearTimeAbsolute &ltaSent,
+    bool bStamp,
+    const UTF8 *msg
+)
+{
+    struct chanmsg *pm = ch->hist + ch->hist_next;
+    if (ch->hist_count < ch->hist_max)
+    {
+        ch->hist_count++;
+    }
+    else
+    {
+        MEMFREE(pm->msg);
+    }
+
+    pm->ltaSent = ltaSent;
+    pm->bStamp  = bStamp;
+    pm->msg     = StringClone(msg);
+
+    ch->hist_next = iMod(ch->hist_next + 1, ch->hist_max);
+}
+
+// Move any history left in HISTORY_n attributes by an earlier version into
+// the ring and clear the attributes. nLast is the message count at which
+// the newest of them was written. The timestamps, if any, are already part
+// of the saved text.
+//
+static void chanhist_import(struct channel *ch, int nLast)
+{
+    dbref obj = ch->chan_obj;
+    if (  !Good_obj(obj)
+       || ch->hist_max <= 0)
+    {
+        return;
+    }
+
+    CLinearTimeAbsolute ltaNow;
+    ltaNow.GetUTC();
+
+    int histnum = nLast - ch->hist_max;
+    for (int count = 0; count < ch->hist_max; count++)
+    {
+        histnum++;
+        ATTR *pattr = atr_str(tprintf(T("HISTORY_%d"), iMod(histnum, ch->hist_max)));
+        if (pattr)
+        {
+            dbref aowner;
+            int   aflags;
+            UTF8 *message = atr_get("chanhist_import.1", obj, pattr->number,
+                    &aowner, &aflags);
+            if ('\0' != message[0])
+            {
+                chanhist_add(ch, ltaNow, false, message);
+                atr_clr(obj, pattr->number);
+            }
+            free_lbuf(message);
+        }
+    }
+}
+
+// Bring the ring to the size given by MAX_LOG. The first time a channel's
+// ring is needed, pick up any attribute-based history, the newest of which
+// was written at message count nLast.
+//
+static void chanhist_prepare(struct channel *ch, int logmax, int nLast)
+{
+    bool bFirst = (NULL == ch->hist);
+    chanhist_resize(ch, logmax);
+    if (  bFirst
+       && NULL != ch->hist)
+    {
+        chanhist_import(ch, nLast);
+    }
+}
+
+// Write the history rings of all channels.
+//
+static void save_history(FILE *fp)
+{
+    struct channel *ch;
+    int nChannels = 0;
+    for (ch = (struct channel *)hash_firstentry(&mudstate.channel_htab);
+         ch;
+         ch = (struct channel *)hash_nextentry(&mudstate.channel_htab))
+    {
+        if (0 < ch->hist_count)
+        {
+            nChannels++;
+        }
+    }
+
+    mux_fprintf(fp, T("%d\n"), nChannels);
+    for (ch = (struct channel *)hash_firstentry(&mudstate.channel_htab);
+         ch;
+         ch = (struct channel *)hash_nextentry(&mudstate.channel_htab))
+    {
+        if (0 < ch->hist_count)
+        {
+            mux_fprintf(fp, T("%s\n"), ch->name);
+            mux_fprintf(fp, T("%d %d\n"), ch->hist_max, ch->hist_count);
+            for (int i = 0; i < ch->hist_count; i++)
+            {
+                struct chanmsg *pm = chanhist_entry(ch, i);
+                mux_fprintf(fp, T("%d %s\n"), pm->bStamp,
+                    pm->ltaSent.ReturnSecondsString(0));
+                putstring(fp, pm->msg);
+            }
+        }
+    }
+}
+
+// Every broadcast checks each listener against the channel's receive lock.
+// The lock is parsed once per change rather than once per listener, and the
+// decision for each listener is remembered as long as neither the channel
+// nor the listener's flags, powers or owner have changed. Decisions which
+// depend on anything else (the listener's inventory or attributes, or
+// softcode) are not remembered.
+//
+static void chanrx_init(struct channel *ch)
+{
+    ch->rx_gen     = 1;
+    ch->rx_key     = NULL;
+    ch->rx_obj     = NOTHING;
+    ch->rx_type    = 0;
+    ch->rx_bKey    = false;
+    ch->rx_lock    = TRUE_BOOLEXP;
+    ch->rx_bStatic = true;
+    ch->rx_nest    = 0;
+}
+
+static void chanrx_free(struct channel *ch)
+{
+    if (TRUE_BOOLEXP != ch->rx_lock)
+    {
+        free_boolexp(ch->rx_lock);
+    }
+    if (NULL != ch->rx_key)
+    {
+        MEMFREE(ch->rx_key);
+    }
+    chanrx_init(ch);
+}
+
+// A lock is static if it only asks whether the listener is a particular
+// object.
+//
+static bool boolexp_static(BOOLEXP *b)
+{
+    if (TRUE_BOOLEXP == b)
+    {
+        return true;
+    }
+
+    switch (b->type)
+    {
+    case BOOLEXP_AND:
+    case BOOLEXP_OR:
+        return boolexp_static(b->sub1) && boolexp_static(b->sub2);
+
+    case BOOLEXP_NOT:
+        return boolexp_static(b->sub1);
+
+    case BOOLEXP_IS:
+        return BOOLEXP_CONST == b->sub1->type;
+    }
+    return false;
+}
+
+// Bring the parsed receive lock up to date, and start a new generation of
+// cached decisions if anything they depend on has changed.
+//
+static void chanrx_refresh(struct channel *ch)
+{
+    if (0 < ch->rx_nest)
+    {
+        return;
+    }
+
+    dbref obj = ch->chan_obj;
+    bool bKey = false;
+    UTF8 *key = NULL;
+    if (Good_obj(obj))
+    {
+        dbref aowner;
+        int   aflags;
+        bKey = Key(obj);
+        key = atr_get("chanrx_refresh.1", obj, A_LENTER, &aowner, &aflags);
+    }
+
+    if (  NULL != ch->rx_key
+       && obj == ch->rx_obj
+       && ch->type == ch->rx_type
+       && bKey == ch->rx_bKey
+       && strcmp((char *)(NULL == key ? T("") : key), (char *)ch->rx_key) == 0)
+    {
+        if (NULL != key)
+        {
+            free_lbuf(key);
+        }
+        return;
+    }
+
+    int gen = ch->rx_gen;
+    chanrx_free(ch);
+    ch->rx_gen  = gen + 1;
+    ch->rx_obj  = obj;
+    ch->rx_type = ch->type;
+    ch->rx_bKey = bKey;
+    if (NULL != key)
+    {
+        ch->rx_key = StringClone(key);
+
+        // Listeners who get as far as the lock are never God, so parse it as
+        // someone who is not.
+        //
+        ch->rx_lock = parse_boolexp(NOTHING, key, true);
+        free_lbuf(key);
+    }
+    else
+    {
+        ch->rx_key = StringClone(T(""));
+    }
+    ch->rx_bStatic = boolexp_static(ch->rx_lock);
+}
+
+// Same as test_receive_access(), but using the parsed lock. *pbStable is
+// set to whether the answer depends only on things chanrx_receive() checks.
+//
+static bool chanrx_test(dbref player, struct channel *ch, bool *pbStable)
+{
+    *pbStable = true;
+    if (Comm_All(player))
+    {
+        return true;
+    }
+
+    int access;
+    if (isPlayer(player))
+    {
+        access = CHANNEL_PLAYER_RECEIVE;
+    }
+    else
+    {
+        access = CHANNEL_OBJECT_RECEIVE;
+    }
+    if ((ch->type & access) != 0)
+    {
+        return true;
+    }
+
+    dbref thing = ch->chan_obj;
+    if (  !Good_obj(thing)
+       || thing != ch->rx_obj)
+    {
+        *pbStable = false;
+        return could_doit(player, thing, A_LENTER);
+    }
+
+    // The rest is could_doit().
+    //
+    if (  !isPlayer(player)
+       && Key(thing))
+    {
+        return false;
+    }
+    if (Pass_Locks(player))
+    {
+        return true;
+    }
+    *pbStable = ch->rx_bStatic;
+    return eval_boolexp(player, thing, thing, ch->rx_lock);
+}
+
+static bool rx_same_flags(const FLAGSET &a, const FLAGSET &b)
+{
+    return  a.word[FLAG_WORD1] == b.word[FLAG_WORD1]
+         && a.word[FLAG_WORD2] == b.word[FLAG_WORD2]
+         && a.word[FLAG_WORD3] == b.word[FLAG_WORD3];
+}
+
+static bool chanrx_receive(struct comuser *user, struct channel *ch)
+{
+    dbref who = user->who;
+    struct rxaccess *prx = &user->rx;
+    if (  prx->gen == ch->rx_gen
+       && prx->owner == Owner(who)
+       && prx->powers == Powers(who)
+       && prx->powers2 == Powers2(who)
+       && rx_same_flags(prx->fs, db[who].fs)
+       && rx_same_flags(prx->fsOwner, db[Owner(who)].fs))
+    {
+        return prx->bOk;
+    }
+
+    bool bStable;
+    bool bOk = chanrx_test(who, ch, &bStable);
+    if (bStable)
+    {
+        prx->gen     = ch->rx_gen;
+        prx->bOk     = bOk;
+        prx->owner   = Owner(who);
+        prx->powers  = Powers(who);
+        prx->powers2 = Powers2(who);
+        prx->fs      = db[who].fs;
+        prx->fsOwner = db[Owner(who)].fs;
+    }
+    else
+    {
+        prx->gen = 0;
+    }
+    return bOk;
+}
+
 // Save communication system data to disk.
 //
 void save_comsys(UTF8 *filename)
@@ -87,6 +482,9 @@ void save_comsys(UTF8 *filename)
     mux_fprintf(fp, T("*** Begin COMSYS ***\n"));
     save_comsystem(fp);
 
+    mux_fprintf(fp, T("*** Begin HISTORY ***\n"));
+    save_history(fp);
+
     if (fclose(fp) == 0)
     {
         DebugTotalFiles--;
@@ -548,6 +946,8 @@ void load_comsystem_V4(FILE *fp)
         ch->amount_col   = 0;
         ch->num_messages = 0;
         ch->chan_obj     = NOTHING;
+        chanhist_init(ch);
+        chanrx_init(ch);
 
         mux_assert(ReadListOfNumbers(fp, 8, anum));
         ch->type         = anum[0];
@@ -753,6 +1153,8 @@ void load_comsystem_V0123(FILE *fp)
         ch->amount_col   = 0;
         ch->num_messages = 0;
         ch->chan_obj     = NOTHING;
+        chanhist_init(ch);
+        chanrx_init(ch);
 
         if (ver >= 1)
         {
@@ -1039,6 +1441,72 @@ void load_channels_V0123(FILE *fp)
     }
 }
 
+// Read the history rings written by save_history(). Rings for channels
+// which no longer exist are skipped.
+//
+static void load_history_V4(FILE *fp)
+{
+    UTF8 temp[LBUF_SIZE];
+    if (NULL == fgets((char *)temp, sizeof(temp), fp))
+    {
+        return;
+    }
+    int nChannels = mux_atol(temp);
+
+    for (int i = 0; i < nChannels; i++)
+    {
+        size_t nChannel = GetLineTrunc(temp, sizeof(temp), fp);
+        if (  0 < nChannel
+           && temp[nChannel-1] == '\n')
+        {
+            nChannel--;
+        }
+        temp[nChannel] = '\0';
+        struct channel *ch = select_channel(temp);
+
+        int anum[2];
+        mux_assert(ReadListOfNumbers(fp, 2, anum));
+        if (NULL != ch)
+        {
+            chanhist_resize(ch, anum[0]);
+        }
+
+        for (int j = 0; j < anum[1]; j++)
+        {
+            CLinearTimeAbsolute ltaSent;
+            bool bStamp = false;
+            if (fgets((char *)temp, sizeof(temp), fp))
+            {
+                UTF8 *p = temp;
+                bStamp = (0 != mux_atol(p));
+                while (*p && ' ' != *p)
+                {
+                    p++;
+                }
+                if (' ' == *p)
+                {
+                    p++;
+                }
+                UTF8 *q = p;
+                while (mux_isdigit(*q) || '-' == *q || '.' == *q)
+                {
+                    q++;
+                }
+                *q = '\0';
+                ltaSent.SetSecondsString(p);
+            }
+
+            size_t nMessage;
+            UTF8 *pMessage = (UTF8 *)getstring_noalloc(fp, true, &nMessage);
+            if (  NULL != ch
+               && NULL != ch->hist)
+            {
+                chanhist_add(ch, ltaSent, bStamp, pMessage);
+            }
+        }
+    }
+}
+
 void load_comsys_V4(FILE *fp)
 {
     char buffer[200];
@@ -1063,6 +1531,14 @@ void load_comsys_V4(FILE *fp)
         Log.tinyprintf(T("Error: Couldn\xE2\x80\x99t find Begin COMSYS." ENDLINE));
         return;
     }
+
+    // Channel history was added later, and is optional.
+    //
+    if (  fgets(buffer, sizeof(buffer), fp)
+       && strcmp(buffer, "*** Begin HISTORY ***\n") == 0)
+    {
+        load_history_V4(fp);
+    }
 }
 
 void load_comsys_V0123(FILE *fp)
@@ -1521,11 +1997,14 @@ void SendChannelMessage
     bool bSpoof = ((ch->type & CHANNEL_SPOOF) != 0);
     ch->num_messages++;
 
+    chanrx_refresh(ch);
+    ch->rx_nest++;
+
     struct comuser *user;
     for (user = ch->on_users; user; user = user->on_next)
     {
         if (  user->bUserIsOn
-           && test_receive_access(user->who, ch))
+           && chanrx_receive(user, ch))
         {
             if (  user->ComTitleStatus
                || bSpoof
@@ -1539,6 +2018,7 @@ void SendChannelMessage
             }
         }
     }
+    ch->rx_nest--;
 
     // Handle logging.
     //
@@ -1566,32 +2046,21 @@ void SendChannelMessage
                 atr_add(ch->chan_obj, pattr->number, mux_ltoa_t(logmax), GOD,
                     AF_CONST|AF_NOPROG|AF_NOPARSE);
             }
-            UTF8 *p = tprintf(T("HISTORY_%d"), iMod(ch->num_messages, logmax));
-            int atr = mkattr(GOD, p);
-            if (0 < atr)
-            {
-                pattr = atr_str(T("LOG_TIMESTAMPS"));
-                if (  pattr
-                   && atr_get_info(obj, pattr->number, &aowner, &aflags))
-                {
-                    CLinearTimeAbsolute ltaNow;
-                    ltaNow.GetLocal();
+            // num_messages already counts this message.
+            //
+            chanhist_prepare(ch, logmax, ch->num_messages - 1);
 
-                    // Save message in history with timestamp.
-                    //
-                    UTF8 temp[LBUF_SIZE];
-                    mux_sprintf(temp, sizeof(temp), T("[%s] %s"), ltaNow.ReturnDateString(0), msgNormal);
-                    atr_add(ch->chan_obj, atr, temp, GOD, AF_CONST|AF_NOPROG|AF_NOPARSE);
-                }
-                else
-                {
-                    // Save message in history without timestamp.
-                    //
-                    atr_add(ch->chan_obj, atr, msgNormal, GOD,
-                            AF_CONST|AF_NOPROG|AF_NOPARSE);
-                }
+            pattr = atr_str(T("LOG_TIMESTAMPS"));
+            bool bStamp = (  pattr
+                          && atr_get_info(obj, pattr->number, &aowner, &aflags));
 
-            }
+            CLinearTimeAbsolute ltaNow;
+            ltaNow.GetUTC();
+            chanhist_add(ch, ltaNow, bStamp, msgNormal);
+        }
+        else if (NULL != ch->hist)
+        {
+            chanhist_free(ch);
         }
     }
     else if (ch->chan_obj != NOTHING)
@@ -1688,6 +2157,7 @@ void do_joinchannel(dbref player, struct channel *ch)
         user->bUserIsOn      = true;
         user->ComTitleStatus = true;
         user->title          = StringClone(T(""));
+        user->rx.gen         = 0;
 
         // if (Connected(player))&&(isPlayer(player))
         //
@@ -1852,6 +2322,7 @@ void do_comlast(dbref player, struct channel *ch, int arg)
     int aflags;
     dbref obj = ch->chan_obj;
     int logmax = MAX_RECALL_REQUEST;
+    bool bMaxLog = false;
 
     // Lookup depth of logging.
     //
@@ -1862,6 +2333,7 @@ void do_comlast(dbref player, struct channel *ch, int arg)
         UTF8 *maxbuf = atr_get("do_comlast.1408", obj, pattr->number, &aowner, &aflags);
         logmax = mux_atol(maxbuf);
         free_lbuf(maxbuf);
+        bMaxLog = true;
     }
 
     if (logmax < 1)
@@ -1880,21 +2352,31 @@ void do_comlast(dbref player, struct channel *ch, int arg)
         arg = logmax;
     }
 
-    UTF8 *message;
-    int histnum = ch->num_messages - arg;
+    if (  NULL == ch->hist
+       && bMaxLog)
+    {
+        chanhist_prepare(ch, logmax, ch->num_messages);
+    }
+
+    if (arg > ch->hist_count)
+    {
+        arg = ch->hist_count;
+    }
 
     raw_notify(player, tprintf(T("%s -- Begin Comsys Recall --"), ch->header));
 
-    for (int count = 0; count < arg; count++)
+    for (int count = ch->hist_count - arg; count < ch->hist_count; count++)
     {
-        histnum++;
-        pattr = atr_str(tprintf(T("HISTORY_%d"), iMod(histnum, logmax)));
-        if (pattr)
+        struct chanmsg *pm = chanhist_entry(ch, count);
+        if (pm->bStamp)
         {
-            message = atr_get("do_comlast.1436", obj, pattr->number,
-                    &aowner, &aflags);
-            raw_notify(player, message);
-            free_lbuf(message);
+            CLinearTimeAbsolute ltaSent(pm->ltaSent);
+            ltaSent.UTC2Local();
+            raw_notify(player, tprintf(T("[%s] %s"), ltaSent.ReturnDateString(0), pm->msg));
+        }
+        else
+        {
+            raw_notify(player, pm->msg);
         }
     }
 
@@ -1991,22 +2473,23 @@ static bool do_chanlog(dbref player, UTF8 *channel, UTF8 *arg)
         return false;
     }
 
-    dbref aowner;
-    int aflags;
-    UTF8 *oldvalue = atr_get("do_chanlog.1477", ch->chan_obj, atr, &aowner, &aflags);
-    int oldnum = mux_atol(oldvalue);
-    if (value < oldnum)
+    if (NULL == ch->hist)
     {
-        for (int count = 0; count <= oldnum; count++)
+        // Pick up any attribute-based history while it can still be found
+        // under the old MAX_LOG.
+        //
+        dbref aowner;
+        int aflags;
+        UTF8 *oldvalue = atr_get("do_chanlog.1477", ch->chan_obj, atr, &aowner, &aflags);
+        int oldnum = mux_atol(oldvalue);
+        free_lbuf(oldvalue);
+        if (oldnum > MAX_RECALL_REQUEST)
         {
-            ATTR *hist = atr_str(tprintf(T("HISTORY_%d"), count));
-            if (hist)
-            {
-                atr_clr(ch->chan_obj, hist->number);
-            }
+            oldnum = MAX_RECALL_REQUEST;
         }
+        chanhist_prepare(ch, oldnum, ch->num_messages);
     }
-    free_lbuf(oldvalue);
+    chanhist_resize(ch, value);
     atr_add(ch->chan_obj, atr, mux_ltoa_t(value), GOD,
         AF_CONST|AF_NOPROG|AF_NOPARSE);
     return true;
@@ -2405,6 +2888,8 @@ void do_createchannel(dbref executor, dbref caller, dbref enactor, int eval, int
     newchannel->on_users = NULL;
     newchannel->chan_obj = NOTHING;
     newchannel->num_messages = 0;
+    chanhist_init(newchannel);
+    chanrx_init(newchannel);
 
     num_channels++;
 
@@ -2455,6 +2940,8 @@ void do_destroychannel(dbref executor, dbref caller, dbref enactor, int eval, in
     }
     MEMFREE(ch->users);
     ch->users = NULL;
+    chanhist_free(ch);
+    chanrx_free(ch);
     MEMFREE(ch);
     ch = NULL;
     raw_notify(executor, tprintf(T("Channel %s destroyed."), channel));
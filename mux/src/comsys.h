@@ -38,6 +38,24 @@
 // Maximum cost to use for a channel
 #define MAX_COST        32767
 
+//! \struct rxaccess
+// A cached receive-access decision and the state of the user it was made
+// against
+struct rxaccess
+{
+    //! Channel rx_gen the decision was made under, or 0 if none
+    int gen;
+    //! Whether the user may receive
+    bool bOk;
+    //! User's flags, powers and owner at the time
+    FLAGSET fs;
+    POWER powers;
+    POWER powers2;
+    dbref owner;
+    //! Owner's flags at the time, for inherited wizard status
+    FLAGSET fsOwner;
+};
+
 //! \struct comuser
 // Comsys user data
 struct comuser
@@ -52,6 +70,20 @@ struct comuser
     bool ComTitleStatus;
     //! Pointer to the next user on the channel
     struct comuser *on_next;
+    //! Cached receive access
+    struct rxaccess rx;
+};
+
+//! \struct chanmsg
+// One entry in a channel's message history
+struct chanmsg
+{
+    //! When the message was sent (UTC)
+    CLinearTimeAbsolute ltaSent;
+    //! Whether recall prefixes the message with its timestamp
+    bool bStamp;
+    //! Message as it was shown to channel members
+    UTF8 *msg;
 };
 
 //! \struct channel
@@ -83,6 +115,27 @@ struct channel
     struct comuser *on_users;
     //! Number of messages sent on the channel
     int num_messages;
+    //! Ring of recent messages, sized by the channel object's MAX_LOG
+    struct chanmsg *hist;
+    //! Number of slots in the ring
+    int hist_max;
+    //! Number of slots in use
+    int hist_count;
+    //! Slot the next message is written to
+    int hist_next;
+    //! Bumped whenever anything the receive lock depends on changes
+    int rx_gen;
+    //! Receive lock text, chan_obj, type and KEY flag rx_gen was set for
+    UTF8 *rx_key;
+    dbref rx_obj;
+    int rx_type;
+    bool rx_bKey;
+    //! Parsed receive lock
+    BOOLEXP *rx_lock;
+    //! Whether the receive lock only depends on who the receiver is
+    bool rx_bStatic;
+    //! Number of broadcasts in progress, which may be using rx_lock
+    int rx_nest;
 };
 
 //! \struct tagComsys
@@ -59,7 +59,11 @@ void cf_init(void)
     mudconf.compress = StringClone(T("gzip"));
     mudconf.uncompress = StringClone(T("gzip -d"));
     mudconf.status_file = StringClone(T("shutdown.status"));
+    mudconf.profile_file = StringClone(T("netmux.prof"));
+    mudconf.flight_file = StringClone(T("netmux.flight"));
     mudconf.max_cache_size = 1*1024*1024;
+    mudconf.max_cmd_cache_size = 1*1024*1024;
+    mudconf.attr_compress_size = 512;
 
     mudconf.ip_address = NULL;
     mudconf.ports.n = 1;
@@ -143,14 +147,18 @@ void cf_init(void)
     mudconf.have_mailer = true;
     mudconf.have_zones = true;
     mudconf.paranoid_alloc = false;
+    mudconf.profile_softcode = false;
     mudconf.sig_action = SA_DFLT;
     mudconf.max_players = -1;
+    mudconf.metrics_port = 0;
     mudconf.dump_interval = 3600;
     mudconf.check_interval = 600;
     mudconf.events_daily_hour = 7;
     mudconf.dump_offset = 0;
     mudconf.check_offset = 300;
+    mudconf.check_slice = 5000;
     mudconf.idle_timeout = 3600;
+    mudconf.io_threads = 0;
     mudconf.conn_timeout = 120;
     mudconf.idle_interval = 60;
     mudconf.retry_limit = 3;
@@ -183,6 +191,7 @@ void cf_init(void)
     mudconf.robotcost = 1000;
     mudconf.pagecost = 10;
     mudconf.searchcost = 100;
+    mudconf.search_threads = 4;
     mudconf.waitcost = 10;
     mudconf.machinecost = 64;
     mudconf.exit_quota = 1;
@@ -291,6 +300,7 @@ void cf_init(void)
     mudconf.stack_limit = 50;
     mudconf.cache_names = true;
     mudconf.toad_recipient = -1;
+    mudconf.eval_arena = false;
     mudconf.eval_comtitle = true;
     mudconf.run_startup = true;
     mudconf.safe_wipe = false;
@@ -320,6 +330,10 @@ void cf_init(void)
     mudstate.asserting = 0;
     mudstate.logging = 0;
     mudstate.epoch = 0;
+    mudstate.dump_count = 0;
+    mudstate.commands_total = 0;
+    mudstate.output_bytes = 0;
+    mudstate.latency_cmd = NULL;
     mudstate.generation = 0;
     mudstate.curr_executor = NOTHING;
     mudstate.curr_enactor = NOTHING;
@@ -1763,6 +1777,7 @@ static CONFPARM conftable[] =
     {T("attr_access"),               cf_attr_access, CA_GOD,    CA_DISABLED, NULL,                            attraccess_nametab, 0},
     {T("attr_alias"),                cf_alias,       CA_GOD,    CA_DISABLED, (int *)&mudstate.attr_name_htab, 0,                  0},
     {T("attr_cmd_access"),           cf_acmd_access, CA_GOD,    CA_DISABLED, NULL,                            access_nametab,     0},
+    {T("attr_compress_size"),        cf_int,         CA_GOD,    CA_WIZARD,   &mudconf.attr_compress_size,     NULL,               0},
     {T("attr_name_charset"),         cf_modify_bits, CA_GOD,    CA_PUBLIC,   &mudconf.attr_name_charset,      allow_charset_nametab, 0},
     {T("autozone"),                  cf_bool,        CA_GOD,    CA_PUBLIC,   (int *)&mudconf.autozone,        NULL,               0},
     {T("bad_name"),                  cf_badname,     CA_GOD,    CA_DISABLED, NULL,                            NULL,               0},
@@ -1772,6 +1787,7 @@ static CONFPARM conftable[] =
     {T("cache_tick_period"),         cf_seconds,     CA_GOD,    CA_WIZARD,   (int *)&mudconf.cache_tick_period, NULL,             0},
     {T("check_interval"),            cf_int,         CA_GOD,    CA_WIZARD,   &mudconf.check_interval,         NULL,               0},
     {T("check_offset"),              cf_int,         CA_GOD,    CA_WIZARD,   &mudconf.check_offset,           NULL,               0},
+    {T("check_slice"),               cf_int,         CA_GOD,    CA_WIZARD,   &mudconf.check_slice,            NULL,               0},
     {T("clone_copies_cost"),         cf_bool,        CA_GOD,    CA_PUBLIC,   (int *)&mudconf.clone_copy_cost, NULL,               0},
     {T("command_quota_increment"),   cf_int,         CA_GOD,    CA_WIZARD,   &mudconf.cmd_quota_incr,         NULL,               0},
     {T("command_quota_max"),         cf_int,         CA_GOD,    CA_WIZARD,   &mudconf.cmd_quota_max,          NULL,               0},
@@ -1798,6 +1814,7 @@ static CONFPARM conftable[] =
     {T("dump_message"),              cf_string,      CA_GOD,    CA_WIZARD,   (int *)mudconf.dump_msg,         NULL,             256},
     {T("dump_offset"),               cf_int,         CA_GOD,    CA_WIZARD,   &mudconf.dump_offset,            NULL,               0},
     {T("earn_limit"),                cf_int,         CA_GOD,    CA_PUBLIC,   &mudconf.paylimit,               NULL,               0},
+    {T("eval_arena"),                cf_bool,        CA_GOD,    CA_WIZARD,   (int *)&mudconf.eval_arena,      NULL,               0},
     {T("eval_comtitle"),             cf_bool,        CA_GOD,    CA_PUBLIC,   (int *)&mudconf.eval_comtitle,   NULL,               0},
     {T("events_daily_hour"),         cf_int,         CA_GOD,    CA_PUBLIC,   &mudconf.events_daily_hour,      NULL,               0},
     {T("examine_flags"),             cf_bool,        CA_GOD,    CA_PUBLIC,   (int *)&mudconf.ex_flags,        NULL,               0},
@@ -1813,6 +1830,7 @@ static CONFPARM conftable[] =
     {T("flag_access"),               cf_flag_access, CA_GOD,    CA_DISABLED, NULL,                            NULL,               0},
     {T("flag_alias"),                cf_flagalias,   CA_GOD,    CA_DISABLED, NULL,                            NULL,               0},
     {T("flag_name"),                 cf_flag_name,   CA_GOD,    CA_DISABLED, NULL,                            NULL,               0},
+    {T("flight_file"),               cf_string_dyn,  CA_STATIC, CA_GOD,      (int *)&mudconf.flight_file,     NULL, SIZEOF_PATHNAME},
     {T("float_precision"),           cf_int,         CA_STATIC, CA_PUBLIC,   &mudconf.float_precision,        NULL,               0},
     {T("forbid_site"),               cf_site,        CA_GOD,    CA_DISABLED, (int *)&mudstate.access_list,    NULL,       HC_FORBID},
 #if defined(HAVE_WORKING_FORK)
@@ -1851,6 +1869,7 @@ static CONFPARM conftable[] =
     {T("indent_desc"),               cf_bool,        CA_GOD,    CA_PUBLIC,   (int *)&mudconf.indent_desc,     NULL,               0},
     {T("initial_size"),              cf_int,         CA_STATIC, CA_WIZARD,   &mudconf.init_size,              NULL,               0},
     {T("input_database"),            cf_string_dyn,  CA_STATIC, CA_GOD,      (int *)&mudconf.indb,            NULL, SIZEOF_PATHNAME},
+    {T("io_threads"),                cf_int,         CA_STATIC, CA_WIZARD,   &mudconf.io_threads,             NULL,               0},
     {T("ip_address"),                cf_string_dyn,  CA_STATIC, CA_GOD,      (int *)&mudconf.ip_address,      NULL,       LBUF_SIZE},
     {T("kill_guarantee_cost"),       cf_int,         CA_GOD,    CA_PUBLIC,   &mudconf.killguarantee,          NULL,               0},
     {T("kill_max_cost"),             cf_int,         CA_GOD,    CA_PUBLIC,   &mudconf.killmax,                NULL,               0},
@@ -1872,7 +1891,9 @@ static CONFPARM conftable[] =
     {T("master_room"),               cf_dbref,       CA_GOD,    CA_WIZARD,   &mudconf.master_room,            NULL,               0},
     {T("match_own_commands"),        cf_bool,        CA_GOD,    CA_PUBLIC,   (int *)&mudconf.match_mine,      NULL,               0},
     {T("max_cache_size"),            cf_int,         CA_GOD,    CA_GOD,      (int *)&mudconf.max_cache_size,  NULL,               0},
+    {T("max_cmd_cache_size"),        cf_int,         CA_GOD,    CA_GOD,      (int *)&mudconf.max_cmd_cache_size, NULL,           0},
     {T("max_players"),               cf_int,         CA_GOD,    CA_WIZARD,   &mudconf.max_players,            NULL,               0},
+    {T("metrics_port"),              cf_int,         CA_STATIC, CA_WIZARD,   &mudconf.metrics_port,           NULL,               0},
     {T("min_guests"),                cf_int,         CA_STATIC, CA_GOD,      (int *)&mudconf.min_guests,      NULL,               0},
     {T("money_name_plural"),         cf_string,      CA_GOD,    CA_PUBLIC,   (int *)mudconf.many_coins,       NULL,              32},
     {T("money_name_singular"),       cf_string,      CA_GOD,    CA_PUBLIC,   (int *)mudconf.one_coin,         NULL,              32},
@@ -1913,6 +1934,8 @@ static CONFPARM conftable[] =
     {T("postdump_message"),          cf_string,      CA_GOD,    CA_WIZARD,   (int *)mudconf.postdump_msg,     NULL,             256},
     {T("power_alias"),               cf_poweralias,  CA_GOD,    CA_DISABLED, NULL,                            NULL,               0},
     {T("pcreate_per_hour"),          cf_int,         CA_STATIC, CA_PUBLIC,   (int *)&mudconf.pcreate_per_hour,NULL,               0},
+    {T("profile_file"),              cf_string_dyn,  CA_STATIC, CA_GOD,      (int *)&mudconf.profile_file,    NULL, SIZEOF_PATHNAME},
+    {T("profile_softcode"),          cf_bool,        CA_GOD,    CA_WIZARD,   (int *)&mudconf.profile_softcode, NULL,              0},
     {T("public_channel"),            cf_string,      CA_STATIC, CA_PUBLIC,   (int *)mudconf.public_channel,   NULL,              32},
     {T("public_channel_alias"),      cf_string,      CA_STATIC, CA_PUBLIC,   (int *)mudconf.public_channel_alias, NULL,          32},
     {T("public_flags"),              cf_bool,        CA_GOD,    CA_PUBLIC,   (int *)&mudconf.pub_flags,       NULL,               0},
@@ -1946,6 +1969,7 @@ static CONFPARM conftable[] =
     {T("safe_wipe"),                 cf_bool,        CA_GOD,    CA_WIZARD,   (int *)&mudconf.safe_wipe,       NULL,               0},
     {T("safer_passwords"),           cf_bool,        CA_GOD,    CA_PUBLIC,   (int *)&mudconf.safer_passwords, NULL,               0},
     {T("search_cost"),               cf_int,         CA_GOD,    CA_PUBLIC,   &mudconf.searchcost,             NULL,               0},
+    {T("search_threads"),            cf_int,         CA_GOD,    CA_WIZARD,   &mudconf.search_threads,         NULL,               0},
     {T("see_owned_dark"),            cf_bool,        CA_GOD,    CA_PUBLIC,   (int *)&mudconf.see_own_dark,    NULL,               0},
     {T("signal_action"),             cf_option,      CA_STATIC, CA_GOD,      &mudconf.sig_action,             sigactions_nametab, 0},
     {T("site_chars"),                cf_int,         CA_GOD,    CA_WIZARD,   (int *)&mudconf.site_chars,      NULL,               0},
@@ -622,6 +622,14 @@ extern void *MemRealloc(void *p, size_t n, const char *f, int l);
 #define MEMREALLOC(p, n)     realloc((p),(n))
 #endif // MEMORY_ACCOUNTING
 
+// Socket reads, telnet decoding, and writes may be given to threads of their
+// own (see the io_threads parameter).  The accounting allocator above is not
+// thread-safe, so it rules them out.
+//
+#if defined(UNIX_NETWORKING_SELECT) && defined(HAVE_PTHREAD_H) && !defined(MEMORY_ACCOUNTING)
+#define UNIX_NETWORKING_THREADS
+#endif // UNIX_NETWORKING_SELECT && HAVE_PTHREAD_H && !MEMORY_ACCOUNTING
+
 // If it's Hewlett Packard, then getrusage is provided a different
 // way.
 //
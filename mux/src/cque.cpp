@@ -22,7 +22,7 @@
 
 bool break_called = false;
 
-static CLinearTimeDelta GetProcessorUsage(void)
+CLinearTimeDelta GetProcessorUsage(void)
 {
     CLinearTimeDelta ltd;
 #if defined(WINDOWS_PROCESSES)
@@ -53,6 +53,303 @@ static CLinearTimeDelta GetProcessorUsage(void)
     return ltd;
 }
 
+// ---------------------------------------------------------------------------
+// Latency histograms.
+//
+// Wall time is recorded for every command a connection or queue entry runs,
+// by the name of the built-in command it dispatched to, along with the
+// bytes of output it queued.  Each queue entry also records how long it
+// waited after becoming ready and how long it ran, by priority.
+//
+// The histograms are log-linear in the manner of HdrHistogram: values below
+// LATENCY_SUB_COUNT each have a bucket, and every power of two above that is
+// split into LATENCY_SUB_COUNT buckets, so a reported percentile is within
+// about 6% of the true value.
+//
+
+#define LATENCY_SUB_BITS   4
+#define LATENCY_SUB_COUNT  (1 << LATENCY_SUB_BITS)
+#define LATENCY_MAX_BITS   40
+#define LATENCY_BUCKETS    (LATENCY_SUB_COUNT*(LATENCY_MAX_BITS - LATENCY_SUB_BITS + 1))
+#define LATENCY_LIST_MAX   40
+
+typedef struct
+{
+    UINT64 nCount;
+    UINT64 nSum;
+    UINT64 nMax;
+    UINT32 aBuckets[LATENCY_BUCKETS];
+} LATENCY_HISTOGRAM;
+
+typedef struct
+{
+    UTF8 *pName;
+    LATENCY_HISTOGRAM hWall;    // Microseconds.
+    LATENCY_HISTOGRAM hOutput;  // Bytes.
+} LATENCY_COMMAND;
+
+static CHashTable latency_htab;
+static LATENCY_HISTOGRAM latency_queue_wait[2];
+static LATENCY_HISTOGRAM latency_queue_run[2];
+static CLinearTimeAbsolute latency_since;
+
+static void latency_add(LATENCY_HISTOGRAM *ph, UINT64 n)
+{
+    int iBucket;
+    if (n < LATENCY_SUB_COUNT)
+    {
+        iBucket = static_cast<int>(n);
+    }
+    else
+    {
+        int iBit = LATENCY_SUB_BITS;
+        while (  iBit < LATENCY_MAX_BITS - 1
+              && (n >> (iBit + 1)))
+        {
+            iBit++;
+        }
+
+        if (n >> (iBit + 1))
+        {
+            iBucket = LATENCY_BUCKETS - 1;
+        }
+        else
+        {
+            iBucket = (iBit - LATENCY_SUB_BITS + 1)*LATENCY_SUB_COUNT
+                    + static_cast<int>((n >> (iBit - LATENCY_SUB_BITS)) & (LATENCY_SUB_COUNT - 1));
+        }
+    }
+    ph->aBuckets[iBucket]++;
+    ph->nCount++;
+    ph->nSum += n;
+    if (ph->nMax < n)
+    {
+        ph->nMax = n;
+    }
+}
+
+// latency_value: The largest value that falls in the given bucket.
+//
+static UINT64 latency_value(int iBucket)
+{
+    if (iBucket < LATENCY_SUB_COUNT)
+    {
+        return iBucket;
+    }
+    int iShift = iBucket/LATENCY_SUB_COUNT - 1;
+    UINT64 nSub = LATENCY_SUB_COUNT + iBucket % LATENCY_SUB_COUNT;
+    return ((nSub + 1) << iShift) - 1;
+}
+
+static UINT64 latency_percentile(const LATENCY_HISTOGRAM *ph, int nPerMille)
+{
+    if (0 == ph->nCount)
+    {
+        return 0;
+    }
+
+    UINT64 nWant = (ph->nCount * nPerMille + 999)/1000;
+    UINT64 nSeen = 0;
+    for (int i = 0; i < LATENCY_BUCKETS; i++)
+    {
+        nSeen += ph->aBuckets[i];
+        if (nWant <= nSeen)
+        {
+            UINT64 n = latency_value(i);
+            return (n < ph->nMax) ? n : ph->nMax;
+        }
+    }
+    return ph->nMax;
+}
+
+/*! \brief Records one command's wall time and output.
+ *
+ * The command is named by mudstate.latency_cmd, which process_cmdent() sets
+ * for the first built-in command dispatched.  Commands which matched no
+ * built-in, such as exits, $-commands and Huh?, are gathered under (other).
+ *
+ * \param executor  Object which ran the command.
+ * \param enactor   Object which caused it.
+ * \param ltd       Wall time the command took.
+ * \param nOutput   Bytes of output it queued.
+ * \return          None.
+ */
+
+void latency_record_command(dbref executor, dbref enactor,
+    CLinearTimeDelta ltd, UINT64 nOutput)
+{
+    const UTF8 *pName = mudstate.latency_cmd;
+    if (NULL == pName)
+    {
+        pName = T("(other)");
+    }
+    size_t nName = strlen((const char *)pName);
+
+    LATENCY_COMMAND *plc = (LATENCY_COMMAND *)hashfindLEN(pName, nName,
+        &latency_htab);
+    if (NULL == plc)
+    {
+        plc = (LATENCY_COMMAND *)MEMALLOC(sizeof(LATENCY_COMMAND));
+        ISOUTOFMEMORY(plc);
+        memset(plc, 0, sizeof(LATENCY_COMMAND));
+        plc->pName = StringCloneLen(pName, nName);
+        hashaddLEN(plc->pName, nName, plc, &latency_htab);
+    }
+
+    INT64 us = ltd.ReturnMicroseconds();
+    latency_add(&plc->hWall, (0 < us) ? static_cast<UINT64>(us) : 0);
+    latency_add(&plc->hOutput, nOutput);
+    flight_record(FLIGHT_COMMAND, executor, enactor, us, pName);
+    mudstate.latency_cmd = NULL;
+}
+
+static void latency_record_queue(dbref executor, BQUE *point,
+    const CLinearTimeAbsolute &ltaBegin, const CLinearTimeAbsolute &ltaEnd)
+{
+    int i = isPlayer(point->enactor) ? 0 : 1;
+    CLinearTimeDelta ltdWait = ltaBegin - point->readytime;
+    CLinearTimeDelta ltdRun = ltaEnd - ltaBegin;
+    INT64 usWait = ltdWait.ReturnMicroseconds();
+    INT64 usRun = ltdRun.ReturnMicroseconds();
+    latency_add(&latency_queue_wait[i], (0 < usWait) ? static_cast<UINT64>(usWait) : 0);
+    latency_add(&latency_queue_run[i], (0 < usRun) ? static_cast<UINT64>(usRun) : 0);
+    flight_record(FLIGHT_QUEUE, executor, point->enactor, usRun,
+        point->comm);
+}
+
+static void latency_line(dbref player, UTF8 *buff, const UTF8 *pName,
+    const LATENCY_HISTOGRAM *ph)
+{
+    UTF8 *p = buff;
+    p += LeftJustifyString(p, 20, pName); *p++ = ' ';
+    p += RightJustifyNumber(p, 10, ph->nCount, ' '); *p++ = ' ';
+    p += RightJustifyNumber(p, 10, (0 < ph->nCount) ? ph->nSum/ph->nCount : 0, ' '); *p++ = ' ';
+    p += RightJustifyNumber(p, 10, latency_percentile(ph, 500), ' '); *p++ = ' ';
+    p += RightJustifyNumber(p, 10, latency_percentile(ph, 900), ' '); *p++ = ' ';
+    p += RightJustifyNumber(p, 10, latency_percentile(ph, 990), ' '); *p++ = ' ';
+    p += RightJustifyNumber(p, 10, ph->nMax, ' '); *p = '\0';
+    raw_notify(player, buff);
+}
+
+static bool latency_by_output;
+
+static int DCL_CDECL latency_compare(const void *pa, const void *pb)
+{
+    const LATENCY_COMMAND *a = *(const LATENCY_COMMAND * const *)pa;
+    const LATENCY_COMMAND *b = *(const LATENCY_COMMAND * const *)pb;
+    const LATENCY_HISTOGRAM *ha = latency_by_output ? &a->hOutput : &a->hWall;
+    const LATENCY_HISTOGRAM *hb = latency_by_output ? &b->hOutput : &b->hWall;
+    UINT64 na = latency_percentile(ha, 990);
+    UINT64 nb = latency_percentile(hb, 990);
+    if (na != nb)
+    {
+        return (na < nb) ? 1 : -1;
+    }
+    return strcmp((const char *)a->pName, (const char *)b->pName);
+}
+
+static void latency_commands(dbref player, UTF8 *buff, LATENCY_COMMAND **aCommands,
+    int nCommands, bool bOutput)
+{
+    latency_by_output = bOutput;
+    qsort(aCommands, nCommands, sizeof(LATENCY_COMMAND *), latency_compare);
+    for (int i = 0; i < nCommands && i < LATENCY_LIST_MAX; i++)
+    {
+        latency_line(player, buff, aCommands[i]->pName,
+            bOutput ? &aCommands[i]->hOutput : &aCommands[i]->hWall);
+    }
+    if (LATENCY_LIST_MAX < nCommands)
+    {
+        raw_notify(player, tprintf(T("(%d more not shown)"), nCommands - LATENCY_LIST_MAX));
+    }
+}
+
+/*! \brief Shows the latency histograms, worst p99 first.
+ *
+ * \param player  Who to tell.
+ * \return        None.
+ */
+
+void list_latency(dbref player)
+{
+    CLinearTimeAbsolute ltaNow;
+    ltaNow.GetUTC();
+    CLinearTimeAbsolute ltaSince = latency_since;
+    if (ltaSince < mudstate.restart_time)
+    {
+        ltaSince = mudstate.restart_time;
+    }
+    CLinearTimeDelta ltd = ltaNow - ltaSince;
+    raw_notify(player, tprintf(T("Latency over the last %s seconds."),
+        ltd.ReturnSecondsString(0)));
+
+    int nCommands = 0;
+    LATENCY_COMMAND *plc;
+    for (plc = (LATENCY_COMMAND *)hash_firstentry(&latency_htab);
+         NULL != plc;
+         plc = (LATENCY_COMMAND *)hash_nextentry(&latency_htab))
+    {
+        nCommands++;
+    }
+
+    LATENCY_COMMAND **aCommands = NULL;
+    if (0 < nCommands)
+    {
+        aCommands = (LATENCY_COMMAND **)MEMALLOC(nCommands * sizeof(LATENCY_COMMAND *));
+        ISOUTOFMEMORY(aCommands);
+        int i = 0;
+        for (plc = (LATENCY_COMMAND *)hash_firstentry(&latency_htab);
+             NULL != plc && i < nCommands;
+             plc = (LATENCY_COMMAND *)hash_nextentry(&latency_htab))
+        {
+            aCommands[i++] = plc;
+        }
+    }
+
+    UTF8 *buff = alloc_lbuf("list_latency");
+    raw_notify(player, T("Command wall (us)         Count       Mean        p50        p90        p99        Max"));
+    latency_commands(player, buff, aCommands, nCommands, false);
+
+    raw_notify(player, T("Queue entry (us)          Count       Mean        p50        p90        p99        Max"));
+    latency_line(player, buff, T("player wait"), &latency_queue_wait[0]);
+    latency_line(player, buff, T("player run"),  &latency_queue_run[0]);
+    latency_line(player, buff, T("object wait"), &latency_queue_wait[1]);
+    latency_line(player, buff, T("object run"),  &latency_queue_run[1]);
+
+    raw_notify(player, T("Command output (bytes)    Count       Mean        p50        p90        p99        Max"));
+    latency_commands(player, buff, aCommands, nCommands, true);
+    free_lbuf(buff);
+
+    if (NULL != aCommands)
+    {
+        MEMFREE(aCommands);
+    }
+}
+
+/*! \brief Discards every latency histogram.
+ *
+ * \param player  Who to tell.
+ * \return        None.
+ */
+
+void latency_reset(dbref player)
+{
+    LATENCY_COMMAND *plc;
+    for (plc = (LATENCY_COMMAND *)hash_firstentry(&latency_htab);
+         NULL != plc;
+         plc = (LATENCY_COMMAND *)hash_nextentry(&latency_htab))
+    {
+        MEMFREE(plc->pName);
+        MEMFREE(plc);
+    }
+    hashflush(&latency_htab);
+
+    memset(latency_queue_wait, 0, sizeof(latency_queue_wait));
+    memset(latency_queue_run, 0, sizeof(latency_queue_run));
+    latency_since.GetUTC();
+    raw_notify(player, T("Latency histograms reset."));
+}
+
 // ---------------------------------------------------------------------------
 // add_to: Adjust an object's queue or semaphore count.
 //
@@ -87,9 +384,12 @@ static void Task_RunQueueEntry(void *pEntry, int iUnused)
     BQUE *point = (BQUE *)pEntry;
     dbref executor = point->executor;
 
+    pool_arena_open();
     if (  Good_obj(executor)
        && !Going(executor))
     {
+        CLinearTimeAbsolute ltaStart;
+        ltaStart.GetUTC();
         giveto(executor, mudconf.waitcost);
         mudstate.curr_enactor = point->enactor;
         mudstate.curr_executor = executor;
@@ -160,6 +460,8 @@ static void Task_RunQueueEntry(void *pEntry, int iUnused)
                         mudstate.poutobj = NOTHING;
                     }
 
+                    mudstate.latency_cmd = NULL;
+                    UINT64 nOutputBegin = mudstate.output_bytes;
                     CLinearTimeAbsolute ltaBegin;
                     ltaBegin.GetUTC();
                     MuxAlarm.Set(mudconf.max_cmdsecs);
@@ -186,6 +488,8 @@ static void Task_RunQueueEntry(void *pEntry, int iUnused)
                     db[executor].cpu_time_used += ltd;
 
                     ltd = ltaEnd - ltaBegin;
+                    latency_record_command(executor, point->enactor, ltd,
+                        mudstate.output_bytes - nOutputBegin);
                     if (mudconf.rpt_cmdsecs < ltd)
                     {
                         STARTLOG(LOG_PROBLEMS, "CMD", "CPU");
@@ -227,6 +531,10 @@ static void Task_RunQueueEntry(void *pEntry, int iUnused)
             mudstate.inpipe = false;
             mudstate.poutobj = NOTHING;
         }
+
+        CLinearTimeAbsolute ltaFinish;
+        ltaFinish.GetUTC();
+        latency_record_queue(executor, point, ltaStart, ltaFinish);
     }
 
     for (int i = 0; i < MAX_GLOBAL_REGS; i++)
@@ -252,6 +560,7 @@ static void Task_RunQueueEntry(void *pEntry, int iUnused)
         mudstate.pResultsSet = NULL;
     }
 #endif // STUB_SLAVE
+    pool_arena_close();
 
     MEMFREE(point->text);
     point->text = NULL;
@@ -281,6 +590,7 @@ static void Task_SemaphoreTimeout(void *pExpired, int iUnused)
     BQUE *point = (BQUE *)pExpired;
     add_to(point->u.s.sem, -1, point->u.s.attr);
     point->u.s.sem = NOTHING;
+    point->readytime = point->waittime;
     Task_RunQueueEntry(point, 0);
 }
 
@@ -516,6 +826,7 @@ static int CallBack_NotifySemaphoreDrainOrAll(PTASK_RECORD p)
                 }
                 p->ltaWhen.GetUTC();
                 p->fpTask = Task_RunQueueEntry;
+                point->readytime = p->ltaWhen;
                 return IU_UPDATE_TASK;
             }
         }
@@ -559,6 +870,7 @@ static int CallBack_NotifySemaphoreFirst(PTASK_RECORD p)
             }
             p->ltaWhen.GetUTC();
             p->fpTask = Task_RunQueueEntry;
+            point->readytime = p->ltaWhen;
             return IU_UPDATE_TASK;
         }
     }
@@ -852,6 +1164,7 @@ static BQUE *setup_que
     //
     tmp->executor = executor;
     tmp->IsTimed = false;
+    tmp->readytime.GetUTC();
     tmp->u.s.sem = NOTHING;
     tmp->u.s.attr = 0;
     tmp->enactor = enactor;
@@ -907,6 +1220,10 @@ void wait_que
 
     tmp->IsTimed = bTimed;
     tmp->waittime = ltaWhen;
+    if (bTimed)
+    {
+        tmp->readytime = ltaWhen;
+    }
     tmp->u.s.sem = sem;
     tmp->u.s.attr = attr;
 
@@ -960,6 +1277,7 @@ static int CallBack_QueryComplete(PTASK_RECORD p)
             p->iPriority = PRIORITY_OBJECT;
             p->ltaWhen.GetUTC();
             p->fpTask    = Task_RunQueueEntry;
+            point->readytime = p->ltaWhen;
 
             point->u.s.sem    = NOTHING;
             point->u.s.attr   = 0;
@@ -1537,6 +1855,7 @@ static int CallBack_Warp(PTASK_RECORD p)
         if (point->IsTimed)
         {
             point->waittime -= ltdWarp;
+            point->readytime -= ltdWarp;
             p->ltaWhen -= ltdWarp;
             return IU_UPDATE_TASK;
         }
@@ -231,8 +231,8 @@ static void link_exit(dbref player, dbref exit, dbref dest)
         giveto(Owner(exit), mudconf.opencost);
         add_quota(Owner(exit), quot);
         s_Owner(exit, Owner(player));
-        db[exit].fs.word[FLAG_WORD1] &= ~(INHERIT | WIZARD);
-        db[exit].fs.word[FLAG_WORD1] |= HALT;
+        s_Flags(exit, FLAG_WORD1, Flags(exit) & ~(INHERIT | WIZARD));
+        s_Flags(exit, FLAG_WORD1, Flags(exit) | HALT);
     }
 
     // Link has been validated and paid for, do it and tell the player
@@ -1212,7 +1212,7 @@ void do_destroy(dbref executor, dbref caller, dbref enactor, int eval, int key,
 
         case TYPE_PLAYER:
             atr_add_raw(thing, A_DESTROYER, mux_ltoa_t(executor));
-            if (!atr_get_raw(thing, A_DESTROYER))
+            if (!atr_exists(thing, A_DESTROYER))
             {
                 // Not a likely situation, but the player has too many
                 // attributes to remember it's destroyer, so we we need to
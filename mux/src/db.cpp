@@ -275,6 +275,10 @@ void fwdlist_set(dbref thing, FWDLIST *ifp)
         return;
     }
 
+    // The new list may name something already GOING.
+    //
+    mudstate.bfDbckDirty.Set(thing);
+
     // Copy input forwardlist to a correctly-sized buffer.
     //
 
@@ -1404,9 +1408,15 @@ void anum_extend(int newtop)
     }
 
     int i;
-    ATTR **anum_table2 = (ATTR **) MEMALLOC((newtop + 1) * sizeof(ATTR *));
+    size_t nTable = (newtop + 1) * sizeof(ATTR *);
+    ATTR **anum_table2 = (ATTR **) MEMALLOC(nTable);
     if (NULL != anum_table2)
     {
+        if (FLIGHT_BIG_ALLOC <= nTable)
+        {
+            flight_record(FLIGHT_ALLOC, NOTHING, NOTHING, nTable, T("anum_extend"));
+        }
+
         for (i = anum_alc_top + 1; i <= newtop; i++)
         {
             anum_table2[i] = NULL;
@@ -2024,12 +2034,188 @@ static void atr_decode_LEN(const UTF8 *iattr, size_t nLen, UTF8 *oattr,
     }
 }
 
+// ---------------------------------------------------------------------------
+// Interned attribute values.
+//
+// Objects cloned from the same template carry many identical attribute
+// values, so each distinct stored value is kept once and shared by every
+// ATRLIST entry which has it.  An ATR_VALUE header in front of the value
+// holds its reference count.  mudstate.atr_value_htab is keyed by the CRC32 of the
+// stored bytes and leads to a chain of the values with that CRC32, and the
+// bytes themselves are compared before a value is shared.
+//
+// A shared value is never changed in place.  Setting an attribute interns
+// the new value and releases the old one.
+//
+#ifdef MEMORY_BASED
+
+typedef struct atr_value ATR_VALUE;
+struct atr_value
+{
+    ATR_VALUE *pNext;   // Next value with the same nHash.
+    UINT32     nHash;
+    UINT32     nRefs;
+    size_t     nSize;   // Stored size, including the NUL.
+    bool       bListed; // Reachable through mudstate.atr_value_htab.
+};
+
+static size_t atr_value_refs  = 0;  // ATRLIST entries.
+static size_t atr_value_count = 0;  // Distinct values.
+static UINT64 atr_value_bytes = 0;  // Stored bytes if nothing were shared.
+static UINT64 atr_value_held  = 0;  // Stored bytes of distinct values.
+
+/*! \brief Finds or adds the shared copy of a stored attribute value.
+ *
+ * \param pValue  Stored value.  pValue[nSize-1] is not read.
+ * \param nSize   Stored size, including the terminating NUL.
+ * \return        Shared copy, NUL-terminated, with a reference added.
+ */
+
+static UTF8 *atr_value_intern(const UTF8 *pValue, size_t nSize)
+{
+    UINT32 nHash = CRC32_ProcessBuffer(0, pValue, nSize - 1);
+    ATR_VALUE *pHead = (ATR_VALUE *)hashfindLEN(&nHash, sizeof(nHash),
+        &mudstate.atr_value_htab);
+
+    atr_value_refs++;
+    atr_value_bytes += nSize;
+
+    ATR_VALUE *pv;
+    for (pv = pHead; NULL != pv; pv = pv->pNext)
+    {
+        if (  nSize == pv->nSize
+           && memcmp(pv + 1, pValue, nSize - 1) == 0)
+        {
+            pv->nRefs++;
+            return (UTF8 *)(pv + 1);
+        }
+    }
+
+    pv = (ATR_VALUE *)MEMALLOC(sizeof(ATR_VALUE) + nSize);
+    ISOUTOFMEMORY(pv);
+    pv->pNext = pHead;
+    pv->nHash = nHash;
+    pv->nRefs = 1;
+    pv->nSize = nSize;
+
+    UTF8 *p = (UTF8 *)(pv + 1);
+    memcpy(p, pValue, nSize - 1);
+    p[nSize - 1] = '\0';
+
+    if (NULL == pHead)
+    {
+        pv->bListed = hashaddLEN(&nHash, sizeof(nHash), pv, &mudstate.atr_value_htab);
+    }
+    else
+    {
+        pv->bListed = hashreplLEN(&nHash, sizeof(nHash), pv, &mudstate.atr_value_htab);
+    }
+
+    // If the value could not be listed, it is still good, but it is not
+    // shared.
+    //
+    if (!pv->bListed)
+    {
+        pv->pNext = NULL;
+    }
+    atr_value_count++;
+    atr_value_held += nSize;
+    return p;
+}
+
+// atr_value_release: Drop one reference to a value from atr_value_intern().
+//
+static void atr_value_release(UTF8 *p)
+{
+    ATR_VALUE *pv = ((ATR_VALUE *)p) - 1;
+    atr_value_refs--;
+    atr_value_bytes -= pv->nSize;
+    if (0 < --pv->nRefs)
+    {
+        return;
+    }
+
+    if (pv->bListed)
+    {
+        UINT32 nHash = pv->nHash;
+        ATR_VALUE *pHead = (ATR_VALUE *)hashfindLEN(&nHash, sizeof(nHash),
+            &mudstate.atr_value_htab);
+        if (pHead == pv)
+        {
+            if (NULL == pv->pNext)
+            {
+                hashdeleteLEN(&nHash, sizeof(nHash), &mudstate.atr_value_htab);
+            }
+            else
+            {
+                hashreplLEN(&nHash, sizeof(nHash), pv->pNext, &mudstate.atr_value_htab);
+            }
+        }
+        else
+        {
+            ATR_VALUE *pPrev = pHead;
+            while (pPrev->pNext != pv)
+            {
+                pPrev = pPrev->pNext;
+            }
+            pPrev->pNext = pv->pNext;
+        }
+    }
+    atr_value_count--;
+    atr_value_held -= pv->nSize;
+    MEMFREE(pv);
+}
+
+#endif // MEMORY_BASED
+
+// ---------------------------------------------------------------------------
+// list_memory: Report how attribute values are held.
+//
+void list_memory(dbref player)
+{
+#ifdef MEMORY_BASED
+    raw_notify(player, tprintf(T("Attribute values: %u set, %u distinct."),
+        static_cast<unsigned int>(atr_value_refs),
+        static_cast<unsigned int>(atr_value_count)));
+
+    UTF8 *buff = alloc_mbuf("list_memory");
+    UTF8 *p = buff;
+    safe_mb_str(T("Attribute bytes:  "), buff, &p);
+    p += mux_ui64toa(atr_value_bytes, p);
+    safe_mb_str(T(" set, "), buff, &p);
+    p += mux_ui64toa(atr_value_held, p);
+    safe_mb_str(T(" held."), buff, &p);
+    *p = '\0';
+    raw_notify(player, buff);
+
+    if (0 < atr_value_held)
+    {
+        UINT64 nRatio = (100*atr_value_bytes + atr_value_held/2)/atr_value_held;
+        mux_sprintf(buff, MBUF_SIZE, T("Dedup ratio:      %u.%02u to 1"),
+            static_cast<unsigned int>(nRatio/100),
+            static_cast<unsigned int>(nRatio%100));
+        raw_notify(player, buff);
+    }
+    free_mbuf(buff);
+#else // MEMORY_BASED
+    size_t nCache;
+    INT64 nEvictions;
+    cache_stats(&nCache, &nEvictions);
+    raw_notify(player, T("Attribute values are held in the attribute database."));
+    raw_notify(player, tprintf(T("Attribute cache:  %u bytes, %u evictions."),
+        static_cast<unsigned int>(nCache),
+        static_cast<unsigned int>(nEvictions)));
+#endif // MEMORY_BASED
+}
+
 /* ---------------------------------------------------------------------------
  * atr_clr: clear an attribute in the list.
  */
 
 void atr_clr(dbref thing, int atr)
 {
+    cmdcache_clear(thing);
+
 #ifdef MEMORY_BASED
 
     if (  !db[thing].nALUsed
@@ -2059,7 +2245,7 @@ void atr_clr(dbref thing, int atr)
         }
         else // (list[mid].number == atr)
         {
-            MEMFREE(list[mid].data);
+            atr_value_release(list[mid].data);
             list[mid].data = NULL;
             db[thing].nALUsed--;
             if (mid != db[thing].nALUsed)
@@ -2083,17 +2269,17 @@ void atr_clr(dbref thing, int atr)
     {
     case A_STARTUP:
 
-        db[thing].fs.word[FLAG_WORD1] &= ~HAS_STARTUP;
+        s_Flags(thing, FLAG_WORD1, Flags(thing) & ~HAS_STARTUP);
         break;
 
     case A_DAILY:
 
-        db[thing].fs.word[FLAG_WORD2] &= ~HAS_DAILY;
+        s_Flags(thing, FLAG_WORD2, Flags2(thing) & ~HAS_DAILY);
         break;
 
     case A_FORWARDLIST:
 
-        db[thing].fs.word[FLAG_WORD2] &= ~HAS_FWDLIST;
+        s_Flags(thing, FLAG_WORD2, Flags2(thing) & ~HAS_FWDLIST);
         if (!mudstate.bStandAlone)
         {
             // We should clear the hashtable, too.
@@ -2104,7 +2290,7 @@ void atr_clr(dbref thing, int atr)
 
     case A_LISTEN:
 
-        db[thing].fs.word[FLAG_WORD2] &= ~HAS_LISTEN;
+        s_Flags(thing, FLAG_WORD2, Flags2(thing) & ~HAS_LISTEN);
         break;
 
     case A_TIMEOUT:
@@ -2128,6 +2314,286 @@ void atr_clr(dbref thing, int atr)
     }
 }
 
+// ---------------------------------------------------------------------------
+// Attribute compression.
+//
+// Values of at least attr_compress_size bytes are stored compressed with a
+// small LZ77 codec in the manner of LZ4.  Each sequence is a token byte
+// holding a count of literals and a match length, the literals, and a
+// two-byte offset back into what has already been decoded.  Counts which do
+// not fit in four bits continue in following bytes of up to 255 each.  The
+// last sequence has literals only.
+//
+// A stored value which begins with ATR_PACKED_0 and ATR_PACKED_1 is
+// compressed, and the next two bytes give its length once expanded.  0xFF
+// never appears in UTF-8, and a plain value has a NUL in its second byte
+// only when it is one character long, which is too short to compress.  Like
+// a plain value, a compressed one ends with a NUL, which the attribute file
+// depends on.
+//
+#define ATR_PACKED_0        0xFF
+#define ATR_PACKED_1        0x00
+#define ATR_PACKED_HEADER   4
+#define LZ_MIN_MATCH        4
+#define LZ_HASH_BITS        12
+#define LZ_MAX_OFFSET       0xFFFF
+
+static UTF8 atr_pack_buffer[LBUF_SIZE];
+static UTF8 atr_unpack_buffer[LBUF_SIZE];
+
+static inline UINT32 lz_read32(const UTF8 *p)
+{
+    UINT32 n;
+    memcpy(&n, p, sizeof(n));
+    return n;
+}
+
+// lz_count: Append a count which did not fit in its token.
+//
+static bool lz_count(size_t n, UTF8 *pOut, size_t &iOut, size_t nOut)
+{
+    while (255 <= n)
+    {
+        if (nOut <= iOut)
+        {
+            return false;
+        }
+        pOut[iOut++] = 255;
+        n -= 255;
+    }
+    if (nOut <= iOut)
+    {
+        return false;
+    }
+    pOut[iOut++] = static_cast<UTF8>(n);
+    return true;
+}
+
+// lz_sequence: Append the literals from pLit and then, unless nMatch is zero,
+// a match of nMatch bytes at nOffset back.
+//
+static bool lz_sequence(const UTF8 *pLit, size_t nLit, size_t nOffset,
+    size_t nMatch, UTF8 *pOut, size_t &iOut, size_t nOut)
+{
+    if (nOut <= iOut)
+    {
+        return false;
+    }
+    size_t iToken = iOut++;
+    UTF8 token = static_cast<UTF8>(((nLit < 15) ? nLit : 15) << 4);
+    if (  15 <= nLit
+       && !lz_count(nLit - 15, pOut, iOut, nOut))
+    {
+        return false;
+    }
+    if (nOut - iOut < nLit)
+    {
+        return false;
+    }
+    memcpy(pOut + iOut, pLit, nLit);
+    iOut += nLit;
+
+    if (0 < nMatch)
+    {
+        size_t nCode = nMatch - LZ_MIN_MATCH;
+        token |= static_cast<UTF8>((nCode < 15) ? nCode : 15);
+        if (nOut - iOut < 2)
+        {
+            return false;
+        }
+        pOut[iOut++] = static_cast<UTF8>(nOffset & 0xFF);
+        pOut[iOut++] = static_cast<UTF8>(nOffset >> 8);
+        if (  15 <= nCode
+           && !lz_count(nCode - 15, pOut, iOut, nOut))
+        {
+            return false;
+        }
+    }
+    pOut[iToken] = token;
+    return true;
+}
+
+/*! \brief Compresses an attribute value.
+ *
+ * \param pIn   Value to compress.
+ * \param nIn   Its length, less than LBUF_SIZE.
+ * \param pOut  Where to put the stored form.
+ * \param nOut  Size of pOut.  Nothing longer is produced.
+ * \return      Length of the stored form including its NUL, or 0 if it
+ *              would not fit.
+ */
+
+static size_t atr_pack(const UTF8 *pIn, size_t nIn, UTF8 *pOut, size_t nOut)
+{
+    if (nOut < ATR_PACKED_HEADER)
+    {
+        return 0;
+    }
+    pOut[0] = ATR_PACKED_0;
+    pOut[1] = ATR_PACKED_1;
+    pOut[2] = static_cast<UTF8>(nIn & 0xFF);
+    pOut[3] = static_cast<UTF8>(nIn >> 8);
+    size_t iOut = ATR_PACKED_HEADER;
+
+    int aHash[1 << LZ_HASH_BITS];
+    memset(aHash, 0xFF, sizeof(aHash));
+
+    size_t iAnchor = 0;
+    size_t iIn = 0;
+    while (iIn + LZ_MIN_MATCH <= nIn)
+    {
+        UINT32 n = lz_read32(pIn + iIn);
+        UINT32 h = (n * 2654435761U) >> (32 - LZ_HASH_BITS);
+        int iCandidate = aHash[h];
+        aHash[h] = static_cast<int>(iIn);
+
+        if (  0 <= iCandidate
+           && iIn - iCandidate <= LZ_MAX_OFFSET
+           && lz_read32(pIn + iCandidate) == n)
+        {
+            size_t nMatch = LZ_MIN_MATCH;
+            while (  iIn + nMatch < nIn
+                  && pIn[iCandidate + nMatch] == pIn[iIn + nMatch])
+            {
+                nMatch++;
+            }
+
+            if (!lz_sequence(pIn + iAnchor, iIn - iAnchor, iIn - iCandidate,
+                     nMatch, pOut, iOut, nOut))
+            {
+                return 0;
+            }
+            iIn += nMatch;
+            iAnchor = iIn;
+        }
+        else
+        {
+            iIn++;
+        }
+    }
+
+    if (  !lz_sequence(pIn + iAnchor, nIn - iAnchor, 0, 0, pOut, iOut, nOut)
+       || nOut <= iOut)
+    {
+        return 0;
+    }
+    pOut[iOut++] = '\0';
+    return iOut;
+}
+
+/*! \brief Expands a stored attribute value if it was compressed.
+ *
+ * A compressed value is expanded into a static buffer which is reused by the
+ * next call, the same as a value read from the attribute file.
+ *
+ * \param pStored  Value as stored.
+ * \param nStored  Its stored size, including the terminating NUL.
+ * \param pLen     Length of the value returned.
+ * \return         The value, or NULL if it could not be expanded.
+ */
+
+static const UTF8 *atr_unpack(const UTF8 *pStored, size_t nStored, size_t *pLen)
+{
+    if (  nStored <= ATR_PACKED_HEADER
+       || ATR_PACKED_0 != pStored[0]
+       || ATR_PACKED_1 != pStored[1])
+    {
+        *pLen = nStored - 1;
+        return pStored;
+    }
+
+    size_t nOut = pStored[2] | (static_cast<size_t>(pStored[3]) << 8);
+    size_t nEnd = nStored - 1;
+    UTF8 *pOut = atr_unpack_buffer;
+    size_t iOut = 0;
+    size_t iIn = ATR_PACKED_HEADER;
+    while (  nOut < LBUF_SIZE
+          && iIn < nEnd)
+    {
+        unsigned int token = pStored[iIn++];
+
+        size_t nLit = token >> 4;
+        if (15 == nLit)
+        {
+            UTF8 ch;
+            do
+            {
+                if (nEnd <= iIn)
+                {
+                    goto Corrupt;
+                }
+                ch = pStored[iIn++];
+                nLit += ch;
+            } while (255 == ch);
+        }
+        if (  nEnd - iIn < nLit
+           || nOut - iOut < nLit)
+        {
+            goto Corrupt;
+        }
+        memcpy(pOut + iOut, pStored + iIn, nLit);
+        iIn  += nLit;
+        iOut += nLit;
+        if (nEnd == iIn)
+        {
+            break;
+        }
+
+        if (nEnd - iIn < 2)
+        {
+            goto Corrupt;
+        }
+        size_t nOffset = pStored[iIn] | (static_cast<size_t>(pStored[iIn+1]) << 8);
+        iIn += 2;
+
+        size_t nMatch = token & 15;
+        if (15 == nMatch)
+        {
+            UTF8 ch;
+            do
+            {
+                if (nEnd <= iIn)
+                {
+                    goto Corrupt;
+                }
+                ch = pStored[iIn++];
+                nMatch += ch;
+            } while (255 == ch);
+        }
+        nMatch += LZ_MIN_MATCH;
+        if (  0 == nOffset
+           || iOut < nOffset
+           || nOut - iOut < nMatch)
+        {
+            goto Corrupt;
+        }
+
+        // The match may overlap what it is copying, so go byte by byte.
+        //
+        const UTF8 *pMatch = pOut + iOut - nOffset;
+        for (size_t i = 0; i < nMatch; i++)
+        {
+            pOut[iOut + i] = pMatch[i];
+        }
+        iOut += nMatch;
+    }
+
+    if (  nOut < LBUF_SIZE
+       && iOut == nOut)
+    {
+        pOut[nOut] = '\0';
+        *pLen = nOut;
+        return pOut;
+    }
+
+Corrupt:
+    STARTLOG(LOG_PROBLEMS, "BUG", "ATTR");
+    log_text(T("Compressed attribute value is damaged."));
+    ENDLOG;
+    *pLen = 0;
+    return NULL;
+}
+
 /* ---------------------------------------------------------------------------
  * atr_add_raw, atr_add: add attribute of type atr to list
  */
@@ -2140,10 +2606,36 @@ void atr_add_raw_LEN(dbref thing, int atr, const UTF8 *szValue, size_t nValue)
         atr_clr(thing, atr);
         return;
     }
+    cmdcache_clear(thing);
+
+#ifndef MEMORY_BASED
+    if (nValue > LBUF_SIZE-1)
+    {
+        nValue = LBUF_SIZE-1;
+    }
+#endif // MEMORY_BASED
+
+    // Large values are stored compressed when that makes them smaller.
+    // A_LIST is read and rewritten constantly, so it stays plain.
+    //
+    const UTF8 *pStored = szValue;
+    size_t nStored = nValue + 1;
+    if (  A_LIST != atr
+       && 0 < mudconf.attr_compress_size
+       && static_cast<size_t>(mudconf.attr_compress_size) <= nValue
+       && nValue < LBUF_SIZE)
+    {
+        size_t nPacked = atr_pack(szValue, nValue, atr_pack_buffer, nValue);
+        if (0 < nPacked)
+        {
+            pStored = atr_pack_buffer;
+            nStored = nPacked;
+        }
+    }
 
 #ifdef MEMORY_BASED
     ATRLIST *list = db[thing].pALHead;
-    UTF8 *text = StringCloneLen(szValue, nValue);
+    UTF8 *text = atr_value_intern(pStored, nStored);
 
     if (!list)
     {
@@ -2154,7 +2646,7 @@ void atr_add_raw_LEN(dbref thing, int atr, const UTF8 *szValue, size_t nValue)
         db[thing].nALUsed  = 1;
         list[0].number = atr;
         list[0].data = text;
-        list[0].size = nValue + 1;
+        list[0].size = nStored;
     }
     else
     {
@@ -2188,9 +2680,9 @@ void atr_add_raw_LEN(dbref thing, int atr, const UTF8 *szValue, size_t nValue)
                 }
                 else // if (list[mid].number == atr)
                 {
-                    MEMFREE(list[mid].data);
+                    atr_value_release(list[mid].data);
                     list[mid].data = text;
-                    list[mid].size = nValue + 1;
+                    list[mid].size = nStored;
                     goto FoundAttribute;
                 }
             }
@@ -2240,25 +2732,20 @@ void atr_add_raw_LEN(dbref thing, int atr, const UTF8 *szValue, size_t nValue)
         db[thing].nALUsed++;
         list[lo].data = text;
         list[lo].number = atr;
-        list[lo].size = nValue + 1;
+        list[lo].size = nStored;
     }
 
 FoundAttribute:
 
 #else // MEMORY_BASED
 
-    if (nValue > LBUF_SIZE-1)
-    {
-        nValue = LBUF_SIZE-1;
-    }
-
     Aname okey;
     makekey(thing, atr, &okey);
     if (atr == A_LIST)
     {
         // A_LIST is never compressed and it's never listed within itself.
         //
-        cache_put(&okey, szValue, nValue+1);
+        cache_put(&okey, pStored, nStored);
     }
     else
     {
@@ -2266,7 +2753,7 @@ FoundAttribute:
         {
             return;
         }
-        cache_put(&okey, szValue, nValue+1);
+        cache_put(&okey, pStored, nStored);
     }
 #endif // MEMORY_BASED
 
@@ -2274,22 +2761,22 @@ FoundAttribute:
     {
     case A_STARTUP:
 
-        db[thing].fs.word[FLAG_WORD1] |= HAS_STARTUP;
+        s_Flags(thing, FLAG_WORD1, Flags(thing) | HAS_STARTUP);
         break;
 
     case A_DAILY:
 
-        db[thing].fs.word[FLAG_WORD2] |= HAS_DAILY;
+        s_Flags(thing, FLAG_WORD2, Flags2(thing) | HAS_DAILY);
         break;
 
     case A_FORWARDLIST:
 
-        db[thing].fs.word[FLAG_WORD2] |= HAS_FWDLIST;
+        s_Flags(thing, FLAG_WORD2, Flags2(thing) | HAS_FWDLIST);
         break;
 
     case A_LISTEN:
 
-        db[thing].fs.word[FLAG_WORD2] |= HAS_LISTEN;
+        s_Flags(thing, FLAG_WORD2, Flags2(thing) | HAS_LISTEN);
         break;
 
     case A_TIMEOUT:
@@ -2373,11 +2860,15 @@ int get_atr(const UTF8 *name)
     return ap->number;
 }
 
+// atr_get_stored_LEN: Returns a value as it is stored, which may still be
+// compressed.
+//
 #ifdef MEMORY_BASED
-const UTF8 *atr_get_raw_LEN(dbref thing, int atr, size_t *pLen)
+static const UTF8 *atr_get_stored_LEN(dbref thing, int atr, size_t *pLen)
 {
     if (!Good_obj(thing))
     {
+        *pLen = 0;
         return NULL;
     }
 
@@ -2386,6 +2877,7 @@ const UTF8 *atr_get_raw_LEN(dbref thing, int atr, size_t *pLen)
     ATRLIST *list = db[thing].pALHead;
     if (!list)
     {
+        *pLen = 0;
         return NULL;
     }
 
@@ -2405,7 +2897,7 @@ const UTF8 *atr_get_raw_LEN(dbref thing, int atr, size_t *pLen)
         }
         else // if (list[mid].number == atr)
         {
-            *pLen = list[mid].size - 1;
+            *pLen = list[mid].size;
             return list[mid].data;
         }
     }
@@ -2415,19 +2907,40 @@ const UTF8 *atr_get_raw_LEN(dbref thing, int atr, size_t *pLen)
 
 #else // MEMORY_BASED
 
-const UTF8 *atr_get_raw_LEN(dbref thing, int atr, size_t *pLen)
+static const UTF8 *atr_get_stored_LEN(dbref thing, int atr, size_t *pLen)
 {
     Aname okey;
 
     makekey(thing, atr, &okey);
-    size_t nLen;
-    const UTF8 *a = cache_get(&okey, &nLen);
-    nLen = a ? (nLen-1) : 0;
-    *pLen = nLen;
+    const UTF8 *a = cache_get(&okey, pLen);
+    if (NULL == a)
+    {
+        *pLen = 0;
+    }
     return a;
 }
 #endif // MEMORY_BASED
 
+const UTF8 *atr_get_raw_LEN(dbref thing, int atr, size_t *pLen)
+{
+    size_t nLen;
+    const UTF8 *a = atr_get_stored_LEN(thing, atr, &nLen);
+    if (NULL == a)
+    {
+        *pLen = 0;
+        return NULL;
+    }
+    return atr_unpack(a, nLen, pLen);
+}
+
+// atr_exists: Tells whether thing has attribute atr without expanding it.
+//
+bool atr_exists(dbref thing, int atr)
+{
+    size_t nLen;
+    return (NULL != atr_get_stored_LEN(thing, atr, &nLen));
+}
+
 const UTF8 *atr_get_raw(dbref thing, int atr)
 {
     size_t Len;
@@ -2578,9 +3091,14 @@ bool atr_pget_info(dbref thing, int atr, dbref *owner, int *flags)
 
 void atr_free(dbref thing)
 {
+    cmdcache_clear(thing);
 #ifdef MEMORY_BASED
     if (db[thing].pALHead)
     {
+        for (int i = 0; i < db[thing].nALUsed; i++)
+        {
+            atr_value_release(db[thing].pALHead[i].data);
+        }
         MEMFREE(db[thing].pALHead);
     }
     db[thing].pALHead  = NULL;
@@ -2896,6 +3414,365 @@ bool attr_info::get_info(bool bParent)
     return bHasAttr;
 }
 
+/* ---------------------------------------------------------------------------
+ * Reverse indexes: objects by parent, owner, zone, entrance target, and type.
+ *
+ * The lists are built by rx_build() once the whole database is loaded, and
+ * from then on the setters below keep them current.  Objects at or above
+ * db_top are still being initialized by db_grow() and are left alone until
+ * it links them.
+ */
+
+static bool  rx_enabled = false;
+static dbref rx_type_head[TYPE_MASK+1];
+static int   rx_count[TYPE_MASK+1][2];
+
+static dbref rx_key(dbref thing, int ix)
+{
+    dbref key;
+    switch (ix)
+    {
+    case RX_PARENT:
+        key = db[thing].parent;
+        break;
+
+    case RX_OWNER:
+        key = db[thing].owner;
+        break;
+
+    case RX_ZONE:
+        key = db[thing].zone;
+        break;
+
+    case RX_ENTRANCE:
+        switch (Typeof(thing))
+        {
+        case TYPE_EXIT:
+        case TYPE_ROOM:
+            key = db[thing].location;
+            break;
+
+        case TYPE_PLAYER:
+        case TYPE_THING:
+            key = db[thing].link;
+            break;
+
+        default:
+            key = NOTHING;
+            break;
+        }
+        break;
+
+    default:
+        return Typeof(thing);
+    }
+    return Good_dbref(key) ? key : NOTHING;
+}
+
+static dbref *rx_head(int ix, dbref key)
+{
+    if (RX_TYPE == ix)
+    {
+        return &rx_type_head[key];
+    }
+    return &db[key].rx[ix].head;
+}
+
+static void rx_unlink(dbref thing, int ix)
+{
+    RXLINK *p = &db[thing].rx[ix];
+    if (NOTHING == p->key)
+    {
+        return;
+    }
+
+    if (NOTHING == p->prev)
+    {
+        *rx_head(ix, p->key) = p->next;
+    }
+    else
+    {
+        db[p->prev].rx[ix].next = p->next;
+    }
+    if (NOTHING != p->next)
+    {
+        db[p->next].rx[ix].prev = p->prev;
+    }
+    p->key  = NOTHING;
+    p->next = NOTHING;
+    p->prev = NOTHING;
+}
+
+static void rx_link(dbref thing, int ix, dbref key)
+{
+    if (NOTHING == key)
+    {
+        return;
+    }
+
+    RXLINK *p = &db[thing].rx[ix];
+    dbref *ph = rx_head(ix, key);
+    p->key  = key;
+    p->prev = NOTHING;
+    p->next = *ph;
+    if (NOTHING != *ph)
+    {
+        db[*ph].rx[ix].prev = thing;
+    }
+    *ph = thing;
+}
+
+static void rx_refresh(dbref thing, int ix)
+{
+    if (  rx_enabled
+       && thing < mudstate.db_top)
+    {
+        dbref key = rx_key(thing, ix);
+        if (key != db[thing].rx[ix].key)
+        {
+            rx_unlink(thing, ix);
+            rx_link(thing, ix, key);
+        }
+    }
+}
+
+static void rx_clear(dbref thing)
+{
+    for (int ix = 0; ix < NUM_RX; ix++)
+    {
+        RXLINK *p = &db[thing].rx[ix];
+        p->key  = NOTHING;
+        p->head = NOTHING;
+        p->next = NOTHING;
+        p->prev = NOTHING;
+    }
+}
+
+static void rx_add(dbref thing)
+{
+    for (int ix = 0; ix < NUM_RX; ix++)
+    {
+        rx_link(thing, ix, rx_key(thing, ix));
+    }
+    FLAG f = Flags(thing);
+    rx_count[f & TYPE_MASK][(f & GOING) ? 1 : 0]++;
+}
+
+/*! \brief Builds the reverse indexes over the loaded database.
+ *
+ * Called once the database is loaded.  Walking backwards leaves every list
+ * in dbref order to start with.
+ *
+ * \return  None.
+ */
+
+void rx_build(void)
+{
+    int i;
+    for (i = 0; i <= TYPE_MASK; i++)
+    {
+        rx_type_head[i] = NOTHING;
+        rx_count[i][0] = 0;
+        rx_count[i][1] = 0;
+    }
+
+    dbref thing;
+    DO_WHOLE_DB(thing)
+    {
+        rx_clear(thing);
+    }
+    DO_WHOLE_DB_BACKWARDS(thing)
+    {
+        rx_add(thing);
+    }
+    rx_enabled = true;
+}
+
+/*! \brief First object listed under a key.
+ *
+ * \param ix   Which index (RX_PARENT, RX_OWNER, ...).
+ * \param key  Object, or for RX_TYPE, the object type.
+ * \return     First object, or NOTHING.  The rest follow through DO_RX.
+ */
+
+dbref rx_first(int ix, dbref key)
+{
+    if (RX_TYPE == ix)
+    {
+        return (0 <= key && key <= TYPE_MASK) ? rx_type_head[key] : NOTHING;
+    }
+    return Good_dbref(key) ? db[key].rx[ix].head : NOTHING;
+}
+
+/*! \brief Copies the objects listed under a key.
+ *
+ * \param ix     Which index.
+ * \param key    Object or type.
+ * \param aList  Where to put them, or NULL to only count them.
+ * \return       Number of objects.
+ */
+
+int rx_gather(int ix, dbref key, dbref *aList)
+{
+    int n = 0;
+    dbref thing;
+    DO_RX(thing, ix, key)
+    {
+        if (NULL != aList)
+        {
+            aList[n] = thing;
+        }
+        n++;
+    }
+    return n;
+}
+
+static int DCL_CDECL rx_compare(const void *a, const void *b)
+{
+    dbref x = *(const dbref *)a;
+    dbref y = *(const dbref *)b;
+    return (x < y) ? -1 : ((x > y) ? 1 : 0);
+}
+
+/*! \brief Puts a list of objects in dbref order and drops repeats.
+ *
+ * \param aList  Objects.
+ * \param n      Number of objects.
+ * \return       Number of objects left.
+ */
+
+int rx_sort(dbref *aList, int n)
+{
+    if (n <= 1)
+    {
+        return n;
+    }
+    qsort(aList, n, sizeof(dbref), rx_compare);
+
+    int j = 1;
+    for (int i = 1; i < n; i++)
+    {
+        if (aList[i] != aList[j-1])
+        {
+            aList[j++] = aList[i];
+        }
+    }
+    return j;
+}
+
+/*! \brief The objects listed under a key, in dbref order.
+ *
+ * \param ix   Which index.
+ * \param key  Object or type.
+ * \param pn   Number of objects.
+ * \return     List to be released with MEMFREE, or NULL if empty.
+ */
+
+dbref *rx_sorted(int ix, dbref key, int *pn)
+{
+    dbref *aList = NULL;
+    int n = rx_gather(ix, key, NULL);
+    if (0 < n)
+    {
+        aList = (dbref *)MEMALLOC(n * sizeof(dbref));
+        ISOUTOFMEMORY(aList);
+        rx_gather(ix, key, aList);
+        n = rx_sort(aList, n);
+    }
+    *pn = n;
+    return aList;
+}
+
+/*! \brief How many objects of a type there are.
+ *
+ * \param type    Object type.
+ * \param bGoing  Count the ones set GOING instead of the rest.
+ * \return        Count.
+ */
+
+int rx_census(int type, bool bGoing)
+{
+    return rx_count[type & TYPE_MASK][bGoing ? 1 : 0];
+}
+
+#if defined(SHADOW_COLUMNS)
+OBJCOLS db_cols;
+#define s_Column(c,t,v)     db_cols.c[t] = (v)
+#else // SHADOW_COLUMNS
+#define s_Column(c,t,v)
+#endif // SHADOW_COLUMNS
+
+void s_Location(dbref thing, dbref loc)
+{
+    db[thing].location = loc;
+    mudstate.bfDbckDirty.Set(thing);
+    s_Column(location, thing, loc);
+    rx_refresh(thing, RX_ENTRANCE);
+}
+
+void s_Zone(dbref thing, dbref zone)
+{
+    db[thing].zone = zone;
+    mudstate.bfDbckDirty.Set(thing);
+    s_Column(zone, thing, zone);
+    rx_refresh(thing, RX_ZONE);
+}
+
+void s_Link(dbref thing, dbref link)
+{
+    db[thing].link = link;
+    mudstate.bfDbckDirty.Set(thing);
+    rx_refresh(thing, RX_ENTRANCE);
+}
+
+void s_Owner(dbref thing, dbref owner)
+{
+    db[thing].owner = owner;
+    mudstate.bfDbckDirty.Set(thing);
+    s_Column(owner, thing, owner);
+    rx_refresh(thing, RX_OWNER);
+}
+
+void s_Parent(dbref thing, dbref parent)
+{
+    db[thing].parent = parent;
+    mudstate.bfDbckDirty.Set(thing);
+    s_Column(parent, thing, parent);
+    rx_refresh(thing, RX_PARENT);
+}
+
+void s_Flags(dbref thing, int word, FLAG value)
+{
+    FLAG old = db[thing].fs.word[word];
+    db[thing].fs.word[word] = value;
+    s_Column(flags[word], thing, value);
+    mudstate.bfDbckDirty.Set(thing);
+    if (FLAG_WORD1 == word)
+    {
+        s_Column(type, thing, (UINT8)(value & TYPE_MASK));
+    }
+    if (  FLAG_WORD1 == word
+       && ((old ^ value) & (TYPE_MASK | GOING))
+       && rx_enabled
+       && thing < mudstate.db_top)
+    {
+        rx_count[old & TYPE_MASK][(old & GOING) ? 1 : 0]--;
+        rx_count[value & TYPE_MASK][(value & GOING) ? 1 : 0]++;
+        if ((old ^ value) & TYPE_MASK)
+        {
+            rx_refresh(thing, RX_TYPE);
+            rx_refresh(thing, RX_ENTRANCE);
+        }
+    }
+    if (  FLAG_WORD1 == word
+       && (value & ~old & GOING)
+       && rx_enabled
+       && thing < mudstate.db_top)
+    {
+        dbck_going(thing);
+    }
+}
+
 /* ---------------------------------------------------------------------------
  * db_grow: Extend the struct database.
  */
@@ -2908,6 +3785,7 @@ static void initialize_objects(dbref first, dbref last)
 
     for (thing = first; thing < last; thing++)
     {
+        rx_clear(thing);
         s_Owner(thing, GOD);
         s_Flags(thing, FLAG_WORD1, (TYPE_GARBAGE | GOING));
         s_Powers(thing, 0);
@@ -2937,6 +3815,67 @@ static void initialize_objects(dbref first, dbref last)
 #endif // MEMORY_BASED
         db[thing].purename = NULL;
         db[thing].moniker = NULL;
+        db[thing].pCmdCache = NULL;
+    }
+}
+
+#if defined(SHADOW_COLUMNS)
+
+// Moves a shadow column to room for newsize objects.  Like db, each column
+// has SIZE_HACK entries in front of #0.
+//
+static void *col_grow(void *pCol, size_t nElem, int newsize)
+{
+    char *pNew = (char *)MEMALLOC((newsize + SIZE_HACK) * nElem);
+    ISOUTOFMEMORY(pNew);
+    if (NULL == pCol)
+    {
+        memset(pNew, 0, (newsize + SIZE_HACK) * nElem);
+    }
+    else
+    {
+        char *pOld = (char *)pCol - SIZE_HACK * nElem;
+        memcpy(pNew, pOld, (mudstate.db_top + SIZE_HACK) * nElem);
+        MEMFREE(pOld);
+    }
+    return pNew + SIZE_HACK * nElem;
+}
+
+static void cols_grow(int newsize)
+{
+    db_cols.owner    = (dbref *)col_grow(db_cols.owner,    sizeof(dbref), newsize);
+    db_cols.parent   = (dbref *)col_grow(db_cols.parent,   sizeof(dbref), newsize);
+    db_cols.zone     = (dbref *)col_grow(db_cols.zone,     sizeof(dbref), newsize);
+    db_cols.location = (dbref *)col_grow(db_cols.location, sizeof(dbref), newsize);
+    db_cols.type     = (UINT8 *)col_grow(db_cols.type,     sizeof(UINT8), newsize);
+    for (int i = FLAG_WORD1; i <= FLAG_WORD3; i++)
+    {
+        db_cols.flags[i] = (FLAG *)col_grow(db_cols.flags[i], sizeof(FLAG), newsize);
+    }
+}
+
+static void col_free(void *pCol, size_t nElem)
+{
+    if (NULL != pCol)
+    {
+        MEMFREE((char *)pCol - SIZE_HACK * nElem);
+    }
+}
+
+#endif // SHADOW_COLUMNS
+
+// Raises db_top over freshly initialized objects and indexes them.
+//
+static void rx_grow(dbref newtop)
+{
+    dbref first = mudstate.db_top;
+    mudstate.db_top = newtop;
+    if (rx_enabled)
+    {
+        for (dbref thing = first; thing < newtop; thing++)
+        {
+            rx_add(thing);
+        }
     }
 }
 
@@ -2946,6 +3885,8 @@ void db_grow(dbref newtop)
     mudstate.bfNoCommands.Resize(newtop);
     mudstate.bfListens.Resize(newtop);
     mudstate.bfNoListens.Resize(newtop);
+    mudstate.bfDbckDirty.Resize(newtop);
+    mudstate.bfDbckHold.Resize(newtop);
 
     int delta;
     if (mudstate.bStandAlone)
@@ -2975,7 +3916,7 @@ void db_grow(dbref newtop)
     if (newtop <= mudstate.db_size)
     {
         initialize_objects(mudstate.db_top, newtop);
-        mudstate.db_top = newtop;
+        rx_grow(newtop);
         return;
     }
 
@@ -3002,8 +3943,16 @@ void db_grow(dbref newtop)
     // just before the process terminates. We rely (quite safely) on the OS
     // to reclaim the memory.
     //
-    OBJ *newdb = (OBJ *)MEMALLOC((newsize + SIZE_HACK) * sizeof(OBJ));
+    size_t nNewDB = (newsize + SIZE_HACK) * sizeof(OBJ);
+    OBJ *newdb = (OBJ *)MEMALLOC(nNewDB);
     ISOUTOFMEMORY(newdb);
+    if (FLIGHT_BIG_ALLOC <= nNewDB)
+    {
+        flight_record(FLIGHT_ALLOC, NOTHING, NOTHING, nNewDB, T("db_grow"));
+    }
+#if defined(SHADOW_COLUMNS)
+    cols_grow(newsize);
+#endif // SHADOW_COLUMNS
     if (db)
     {
         // An old struct database exists. Copy it to the new buffer.
@@ -3024,7 +3973,7 @@ void db_grow(dbref newtop)
     newdb = NULL;
 
     initialize_objects(mudstate.db_top, newtop);
-    mudstate.db_top = newtop;
+    rx_grow(newtop);
     mudstate.db_size = newsize;
 
     // Grow the db mark buffer.
@@ -3060,9 +4009,22 @@ void db_free(void)
         cp = NULL;
         db = NULL;
     }
+#if defined(SHADOW_COLUMNS)
+    col_free(db_cols.owner,    sizeof(dbref));
+    col_free(db_cols.parent,   sizeof(dbref));
+    col_free(db_cols.zone,     sizeof(dbref));
+    col_free(db_cols.location, sizeof(dbref));
+    col_free(db_cols.type,     sizeof(UINT8));
+    for (int i = FLAG_WORD1; i <= FLAG_WORD3; i++)
+    {
+        col_free(db_cols.flags[i], sizeof(FLAG));
+    }
+    memset(&db_cols, 0, sizeof(db_cols));
+#endif // SHADOW_COLUMNS
     mudstate.db_top = 0;
     mudstate.db_size = 0;
     mudstate.freelist = NOTHING;
+    rx_enabled = false;
 }
 
 void db_make_minimal(void)
@@ -3576,7 +4538,7 @@ bool check_zone_handler(dbref player, dbref thing, bool bPlayerCheck)
 
     // If the zone doesn't have an enterlock, DON'T allow control.
     //
-    if (  atr_get_raw(Zone(thing), A_LENTER)
+    if (  atr_exists(Zone(thing), A_LENTER)
        && could_doit(player, Zone(thing), A_LENTER))
     {
         mudstate.zone_nest_num = 0;
@@ -3652,8 +4614,8 @@ void dump_restart_db(void)
         putref(f, d->raw_codepoint_state);
 
         for (int stateloop = 0; stateloop < 256; stateloop++) {
-            putref(f, d->nvt_him_state[stateloop]);
-            putref(f, d->nvt_us_state[stateloop]);
+            putref(f, HimState(d, (unsigned char)stateloop));
+            putref(f, UsState(d, (unsigned char)stateloop));
         }
 
         putref(f, d->height);
@@ -3774,14 +4736,7 @@ void load_restart_db(void)
         getref(f); // Eat host_info
         d->player = getref(f);
         d->last_time.SetSeconds(getref(f));
-        for (int i = 0; i < 256; i++)
-        {
-            d->nvt_him_state[i] = OPTION_NO;
-        }
-        for (int i = 0; i < 256; i++)
-        {
-            d->nvt_us_state[i] = OPTION_NO;
-        }
+        InitOptionState(d);
         d->raw_codepoint_length = 0;
         d->ttype = NULL;
         d->encoding = mudconf.default_charset;
@@ -3794,8 +4749,9 @@ void load_restart_db(void)
             d->raw_codepoint_state          = getref(f);
             for (int stateloop = 0; stateloop < 256; stateloop++)
             {
-                d->nvt_him_state[stateloop] = getref(f);
-                d->nvt_us_state[stateloop] = getref(f);
+                int iHimState = getref(f);
+                int iUsState = getref(f);
+                RestoreOptionState(d, (unsigned char)stateloop, iHimState, iUsState);
             }
 
             d->height = getref(f);
@@ -3816,12 +4772,13 @@ void load_restart_db(void)
         {
             d->raw_input_state              = getref(f);
             d->raw_codepoint_state          = CL_PRINT_START_STATE;
-            d->nvt_him_state[TELNET_SGA]    = getref(f);
-            d->nvt_us_state[TELNET_SGA]     = getref(f);
-            d->nvt_him_state[TELNET_EOR]    = getref(f);
-            d->nvt_us_state[TELNET_EOR]     = getref(f);
-            d->nvt_him_state[TELNET_NAWS]   = getref(f);
-            d->nvt_us_state[TELNET_NAWS]    = getref(f);
+            static const unsigned char aV2Options[] = { TELNET_SGA, TELNET_EOR, TELNET_NAWS };
+            for (int i = 0; i < 3; i++)
+            {
+                int iHimState = getref(f);
+                int iUsState = getref(f);
+                RestoreOptionState(d, aV2Options[i], iHimState, iUsState);
+            }
             d->height = getref(f);
             d->width = getref(f);
         }
@@ -3841,7 +4798,7 @@ void load_restart_db(void)
             UTF8 *pBufferUnicode = (UTF8 *)getstring_noalloc(f, true, &nBufferUnicode);
             if ('\0' != pBufferUnicode[0])
             {
-                d->output_prefix = alloc_lbuf("set_userstring");
+                d->output_prefix = alloc_lbuf_keep("set_userstring");
                 memcpy(d->output_prefix, pBufferUnicode, nBufferUnicode+1);
             }
             else
@@ -3854,7 +4811,7 @@ void load_restart_db(void)
             pBufferUnicode = (UTF8 *)getstring_noalloc(f, true, &nBufferUnicode);
             if ('\0' != pBufferUnicode[0])
             {
-                d->output_suffix = alloc_lbuf("set_userstring");
+                d->output_suffix = alloc_lbuf_keep("set_userstring");
                 memcpy(d->output_suffix, pBufferUnicode, nBufferUnicode+1);
             }
             else
@@ -3888,7 +4845,7 @@ void load_restart_db(void)
             if ('\0' != pBufferLatin1[0])
             {
                 pBufferUnicode = ConvertToUTF8(pBufferLatin1, &nBufferUnicode);
-                d->output_prefix = alloc_lbuf("set_userstring");
+                d->output_prefix = alloc_lbuf_keep("set_userstring");
                 memcpy(d->output_prefix, pBufferUnicode, nBufferUnicode+1);
             }
             else
@@ -3902,7 +4859,7 @@ void load_restart_db(void)
             if ('\0' != pBufferLatin1[0])
             {
                 pBufferUnicode = ConvertToUTF8(pBufferLatin1, &nBufferUnicode);
-                d->output_suffix = alloc_lbuf("set_userstring");
+                d->output_suffix = alloc_lbuf_keep("set_userstring");
                 memcpy(d->output_suffix, pBufferUnicode, nBufferUnicode+1);
             }
             else
@@ -3942,9 +4899,16 @@ void load_restart_db(void)
         d->raw_input = NULL;
         d->raw_input_at = NULL;
         d->nOption = 0;
+        d->aOption = NULL;
         d->quota = mudconf.cmd_quota_max;
         d->program_data = NULL;
         d->hashnext = NULL;
+#if defined(UNIX_NETWORKING_THREADS)
+        d->io_thread = -1;
+        d->io_slot = -1;
+        d->io_state = IO_OPEN;
+        d->io_pending = 0;
+#endif // UNIX_NETWORKING_THREADS
 
         if (descriptor_list)
         {
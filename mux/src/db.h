@@ -127,6 +127,29 @@ struct boolexp
 #define NOPERM      (-4)    /* Error status, no permission */
 extern const UTF8 *aszSpecialDBRefNames[1-NOPERM];
 
+typedef struct cmd_cache CMD_CACHE;
+
+// Reverse indexes.  Every object is threaded onto one list per index so
+// that the objects which share a parent, owner, zone, entrance target, or
+// type can be walked without scanning the whole database.
+//
+#define RX_PARENT   0   // Listed under Parent().
+#define RX_OWNER    1   // Listed under Owner().
+#define RX_ZONE     2   // Listed under Zone().
+#define RX_ENTRANCE 3   // Exits under destination, rooms under dropto,
+                        // and players and things under home.
+#define RX_TYPE     4   // Listed under Typeof().
+#define NUM_RX      5
+
+typedef struct rxlink RXLINK;
+struct rxlink
+{
+    dbref   key;        // What this object is listed under, or NOTHING.
+    dbref   head;       // First object listed under this one.
+    dbref   next;       // Next object with the same key.
+    dbref   prev;       // Previous object with the same key.
+};
+
 typedef struct object OBJ;
 struct object
 {
@@ -169,6 +192,10 @@ struct object
     UTF8    *purename;
     UTF8    *moniker;
 
+    CMD_CACHE *pCmdCache;   // ALL: Compiled $-commands.
+
+    RXLINK  rx[NUM_RX];     // ALL: Reverse index links.
+
 #ifdef MEMORY_BASED
     ATRLIST *pALHead;   /* The head of the attribute list.       */
     int      nALAlloc;  /* Size of the allocated attribute list. */
@@ -203,17 +230,9 @@ extern OBJ *db;
 #define ThMail(t)       db[t].throttled_mail
 #define ThRefs(t)       db[t].throttled_references
 
-#define s_Location(t,n)     db[t].location = (n)
-
-#define s_Zone(t,n)         db[t].zone = (n)
-
 #define s_Contents(t,n)     db[t].contents = (n)
 #define s_Exits(t,n)        db[t].exits = (n)
 #define s_Next(t,n)         db[t].next = (n)
-#define s_Link(t,n)         db[t].link = (n)
-#define s_Owner(t,n)        db[t].owner = (n)
-#define s_Parent(t,n)       db[t].parent = (n)
-#define s_Flags(t,f,n)      db[t].fs.word[f] = (n)
 #define s_Powers(t,n)       db[t].powers = (n)
 #define s_Powers2(t,n)      db[t].powers2 = (n)
 #define s_Home(t,n)         s_Link(t,n)
@@ -227,6 +246,54 @@ extern OBJ *db;
 #define s_Stack(t,n)        db[t].stackhead = (n)
 #endif // DEPRECATED
 
+void s_Location(dbref thing, dbref loc);
+void s_Zone(dbref thing, dbref zone);
+void s_Link(dbref thing, dbref link);
+void s_Owner(dbref thing, dbref owner);
+void s_Parent(dbref thing, dbref parent);
+void s_Flags(dbref thing, int word, FLAG value);
+
+// Whole-database scans read these fields through the Scan*() macros.  With
+// SHADOW_COLUMNS, the setters above also keep a contiguous copy of each
+// field, so a scan only pulls in the columns it tests.  The columns must
+// not be written directly.
+//
+#if defined(SHADOW_COLUMNS)
+typedef struct
+{
+    dbref *owner;
+    dbref *parent;
+    dbref *zone;
+    dbref *location;
+    UINT8 *type;
+    FLAG  *flags[3];
+} OBJCOLS;
+
+extern OBJCOLS db_cols;
+
+#define ScanOwner(t)        db_cols.owner[t]
+#define ScanParent(t)       db_cols.parent[t]
+#define ScanZone(t)         db_cols.zone[t]
+#define ScanLocation(t)     db_cols.location[t]
+#define ScanTypeof(t)       db_cols.type[t]
+#define ScanFlags(t,w)      db_cols.flags[w][t]
+#else // SHADOW_COLUMNS
+#define ScanOwner(t)        Owner(t)
+#define ScanParent(t)       Parent(t)
+#define ScanZone(t)         Zone(t)
+#define ScanLocation(t)     Location(t)
+#define ScanTypeof(t)       (Flags(t) & TYPE_MASK)
+#define ScanFlags(t,w)      db[t].fs.word[w]
+#endif // SHADOW_COLUMNS
+#define ScanGoing(t)        ((ScanFlags(t, FLAG_WORD1) & GOING) != 0)
+
+void  rx_build(void);
+dbref rx_first(int ix, dbref key);
+int   rx_gather(int ix, dbref key, dbref *aList);
+int   rx_sort(dbref *aList, int n);
+dbref *rx_sorted(int ix, dbref key, int *pn);
+int   rx_census(int type, bool bGoing);
+
 int  Pennies(dbref obj);
 void s_Pennies(dbref obj, int howfew);
 void s_PenniesDirect(dbref obj, int howfew);
@@ -269,6 +336,16 @@ int GrowFiftyPercent(int x, int low, int high);
     for ((thing)=0; (thing)<mudstate.db_top; (thing)++)
 #define DO_WHOLE_DB_BACKWARDS(thing) \
     for ((thing)=mudstate.db_top-1; (thing)>=0; (thing)--)
+#define DO_RX(thing,ix,key) \
+    for ((thing)=rx_first((ix),(key)); \
+         (thing)!=NOTHING; \
+         (thing)=db[thing].rx[ix].next)
+#define SAFE_DO_RX(thing,next,ix,key) \
+    for ((thing)=rx_first((ix),(key)), \
+         (next)=((thing)==NOTHING ? NOTHING : db[thing].rx[ix].next); \
+         (thing)!=NOTHING; \
+         (thing)=(next), \
+         (next)=((next)==NOTHING ? NOTHING : db[next].rx[ix].next))
 
 class attr_info
 {
@@ -1085,7 +1085,7 @@ UTF8 **PushPointers(int nNeeded)
     if (  !pPtrsFrame
        || pPtrsFrame->nptrs < nNeeded)
     {
-        PtrsFrame *p = (PtrsFrame *)alloc_lbuf("PushPointers");
+        PtrsFrame *p = (PtrsFrame *)alloc_lbuf_keep("PushPointers");
         p->next = pPtrsFrame;
         p->nptrs = PTRS_PER_FRAME;
         pPtrsFrame = p;
@@ -1123,7 +1123,7 @@ reg_ref **PushRegisters(int nNeeded)
     if (  !pRefsFrame
        || pRefsFrame->nrefs < nNeeded)
     {
-        RefsFrame *p = (RefsFrame *)alloc_lbuf("PushRegisters");
+        RefsFrame *p = (RefsFrame *)alloc_lbuf_keep("PushRegisters");
         p->next = pRefsFrame;
         p->nrefs = REFS_PER_FRAME;
         pRefsFrame = p;
@@ -1554,8 +1554,17 @@ void mux_exec( const UTF8 *pStr, size_t nStr, UTF8 *buff, UTF8 **bufc, dbref exe
                             save_global_regs(preserve);
                         }
 
-                        mux_exec(tbuf, LBUF_SIZE-1, buff, &oldp, i, executor, enactor,
-                            AttrTrace(aflags, feval), (const UTF8 **)fargs, nfargs);
+                        if (mudconf.profile_softcode)
+                        {
+                            profile_attribute(ufp->obj, ufp->atr, tbuf, LBUF_SIZE-1,
+                                buff, &oldp, i, executor, enactor,
+                                AttrTrace(aflags, feval), (const UTF8 **)fargs, nfargs);
+                        }
+                        else
+                        {
+                            mux_exec(tbuf, LBUF_SIZE-1, buff, &oldp, i, executor, enactor,
+                                AttrTrace(aflags, feval), (const UTF8 **)fargs, nfargs);
+                        }
 
                         if (ufp->flags & FN_PRES)
                         {
@@ -1574,8 +1583,16 @@ void mux_exec( const UTF8 *pStr, size_t nStr, UTF8 *buff, UTF8 **bufc, dbref exe
                            && nfargs <= fp->maxArgs
                            && !MuxAlarm.bAlarmed)
                         {
-                            fp->fun(buff, &oldp, executor, caller, enactor,
+                            if (mudconf.profile_softcode)
+                            {
+                                profile_function(fp, buff, &oldp, executor, caller, enactor,
                                     feval & EV_TRACE, fargs, nfargs, cargs, ncargs);
+                            }
+                            else
+                            {
+                                fp->fun(buff, &oldp, executor, caller, enactor,
+                                        feval & EV_TRACE, fargs, nfargs, cargs, ncargs);
+                            }
                         }
                         else
                         {
@@ -2528,7 +2545,7 @@ void RegAssign(reg_ref **regref, size_t nLength, const UTF8 *ptr)
     //
     if (NULL == last_lbufref)
     {
-        last_ptr = alloc_lbuf("RegAssign");
+        last_ptr = alloc_lbuf_keep("RegAssign");
         last_left = LBUF_SIZE;
 
         // Fill in new lbufref.
@@ -2556,3 +2573,538 @@ void RegAssign(reg_ref **regref, size_t nLength, const UTF8 *ptr)
 
     BufAddRef(last_lbufref);
 }
+
+// ---------------------------------------------------------------------------
+// Softcode profiler.
+//
+// While profile_softcode is enabled, every builtin function call and every
+// evaluation of an attribute as a user-defined function is timed.  Calls
+// are kept in a calling-context tree, one node for each distinct path of
+// calls, whose roots are the objects that started the evaluation.  Each
+// function and attribute also has a flat record which sums its calls across
+// every path.  Wall time is taken on every call.  Processor time is costly
+// to read, so it is taken on a random one in PROFILE_SAMPLE calls and scaled
+// up.
+//
+// When the profiler is disabled, each call site pays for a single test of
+// mudconf.profile_softcode.
+//
+
+#define PROFILE_SAMPLE    16        // Read CPU time on one in this many calls
+#define PROFILE_MAX_NODES 65536     // Limit on call paths and flat records
+#define PROFILE_HASH_SIZE 1024      // Buckets for flat records
+#define PROFILE_LIST_MAX  40        // Rows shown by @list profile
+
+typedef struct prof_key
+{
+    struct prof_key  *next;         // Next record in hash bucket
+    const FUN        *fp;           // Builtin function, or NULL
+    dbref             obj;          // Object holding the attribute
+    int               atr;          // Attribute, or NOTHING for a root
+    struct prof_node *pRoot;        // Tree root, if this record is a root
+    int               nActive;      // Calls of this record now open
+    UINT64            nCalls;       // Completed calls
+    INT64             tWall;        // Wall time, not counting recursion
+    INT64             tSelf;        // Wall time less that of callees
+    INT64             tCPU;         // Estimated CPU time, not counting recursion
+} PROF_KEY;
+
+typedef struct prof_node
+{
+    PROF_KEY         *pKey;         // What was called
+    struct prof_node *parent;       // Caller
+    struct prof_node *child;        // First callee
+    struct prof_node *sibling;      // Next callee of the same caller
+    struct prof_node *pAll;         // Next node in allocation order
+    UINT64            nCalls;       // Completed calls along this path
+    INT64             tSelf;        // Wall time less that of callees
+} PROF_NODE;
+
+typedef struct
+{
+    PROF_NODE *pNode;               // Node entered, or NULL if none
+    INT64      ltStart;             // Wall clock at entry
+    INT64      tChildSave;          // Caller's callee time so far
+    INT64      ltdCPUStart;         // CPU clock at entry, if sampled
+    bool       bSampled;            // CPU clock was read
+} PROF_FRAME;
+
+static struct
+{
+    PROF_KEY  *aHash[PROFILE_HASH_SIZE];
+    PROF_NODE *pCurrent;            // Innermost open node, or NULL
+    PROF_NODE *pAllNodes;           // Every node, for reset
+    INT64      tChild;              // Wall time of callees of pCurrent
+    int        nDepth;              // Open frames
+    int        nNodes;              // Nodes in the tree
+    int        nKeys;               // Flat records
+    UINT64     nDropped;            // Calls not given a node of their own
+    UINT32     uRandom;             // State for choosing samples
+    CLinearTimeAbsolute ltaStart;   // When profiling began or was reset
+} profile;
+
+static PROF_KEY *profile_key(const FUN *fp, dbref obj, int atr)
+{
+    UINT32 h = (NULL != fp)
+             ? static_cast<UINT32>(reinterpret_cast<size_t>(fp) >> 4)
+             : static_cast<UINT32>(obj)*31 + static_cast<UINT32>(atr);
+    h = (h ^ (h >> 10)) % PROFILE_HASH_SIZE;
+
+    PROF_KEY *pk;
+    for (pk = profile.aHash[h]; NULL != pk; pk = pk->next)
+    {
+        if (  pk->fp == fp
+           && pk->obj == obj
+           && pk->atr == atr)
+        {
+            return pk;
+        }
+    }
+
+    if (PROFILE_MAX_NODES <= profile.nNodes + profile.nKeys)
+    {
+        return NULL;
+    }
+
+    pk = (PROF_KEY *)MEMALLOC(sizeof(PROF_KEY));
+    if (NULL == pk)
+    {
+        return NULL;
+    }
+    memset(pk, 0, sizeof(PROF_KEY));
+    pk->fp  = fp;
+    pk->obj = obj;
+    pk->atr = atr;
+    pk->next = profile.aHash[h];
+    profile.aHash[h] = pk;
+    profile.nKeys++;
+    return pk;
+}
+
+static PROF_NODE *profile_node(PROF_NODE *parent, PROF_KEY *pk)
+{
+    if (PROFILE_MAX_NODES <= profile.nNodes + profile.nKeys)
+    {
+        return NULL;
+    }
+
+    PROF_NODE *pn = (PROF_NODE *)MEMALLOC(sizeof(PROF_NODE));
+    if (NULL == pn)
+    {
+        return NULL;
+    }
+    memset(pn, 0, sizeof(PROF_NODE));
+    pn->pKey = pk;
+    pn->parent = parent;
+    if (NULL != parent)
+    {
+        pn->sibling = parent->child;
+        parent->child = pn;
+    }
+    pn->pAll = profile.pAllNodes;
+    profile.pAllNodes = pn;
+    profile.nNodes++;
+    return pn;
+}
+
+/*! \brief Opens a profiler frame.
+ *
+ * The callee is looked up among the children of the innermost open node.
+ * At the outermost level, it hangs from a root for the executor.  Once the
+ * tree is full, calls are still counted in the flat records but get no
+ * node.
+ *
+ * \param pf        Frame to fill in.
+ * \param executor  Object doing the evaluation.
+ * \param fp        Builtin function, or NULL.
+ * \param obj       Object holding the attribute if fp is NULL.
+ * \param atr       Attribute if fp is NULL.
+ * \return          None.
+ */
+
+static void profile_enter(PROF_FRAME *pf, dbref executor, const FUN *fp, dbref obj, int atr)
+{
+    if (0 == profile.nDepth)
+    {
+        if (0 == profile.nKeys)
+        {
+            profile.ltaStart.GetUTC();
+            if (0 == profile.uRandom)
+            {
+                profile.uRandom = 2463534242U;
+            }
+        }
+
+        profile.pCurrent = NULL;
+        if (Good_obj(executor))
+        {
+            PROF_KEY *pkRoot = profile_key(NULL, executor, NOTHING);
+            if (NULL != pkRoot)
+            {
+                if (NULL == pkRoot->pRoot)
+                {
+                    pkRoot->pRoot = profile_node(NULL, pkRoot);
+                }
+                profile.pCurrent = pkRoot->pRoot;
+            }
+        }
+    }
+    profile.nDepth++;
+
+    PROF_NODE *parent = profile.pCurrent;
+    PROF_NODE *pn = NULL;
+    if (NULL != parent)
+    {
+        PROF_NODE **ppn = &parent->child;
+        while (NULL != *ppn)
+        {
+            PROF_KEY *pk = (*ppn)->pKey;
+            if (  pk->fp == fp
+               && pk->obj == obj
+               && pk->atr == atr)
+            {
+                // Move to the front, so that hot callees are found first.
+                //
+                pn = *ppn;
+                *ppn = pn->sibling;
+                pn->sibling = parent->child;
+                parent->child = pn;
+                break;
+            }
+            ppn = &(*ppn)->sibling;
+        }
+
+        if (NULL == pn)
+        {
+            PROF_KEY *pk = profile_key(fp, obj, atr);
+            if (NULL != pk)
+            {
+                pn = profile_node(parent, pk);
+            }
+        }
+    }
+
+    pf->pNode = pn;
+    if (NULL == pn)
+    {
+        profile.nDropped++;
+    }
+    else
+    {
+        pn->pKey->nActive++;
+        profile.pCurrent = pn;
+    }
+
+    profile.uRandom ^= profile.uRandom << 13;
+    profile.uRandom ^= profile.uRandom >> 17;
+    profile.uRandom ^= profile.uRandom << 5;
+    pf->bSampled = (0 == profile.uRandom % PROFILE_SAMPLE);
+    if (pf->bSampled)
+    {
+        pf->ltdCPUStart = GetProcessorUsage().Return100ns();
+    }
+
+    pf->tChildSave = profile.tChild;
+    profile.tChild = 0;
+    GetUTCLinearTime(&pf->ltStart);
+}
+
+static void profile_leave(PROF_FRAME *pf)
+{
+    INT64 ltEnd;
+    GetUTCLinearTime(&ltEnd);
+    INT64 tWall = ltEnd - pf->ltStart;
+    if (tWall < 0)
+    {
+        tWall = 0;
+    }
+    INT64 tSelf = tWall - profile.tChild;
+    if (tSelf < 0)
+    {
+        tSelf = 0;
+    }
+
+    PROF_NODE *pn = pf->pNode;
+    if (NULL != pn)
+    {
+        PROF_KEY *pk = pn->pKey;
+        pn->nCalls++;
+        pn->tSelf += tSelf;
+        pk->nCalls++;
+        pk->tSelf += tSelf;
+        if (0 == --pk->nActive)
+        {
+            pk->tWall += tWall;
+            if (pf->bSampled)
+            {
+                pk->tCPU += PROFILE_SAMPLE
+                          * (GetProcessorUsage().Return100ns() - pf->ltdCPUStart);
+            }
+        }
+        profile.pCurrent = pn->parent;
+    }
+
+    if (NULL != pn)
+    {
+        profile.tChild = pf->tChildSave + tWall;
+    }
+    else
+    {
+        // A call without a node is not a callee of its own.  Its callees
+        // are charged to its caller.
+        //
+        profile.tChild += pf->tChildSave;
+    }
+    profile.nDepth--;
+}
+
+/*! \brief Calls a builtin function under the profiler.
+ *
+ * mux_exec() calls this in place of fp->fun() while profile_softcode is on.
+ */
+
+void profile_function(const FUN *fp, UTF8 *buff, UTF8 **bufc, dbref executor,
+    dbref caller, dbref enactor, int eval, UTF8 *fargs[], int nfargs,
+    const UTF8 *cargs[], int ncargs)
+{
+    PROF_FRAME pf;
+    profile_enter(&pf, executor, fp, NOTHING, NOTHING);
+    fp->fun(buff, bufc, executor, caller, enactor, eval, fargs, nfargs, cargs,
+        ncargs);
+    profile_leave(&pf);
+}
+
+/*! \brief Evaluates an attribute under the profiler.
+ *
+ * Takes the place of mux_exec() where an attribute is evaluated as a
+ * user-defined function, while profile_softcode is on.
+ */
+
+void profile_attribute(dbref obj, int atr, const UTF8 *pStr, size_t nStr,
+    UTF8 *buff, UTF8 **bufc, dbref executor, dbref caller, dbref enactor,
+    int eval, const UTF8 *cargs[], int ncargs)
+{
+    PROF_FRAME pf;
+    profile_enter(&pf, caller, NULL, obj, atr);
+    mux_exec(pStr, nStr, buff, bufc, executor, caller, enactor, eval, cargs,
+        ncargs);
+    profile_leave(&pf);
+}
+
+static void profile_name(const PROF_KEY *pk, UTF8 *buff, UTF8 **bufc)
+{
+    if (NULL != pk->fp)
+    {
+        safe_str(pk->fp->name, buff, bufc);
+        safe_str(T("()"), buff, bufc);
+        return;
+    }
+
+    safe_chr('#', buff, bufc);
+    safe_ltoa(pk->obj, buff, bufc);
+    if (NOTHING != pk->atr)
+    {
+        ATTR *pattr = atr_num(pk->atr);
+        safe_chr('/', buff, bufc);
+        if (NULL != pattr)
+        {
+            safe_str(pattr->name, buff, bufc);
+        }
+        else
+        {
+            safe_ltoa(pk->atr, buff, bufc);
+        }
+    }
+}
+
+static int DCL_CDECL profile_compare(const void *a, const void *b)
+{
+    const PROF_KEY *pka = *(const PROF_KEY * const *)a;
+    const PROF_KEY *pkb = *(const PROF_KEY * const *)b;
+    if (pka->tWall < pkb->tWall)
+    {
+        return 1;
+    }
+    else if (pka->tWall > pkb->tWall)
+    {
+        return -1;
+    }
+    return 0;
+}
+
+/*! \brief Shows the functions and attributes with the most wall time.
+ *
+ * \param player  Who to tell.
+ * \return        None.
+ */
+
+void list_profile(dbref player)
+{
+    CLinearTimeAbsolute ltaNow;
+    ltaNow.GetUTC();
+    CLinearTimeDelta ltd = ltaNow - profile.ltaStart;
+    notify(player, tprintf(T("Profiler is %s.  %d call paths, %s calls not on a path, over %s seconds."),
+        mudconf.profile_softcode ? T("on") : T("off"), profile.nNodes,
+        mux_i64toa_t(profile.nDropped), ltd.ReturnSecondsString(0)));
+
+    int nKeys = 0;
+    int i;
+    PROF_KEY *pk;
+    for (i = 0; i < PROFILE_HASH_SIZE; i++)
+    {
+        for (pk = profile.aHash[i]; NULL != pk; pk = pk->next)
+        {
+            if (NOTHING != pk->atr || NULL != pk->fp)
+            {
+                nKeys++;
+            }
+        }
+    }
+
+    if (0 == nKeys)
+    {
+        return;
+    }
+
+    PROF_KEY **aKeys = (PROF_KEY **)MEMALLOC(nKeys * sizeof(PROF_KEY *));
+    ISOUTOFMEMORY(aKeys);
+    int j = 0;
+    for (i = 0; i < PROFILE_HASH_SIZE; i++)
+    {
+        for (pk = profile.aHash[i]; NULL != pk; pk = pk->next)
+        {
+            if (NOTHING != pk->atr || NULL != pk->fp)
+            {
+                aKeys[j++] = pk;
+            }
+        }
+    }
+    qsort(aKeys, nKeys, sizeof(PROF_KEY *), profile_compare);
+
+    notify(player, T("         Calls    Wall(us)    Self(us)     CPU(us)  Name"));
+    UTF8 *buff = alloc_lbuf("list_profile");
+    for (i = 0; i < nKeys && i < PROFILE_LIST_MAX; i++)
+    {
+        pk = aKeys[i];
+        UTF8 *p = buff;
+        p += RightJustifyNumber(p, 14, pk->nCalls,         ' '); *p++ = ' ';
+        p += RightJustifyNumber(p, 11, pk->tWall/10,       ' '); *p++ = ' ';
+        p += RightJustifyNumber(p, 11, pk->tSelf/10,       ' '); *p++ = ' ';
+        p += RightJustifyNumber(p, 11, pk->tCPU/10,        ' '); *p++ = ' ';
+        *p++ = ' ';
+        profile_name(pk, buff, &p);
+        *p = '\0';
+        notify(player, buff);
+    }
+    free_lbuf(buff);
+    MEMFREE(aKeys);
+    aKeys = NULL;
+}
+
+/*! \brief Discards everything the profiler has gathered.
+ *
+ * \param player  Who to tell.
+ * \return        None.
+ */
+
+void profile_reset(dbref player)
+{
+    if (0 != profile.nDepth)
+    {
+        notify(player, T("The profiler is in use."));
+        return;
+    }
+
+    while (NULL != profile.pAllNodes)
+    {
+        PROF_NODE *pn = profile.pAllNodes;
+        profile.pAllNodes = pn->pAll;
+        MEMFREE(pn);
+    }
+
+    for (int i = 0; i < PROFILE_HASH_SIZE; i++)
+    {
+        while (NULL != profile.aHash[i])
+        {
+            PROF_KEY *pk = profile.aHash[i];
+            profile.aHash[i] = pk->next;
+            MEMFREE(pk);
+        }
+    }
+    profile.pCurrent = NULL;
+    profile.tChild = 0;
+    profile.nNodes = 0;
+    profile.nKeys = 0;
+    profile.nDropped = 0;
+    profile.ltaStart.GetUTC();
+    notify(player, T("Profile reset."));
+}
+
+/*! \brief Writes the call paths as collapsed stacks.
+ *
+ * Each line names one call path, outermost first and separated by
+ * semicolons, followed by the wall time in microseconds spent in the last
+ * call on the path itself.  This is the input expected by flame graph
+ * tools.
+ *
+ * \param player  Who to tell.
+ * \return        None.
+ */
+
+void profile_write(dbref player)
+{
+    FILE *fp;
+    if (!mux_fopen(&fp, mudconf.profile_file, T("wb")))
+    {
+        notify(player, tprintf(T("Unable to open %s for writing."), mudconf.profile_file));
+        return;
+    }
+    DebugTotalFiles++;
+
+    const int nMaxDepth = 64;
+    PROF_NODE *aPath[nMaxDepth];
+    UTF8 *buff = alloc_lbuf("profile_write");
+    int nLines = 0;
+    for (PROF_NODE *pn = profile.pAllNodes; NULL != pn; pn = pn->pAll)
+    {
+        if (  NULL == pn->parent
+           || 0 == pn->tSelf/10)
+        {
+            continue;
+        }
+
+        // Gather the path from the leaf up, and print it from the root down.
+        //
+        int nPath = 0;
+        PROF_NODE *q;
+        for (q = pn; NULL != q && nPath < nMaxDepth; q = q->parent)
+        {
+            aPath[nPath++] = q;
+        }
+
+        UTF8 *p = buff;
+        if (NULL != q)
+        {
+            safe_str(T("..."), buff, &p);
+        }
+        while (0 < nPath)
+        {
+            profile_name(aPath[--nPath]->pKey, buff, &p);
+            if (0 < nPath)
+            {
+                safe_chr(';', buff, &p);
+            }
+        }
+        *p = '\0';
+        mux_fprintf(fp, T("%s %s\n"), buff, mux_i64toa_t(pn->tSelf/10));
+        nLines++;
+    }
+    free_lbuf(buff);
+
+    if (fclose(fp) == 0)
+    {
+        DebugTotalFiles--;
+    }
+    notify(player, tprintf(T("%d call paths written to %s."), nLines,
+        mudconf.profile_file));
+}
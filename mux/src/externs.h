@@ -100,6 +100,11 @@ int  halt_que(dbref, dbref);
 void wait_que(dbref executor, dbref caller, dbref enactor, int, bool,
     CLinearTimeAbsolute&, dbref, int, UTF8 *, int, const UTF8 *[], reg_ref *[]);
 void query_complete(UINT32 hQuery, UINT32 iError, CResultsSet *prs);
+CLinearTimeDelta GetProcessorUsage(void);
+void latency_record_command(dbref executor, dbref enactor,
+    CLinearTimeDelta ltd, UINT64 nOutput);
+void list_latency(dbref player);
+void latency_reset(dbref player);
 
 #if defined(UNIX_CRYPT)
 extern "C" char *crypt(const char *inptr, const char *inkey);
@@ -114,6 +119,12 @@ void parse_arglist(dbref executor, dbref caller, dbref enactor, UTF8 *,
 int get_gender(dbref);
 void mux_exec(const UTF8 *pdstr, size_t nStr, UTF8 *buff, UTF8 **bufc, dbref executor,
               dbref caller, dbref enactor, int eval, const UTF8 *cargs[], int ncargs);
+void profile_attribute(dbref obj, int atr, const UTF8 *pStr, size_t nStr,
+    UTF8 *buff, UTF8 **bufc, dbref executor, dbref caller, dbref enactor,
+    int eval, const UTF8 *cargs[], int ncargs);
+void list_profile(dbref player);
+void profile_reset(dbref player);
+void profile_write(dbref player);
 
 inline void BufAddRef(lbuf_ref *lbufref)
 {
@@ -211,6 +222,18 @@ void notify_check(dbref, dbref, const UTF8 *, int);
 bool Hearer(dbref);
 void report(void);
 
+#define FLIGHT_COMMAND  1   // Command finished.  nValue is microseconds.
+#define FLIGHT_QUEUE    2   // Queue entry finished.  nValue is microseconds.
+#define FLIGHT_DUMP     3   // Dump stalled the game or finished.
+#define FLIGHT_CACHE    4   // Attribute cache evicting.  nValue is entries.
+#define FLIGHT_ALLOC    5   // Large allocation.  nValue is bytes.
+#define FLIGHT_SIGNAL   6   // Signal which wrote the ring.
+#define FLIGHT_BIG_ALLOC    (1024*1024)
+
+void flight_record(int iType, dbref executor, dbref enactor, INT64 nValue,
+    const UTF8 *pText);
+void flight_write(int sig);
+
 bool atr_match
 (
     dbref thing,
@@ -239,6 +262,7 @@ bool list_check
     UTF8  *raw_str,
     bool  check_parent
 );
+void cmdcache_clear(dbref thing);
 bool html_escape(const UTF8 *src, UTF8 *dest, UTF8 **destp);
 
 #define DUMP_I_NORMAL    0  // OUTPUT to the outdb through a temporary file.
@@ -335,6 +359,8 @@ void  divest_object(dbref);
 dbref create_obj(dbref, int, const UTF8 *, int);
 void  destroy_obj(dbref);
 void  empty_obj(dbref);
+void  dbck_start(void);
+void  dbck_going(dbref thing);
 
 /* From player.cpp */
 dbref create_player(const UTF8 *name, const UTF8 *pass, dbref executor, bool isrobot, const UTF8 **pmsg);
@@ -457,6 +483,16 @@ dbref olist_next(void);
 bool wild(UTF8 *, UTF8 *, UTF8 *[], int);
 bool wild_match(UTF8 *, const UTF8 *);
 bool quick_wild(const UTF8 *, const UTF8 *);
+typedef struct wild_program WILD_PROGRAM;
+typedef struct wild_prefilter WILD_PREFILTER;
+WILD_PROGRAM *wild_compile(const UTF8 *);
+void wild_free(WILD_PROGRAM *);
+size_t wild_size(const WILD_PROGRAM *);
+bool wild_exec(const WILD_PROGRAM *, const UTF8 *, UTF8 *[], int);
+WILD_PREFILTER *wild_prefilter_build(WILD_PROGRAM *[], int);
+void wild_prefilter_free(WILD_PREFILTER *);
+size_t wild_prefilter_size(const WILD_PREFILTER *);
+void wild_prefilter_scan(const WILD_PREFILTER *, const UTF8 *, bool []);
 
 /* From command.cpp */
 bool check_access(dbref player, int mask);
@@ -504,6 +540,7 @@ const UTF8 *atr_decode_flags_owner(const UTF8 *iattr, dbref *owner, int *flags);
 //
 const UTF8 *atr_get_raw_LEN(dbref, int, size_t *);
 const UTF8 *atr_get_raw(dbref, int);
+bool atr_exists(dbref, int);
 UTF8 *atr_get_LEN(dbref, int, dbref *, int *, size_t *);
 UTF8 *atr_get_real(const UTF8 *tag, dbref, int, dbref *, int *, const UTF8 *, const int);
 #define atr_get(g,t,a,o,f) atr_get_real((UTF8 *)g,t,a,o,f, (UTF8 *)__FILE__, __LINE__)
@@ -520,6 +557,7 @@ UTF8 *atr_pget_str(UTF8 *, dbref, int, dbref *, int *);
 bool atr_get_info(dbref, int, dbref *, int *);
 bool atr_pget_info(dbref, int, dbref *, int *);
 void atr_free(dbref);
+void list_memory(dbref player);
 bool check_zone_handler(dbref player, dbref thing, bool bPlayerCheck);
 #define check_zone(player, thing) check_zone_handler(player, thing, false)
 void ReleaseAllResources(dbref obj);
@@ -1075,6 +1113,7 @@ public:
     ~CTaskHeap();
 
     void Shrink(void);
+    int  Count(int iPriority);
     bool Insert(PTASK_RECORD, SCHCMP *);
     PTASK_RECORD PeekAtTopmost(void);
     PTASK_RECORD RemoveTopmost(SCHCMP *);
@@ -1109,6 +1148,7 @@ public:
     void ReadyTasks(const CLinearTimeAbsolute& tNow);
     void CancelTask(FTASK *fpTask, void *arg_voidptr, int arg_Integer);
     void Shrink(void);
+    void CountTasks(int iPriority, int *pnReady, int *pnWaiting);
 
     void SetMinPriority(int arg_minPriority);
     int  GetMinPriority(void) { return m_minPriority; }
@@ -1177,6 +1217,9 @@ void cache_redirect(void);
 void cache_pass2(void);
 void cache_cleanup(void);
 extern CLinearTimeAbsolute cs_ltime;
+#if !defined(MEMORY_BASED)
+void cache_stats(size_t *pnBytes, INT64 *pnEvictions);
+#endif // MEMORY_BASED
 
 // From speech.cpp
 //
@@ -1187,6 +1230,6 @@ UTF8 *modSpeech(dbref player, UTF8 *message, bool bWhich, UTF8 *command);
 #ifdef DEPRECATED
 void stack_clr(dbref obj);
 #endif // DEPRECATED
-bool parse_and_get_attrib(dbref, UTF8 *[], UTF8 **, dbref *, dbref *, int *, UTF8 *, UTF8 **);
+bool parse_and_get_attrib(dbref, UTF8 *[], UTF8 **, dbref *, dbref *, int *, UTF8 *, UTF8 **, int *patrnum = NULL);
 
 #endif // EXTERNS_H
@@ -97,7 +97,7 @@ static FBLOCK *fcache_fill(FBLOCK *fp, UTF8 ch)
         // We filled the current buffer.  Go get a new one.
         //
         FBLOCK *tfp = fp;
-        fp = (FBLOCK *) alloc_mbuf("fcache_fill");
+        fp = (FBLOCK *) alloc_mbuf_keep("fcache_fill");
         fp->hdr.nxt = NULL;
         fp->hdr.nchars = 0;
         tfp->hdr.nxt = fp;
@@ -140,7 +140,7 @@ static int fcache_read(FBLOCK **cp, UTF8 *filename)
 
     // Set up the initial cache buffer to make things easier.
     //
-    fp = (FBLOCK *) alloc_mbuf("fcache_read.first");
+    fp = (FBLOCK *) alloc_mbuf_keep("fcache_read.first");
     fp->hdr.nxt = NULL;
     fp->hdr.nchars = 0;
     *cp = fp;
@@ -39,11 +39,11 @@ static bool fh_any(dbref target, dbref player, FLAG flag, int fflags, bool reset
     //
     if (reset)
     {
-        db[target].fs.word[fflags] &= ~flag;
+        s_Flags(target, fflags, db[target].fs.word[fflags] & ~flag);
     }
     else
     {
-        db[target].fs.word[fflags] |= flag;
+        s_Flags(target, fflags, db[target].fs.word[fflags] | flag);
     }
     return true;
 }
@@ -296,18 +296,11 @@ static bool fh_unicode(dbref target, dbref player, FLAG flag, int fflags, bool r
         {
             if (!reset)
             {
-                if (CHARSET_UTF8 != dtemp->encoding)
-                {
-                    // Since we are changing to the UTF-8 character set, the
-                    // printable state machine needs to be initialized.
-                    //
-                    dtemp->encoding = CHARSET_UTF8;
-                    dtemp->raw_codepoint_state = CL_PRINT_START_STATE;
-                }
+                SetDescriptorEncoding(dtemp, CHARSET_UTF8);
             }
             else
             {
-                dtemp->encoding = dtemp->negotiated_encoding;
+                SetDescriptorEncoding(dtemp, dtemp->negotiated_encoding);
             }
         }
         return true;
@@ -337,9 +330,9 @@ static bool fh_ascii(dbref target, dbref player, FLAG flag, int fflags, bool res
         DESC_ITER_PLAYER(target, dtemp)
         {
             if (!reset)
-                dtemp->encoding = CHARSET_ASCII;
+                SetDescriptorEncoding(dtemp, CHARSET_ASCII);
             else
-                dtemp->encoding = dtemp->negotiated_encoding;
+                SetDescriptorEncoding(dtemp, dtemp->negotiated_encoding);
         }
     }
 
@@ -44,7 +44,8 @@ bool parse_and_get_attrib
     dbref  *paowner,
     dbref  *paflags,
     UTF8   *buff,
-    UTF8  **bufc
+    UTF8  **bufc,
+    int    *patrnum
 )
 {
     ATTR *ap;
@@ -72,6 +73,11 @@ bool parse_and_get_attrib
         return false;
     }
 
+    if (NULL != patrnum)
+    {
+        *patrnum = ap->number;
+    }
+
     *atext = atr_pget(*thing, ap->number, paowner, paflags);
     if (!*atext)
     {
@@ -934,19 +940,24 @@ static void scan_zone
         return;
     }
 
-    dbref i;
+    int n;
+    dbref *aList = rx_sorted(RX_ZONE, it, &n);
     ITL pContext;
     ItemToList_Init(&pContext, buff, bufc, '#');
-    DO_WHOLE_DB(i)
+    for (int i = 0; i < n; i++)
     {
-        if (  Typeof(i) == ObjectType
-           && Zone(i) == it
-           && !ItemToList_AddInteger(&pContext, i))
+        if (  ScanTypeof(aList[i]) == ObjectType
+           && !ItemToList_AddInteger(&pContext, aList[i]))
         {
             break;
         }
     }
     ItemToList_Final(&pContext);
+    if (NULL != aList)
+    {
+        MEMFREE(aList);
+        aList = NULL;
+    }
 }
 
 FUNCTION(fun_zwho)
@@ -997,18 +1008,23 @@ FUNCTION(fun_children)
         return;
     }
 
-    dbref i;
+    int n;
+    dbref *aList = rx_sorted(RX_PARENT, it, &n);
     ITL pContext;
     ItemToList_Init(&pContext, buff, bufc, '#');
-    DO_WHOLE_DB(i)
+    for (int i = 0; i < n; i++)
     {
-        if (  Parent(i) == it
-           && !ItemToList_AddInteger(&pContext, i))
+        if (!ItemToList_AddInteger(&pContext, aList[i]))
         {
             break;
         }
     }
     ItemToList_Final(&pContext);
+    if (NULL != aList)
+    {
+        MEMFREE(aList);
+        aList = NULL;
+    }
 }
 
 FUNCTION(fun_objeval)
@@ -1544,12 +1560,9 @@ FUNCTION(fun_playmem)
     }
     size_t tot = 0;
     dbref j;
-    DO_WHOLE_DB(j)
+    DO_RX(j, RX_OWNER, thing)
     {
-        if (Owner(j) == thing)
-        {
-            tot += mem_usage(j);
-        }
+        tot += mem_usage(j);
     }
     safe_ltoa(static_cast<long>(tot), buff, bufc);
 }
@@ -2213,7 +2213,7 @@ FUNCTION(fun_push)
     MUX_STACK *sp = (MUX_STACK *)MEMALLOC(sizeof(MUX_STACK));
     ISOUTOFMEMORY(sp);
     sp->next = Stack(doer);
-    sp->data = alloc_lbuf("push");
+    sp->data = alloc_lbuf_keep("push");
     mux_strncpy(sp->data, data, LBUF_SIZE-1);
     s_Stack(doer, sp);
 }
@@ -2318,7 +2318,8 @@ static void do_ufun(UTF8 *buff, UTF8 **bufc, dbref executor, dbref caller,
     dbref thing;
     dbref aowner;
     int   aflags;
-    if (!parse_and_get_attrib(executor, fargs, &atext, &thing, &aowner, &aflags, buff, bufc))
+    int   atrnum;
+    if (!parse_and_get_attrib(executor, fargs, &atext, &thing, &aowner, &aflags, buff, bufc, &atrnum))
     {
         return;
     }
@@ -2334,9 +2335,18 @@ static void do_ufun(UTF8 *buff, UTF8 **bufc, dbref executor, dbref caller,
 
     // Evaluate it using the rest of the passed function args.
     //
-    mux_exec(atext, LBUF_SIZE-1, buff, bufc, thing, executor, enactor,
-        AttrTrace(aflags, EV_FCHECK|EV_EVAL),
-        (const UTF8 **)&(fargs[1]), nfargs - 1);
+    if (mudconf.profile_softcode)
+    {
+        profile_attribute(thing, atrnum, atext, LBUF_SIZE-1, buff, bufc, thing,
+            executor, enactor, AttrTrace(aflags, EV_FCHECK|EV_EVAL),
+            (const UTF8 **)&(fargs[1]), nfargs - 1);
+    }
+    else
+    {
+        mux_exec(atext, LBUF_SIZE-1, buff, bufc, thing, executor, enactor,
+            AttrTrace(aflags, EV_FCHECK|EV_EVAL),
+            (const UTF8 **)&(fargs[1]), nfargs - 1);
+    }
     free_lbuf(atext);
 
     // If we're evaluating locally, restore the preserved registers.
@@ -3978,11 +3988,22 @@ FUNCTION(fun_entrances)
         return;
     }
 
+    int nList;
+    dbref *aList = rx_sorted(RX_ENTRANCE, thing, &nList);
     int control_thing = Examinable(executor, thing);
     ITL itl;
     ItemToList_Init(&itl, buff, bufc, '#');
-    for (i = low_bound; i <= high_bound; i++)
+    for (int k = 0; k < nList; k++)
     {
+        i = aList[k];
+        if (i < low_bound)
+        {
+            continue;
+        }
+        else if (high_bound < i)
+        {
+            break;
+        }
         if (  control_thing
            || Examinable(executor, i))
         {
@@ -4007,6 +4028,11 @@ FUNCTION(fun_entrances)
         }
     }
     ItemToList_Final(&itl);
+    if (NULL != aList)
+    {
+        MEMFREE(aList);
+        aList = NULL;
+    }
 }
 
 /*
@@ -8047,9 +8073,9 @@ static FUNCTION(fun_terminfo)
     else
     {
         safe_str(T("unknown"), buff, bufc);
-        if (  d->nvt_him_state[TELNET_NAWS]
-           || d->nvt_him_state[TELNET_SGA]
-           || d->nvt_him_state[TELNET_EOR])
+        if (  OPTION_NO != HimState(d, TELNET_NAWS)
+           || OPTION_NO != HimState(d, TELNET_SGA)
+           || OPTION_NO != HimState(d, TELNET_EOR))
         {
             safe_str(T(" telnet"), buff, bufc);
         }
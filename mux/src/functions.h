@@ -45,6 +45,9 @@ typedef struct ufun {
 
 void init_functab(void);
 void list_functable(dbref);
+void profile_function(const FUN *fp, UTF8 *buff, UTF8 **bufc, dbref executor,
+    dbref caller, dbref enactor, int eval, UTF8 *fargs[], int nfargs,
+    const UTF8 *cargs[], int ncargs);
 extern UFUN *ufun_head;
 
 /* Special handling of separators. */
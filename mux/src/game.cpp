@@ -18,6 +18,7 @@
 #include "file_c.h"
 #include "functions.h"
 #include "help.h"
+#include "mathutil.h"
 #include "mguests.h"
 #include "muxcli.h"
 #include "pcre.h"
@@ -73,6 +74,148 @@ void report(void)
     }
 }
 
+// ---------------------------------------------------------------------------
+// Flight recorder.
+//
+// The last FLIGHT_EVENTS notable events (commands, queue entries, dumps,
+// attribute cache thrashing, and large allocations) are kept in a fixed ring
+// in memory.  Nothing is logged as they happen.  When a fatal or shutdown
+// signal arrives, the handler writes the ring to flight_file with nothing
+// but open() and write(), and testcases/tools/flight.pl decodes it.
+//
+// A writer claims a slot with an atomic increment, so the handler can record
+// its own event even if it interrupted another write.  The sequence number
+// is stored last.  A slot that was being written when the ring was saved
+// still carries its old (or zero) sequence number, and the reader drops it.
+//
+#define FLIGHT_EVENTS   4096
+#define FLIGHT_TEXT     32
+#define FLIGHT_MAGIC    "MUXFLT01"
+
+typedef struct
+{
+    UINT32 nSeq;
+    UINT16 iType;
+    UINT16 iPad;
+    INT64  tWhen;       // 100ns ticks, as from CLinearTimeAbsolute.
+    INT32  executor;
+    INT32  enactor;
+    INT64  nValue;
+    char   aText[FLIGHT_TEXT];
+} FLIGHT_EVENT;
+
+typedef struct
+{
+    char   aMagic[8];
+    UINT32 nEvents;
+    UINT32 nEventSize;
+    UINT32 nNext;
+    INT32  iSignal;
+    INT64  tWritten;
+} FLIGHT_HEADER;
+
+static FLIGHT_EVENT flight_ring[FLIGHT_EVENTS];
+static volatile long flight_next = 0;
+
+#if defined(WIN32)
+#define FLIGHT_CLAIM()      (static_cast<UINT32>(InterlockedIncrement(&flight_next)) - 1)
+#define FLIGHT_BARRIER()    MemoryBarrier()
+#else // WIN32
+#define FLIGHT_CLAIM()      static_cast<UINT32>(__sync_fetch_and_add(&flight_next, 1))
+#define FLIGHT_BARRIER()    __sync_synchronize()
+#endif // WIN32
+
+/*! \brief Adds one event to the flight recorder.
+ *
+ * Safe to call from any thread and from a signal handler.
+ *
+ * \param iType     One of the FLIGHT_* event types.
+ * \param executor  Object responsible, or NOTHING.
+ * \param enactor   Object which caused it, or NOTHING.
+ * \param nValue    Duration in microseconds or a size, depending on iType.
+ * \param pText     Short description, or NULL.  Truncated to fit.
+ * \return          None.
+ */
+
+void flight_record(int iType, dbref executor, dbref enactor, INT64 nValue,
+    const UTF8 *pText)
+{
+    UINT32 nSeq = FLIGHT_CLAIM();
+    FLIGHT_EVENT *pfe = &flight_ring[nSeq % FLIGHT_EVENTS];
+
+    pfe->nSeq = 0;
+    FLIGHT_BARRIER();
+
+    CLinearTimeAbsolute ltaNow;
+    ltaNow.GetUTC();
+    pfe->iType    = static_cast<UINT16>(iType);
+    pfe->iPad     = 0;
+    pfe->tWhen    = ltaNow.Return100ns();
+    pfe->executor = executor;
+    pfe->enactor  = enactor;
+    pfe->nValue   = nValue;
+
+    size_t i = 0;
+    if (NULL != pText)
+    {
+        for ( ; i < FLIGHT_TEXT - 1 && '\0' != pText[i]; i++)
+        {
+            pfe->aText[i] = static_cast<char>(pText[i]);
+        }
+    }
+    memset(pfe->aText + i, 0, FLIGHT_TEXT - i);
+
+    FLIGHT_BARRIER();
+    pfe->nSeq = nSeq + 1;
+}
+
+/*! \brief Writes the flight recorder to flight_file.
+ *
+ * Called from signal handlers, so it uses only open(), write(), and close().
+ * The file is a FLIGHT_HEADER followed by the ring as it lies in memory.
+ *
+ * \param sig  Signal being handled, or zero.
+ * \return     None.
+ */
+
+void flight_write(int sig)
+{
+    // A fault while writing must not bring us back here.
+    //
+    static bool bWriting = false;
+    if (  bWriting
+       || NULL == mudconf.flight_file
+       || '\0' == mudconf.flight_file[0])
+    {
+        return;
+    }
+    bWriting = true;
+
+    flight_record(FLIGHT_SIGNAL, mudstate.curr_executor, mudstate.curr_enactor,
+        sig, mudstate.debug_cmd);
+
+    FLIGHT_HEADER fh;
+    memset(&fh, 0, sizeof(fh));
+    memcpy(fh.aMagic, FLIGHT_MAGIC, sizeof(fh.aMagic));
+    fh.nEvents    = FLIGHT_EVENTS;
+    fh.nEventSize = sizeof(FLIGHT_EVENT);
+    fh.nNext      = static_cast<UINT32>(flight_next);
+    fh.iSignal    = sig;
+
+    CLinearTimeAbsolute ltaNow;
+    ltaNow.GetUTC();
+    fh.tWritten = ltaNow.Return100ns();
+
+    int fd;
+    if (mux_open(&fd, mudconf.flight_file, O_WRONLY|O_CREAT|O_TRUNC|O_BINARY))
+    {
+        mux_write(fd, &fh, static_cast<unsigned int>(sizeof(fh)));
+        mux_write(fd, flight_ring, static_cast<unsigned int>(sizeof(flight_ring)));
+        mux_close(fd);
+    }
+    bWriting = false;
+}
+
 /* ----------------------------------------------------------------------
  * regexp_match: Load a regular expression match and insert it into
  * registers.
@@ -159,6 +302,350 @@ bool regexp_match
     return true;
 }
 
+/* ----------------------------------------------------------------------
+ * Compiled $-command cache.
+ *
+ * Matching $-commands used to fetch and re-parse every attribute on every
+ * object in scope for every command typed.  Instead, the first search of an
+ * object records its attribute numbers and flags along with each $-command's
+ * pattern compiled by wild_compile() and a prefix prefilter over those
+ * patterns.  The cache is discarded whenever any attribute on the object is
+ * written or cleared.
+ *
+ * Caches are kept on a list from most to least recently used, and the least
+ * recently used are discarded to keep their total size under
+ * max_cmd_cache_size.
+ */
+
+typedef struct
+{
+    int           atr;
+    int           aflags;
+    UTF8         *pPattern;     // NULL if the attribute is not a $-command.
+    UTF8         *pAction;
+    WILD_PROGRAM *pProgram;     // NULL for regular expressions.
+    int           iPrefilter;   // -1 if not in the prefilter.
+} CMD_ENTRY;
+
+struct cmd_cache
+{
+    CMD_CACHE      *pPrev;
+    CMD_CACHE      *pNext;
+    dbref           thing;
+    size_t          nSize;
+    int             nEntries;
+    CMD_ENTRY      *aEntries;
+    bool            bCommands;
+    bool            bListens;
+    int             nPrefilter;
+    WILD_PREFILTER *pPrefilter;
+    bool           *abCandidate;
+};
+
+static CMD_CACHE *pCmdCacheHead = NULL;
+static CMD_CACHE *pCmdCacheTail = NULL;
+static size_t CmdCacheSize = 0;
+
+static void cmdcache_unlink(CMD_CACHE *pcc)
+{
+    if (NULL != pcc->pPrev)
+    {
+        pcc->pPrev->pNext = pcc->pNext;
+    }
+    else
+    {
+        pCmdCacheHead = pcc->pNext;
+    }
+
+    if (NULL != pcc->pNext)
+    {
+        pcc->pNext->pPrev = pcc->pPrev;
+    }
+    else
+    {
+        pCmdCacheTail = pcc->pPrev;
+    }
+}
+
+static void cmdcache_link(CMD_CACHE *pcc)
+{
+    pcc->pPrev = NULL;
+    pcc->pNext = pCmdCacheHead;
+    if (NULL != pCmdCacheHead)
+    {
+        pCmdCacheHead->pPrev = pcc;
+    }
+    else
+    {
+        pCmdCacheTail = pcc;
+    }
+    pCmdCacheHead = pcc;
+}
+
+void cmdcache_clear(dbref thing)
+{
+    CMD_CACHE *pcc = db[thing].pCmdCache;
+    if (NULL == pcc)
+    {
+        return;
+    }
+    db[thing].pCmdCache = NULL;
+    cmdcache_unlink(pcc);
+    CmdCacheSize -= pcc->nSize;
+
+    for (int i = 0; i < pcc->nEntries; i++)
+    {
+        if (NULL != pcc->aEntries[i].pPattern)
+        {
+            MEMFREE(pcc->aEntries[i].pPattern - 1);
+            wild_free(pcc->aEntries[i].pProgram);
+        }
+    }
+    wild_prefilter_free(pcc->pPrefilter);
+    if (NULL != pcc->abCandidate)
+    {
+        delete [] pcc->abCandidate;
+    }
+    if (NULL != pcc->aEntries)
+    {
+        delete [] pcc->aEntries;
+    }
+    delete pcc;
+}
+
+static CMD_CACHE *cmdcache_get(dbref thing)
+{
+    CMD_CACHE *pcc = db[thing].pCmdCache;
+    if (NULL != pcc)
+    {
+        if (pCmdCacheHead != pcc)
+        {
+            cmdcache_unlink(pcc);
+            cmdcache_link(pcc);
+        }
+        return pcc;
+    }
+
+    pcc = new CMD_CACHE;
+    pcc->thing       = thing;
+    pcc->nSize       = sizeof(CMD_CACHE);
+    pcc->nEntries    = 0;
+    pcc->aEntries    = NULL;
+    pcc->bCommands   = false;
+    pcc->bListens    = false;
+    pcc->nPrefilter  = 0;
+    pcc->pPrefilter  = NULL;
+    pcc->abCandidate = NULL;
+
+    atr_push();
+    unsigned char *as;
+    int nAlloc = 0;
+    for (int atr = atr_head(thing, &as); atr; atr = atr_next(&as))
+    {
+        nAlloc++;
+    }
+
+    if (0 < nAlloc)
+    {
+        pcc->aEntries = new CMD_ENTRY[nAlloc];
+        pcc->nSize   += nAlloc*sizeof(CMD_ENTRY);
+    }
+
+    UTF8 *buff = alloc_lbuf("cmdcache_get");
+    for (int atr = atr_head(thing, &as); atr && pcc->nEntries < nAlloc; atr = atr_next(&as))
+    {
+        dbref aowner;
+        int   aflags;
+        atr_get_str(buff, thing, atr, &aowner, &aflags);
+
+        CMD_ENTRY *pce = &pcc->aEntries[pcc->nEntries++];
+        pce->atr        = atr;
+        pce->aflags     = aflags;
+        pce->pPattern   = NULL;
+        pce->pAction    = NULL;
+        pce->pProgram   = NULL;
+        pce->iPrefilter = -1;
+
+        if (  0 != (aflags & AF_NOPROG)
+           || (  AMATCH_CMD    != buff[0]
+              && AMATCH_LISTEN != buff[0]))
+        {
+            continue;
+        }
+
+        UTF8 *s = (UTF8 *)strchr((char *)buff+1, ':');
+        if (NULL == s)
+        {
+            continue;
+        }
+
+        if (AMATCH_LISTEN == buff[0])
+        {
+            pcc->bListens = true;
+            continue;
+        }
+        pcc->bCommands = true;
+
+        *s = '\0';
+        UTF8 *p = StringCloneLen(buff, strlen((char *)buff) + 1 + strlen((char *)s + 1));
+        pce->pPattern = p + 1;
+        pce->pAction  = p + (s - buff) + 1;
+        pcc->nSize   += strlen((char *)buff) + 1 + strlen((char *)s + 1) + 1;
+        if (0 == (aflags & AF_REGEXP))
+        {
+            pce->pProgram = wild_compile(pce->pPattern);
+            pcc->nSize   += wild_size(pce->pProgram);
+            if (0 == (aflags & AF_NOPARSE))
+            {
+                pce->iPrefilter = pcc->nPrefilter++;
+            }
+        }
+    }
+    free_lbuf(buff);
+    atr_pop();
+
+    if (0 < pcc->nPrefilter)
+    {
+        WILD_PROGRAM **apwp = new WILD_PROGRAM *[pcc->nPrefilter];
+        for (int i = 0; i < pcc->nEntries; i++)
+        {
+            if (-1 != pcc->aEntries[i].iPrefilter)
+            {
+                apwp[pcc->aEntries[i].iPrefilter] = pcc->aEntries[i].pProgram;
+            }
+        }
+        pcc->pPrefilter  = wild_prefilter_build(apwp, pcc->nPrefilter);
+        pcc->abCandidate = new bool[pcc->nPrefilter];
+        delete [] apwp;
+        pcc->nSize += wild_prefilter_size(pcc->pPrefilter)
+                    + pcc->nPrefilter*sizeof(bool);
+    }
+
+    db[thing].pCmdCache = pcc;
+    cmdcache_link(pcc);
+    CmdCacheSize += pcc->nSize;
+
+    // Make room by discarding the least recently used caches, but never the
+    // one which is about to be used.
+    //
+    while (  mudconf.max_cmd_cache_size < CmdCacheSize
+          && pCmdCacheTail != pcc)
+    {
+        cmdcache_clear(pCmdCacheTail->thing);
+    }
+    return pcc;
+}
+
+// atr_match1_cmd: The $-command half of atr_match1, driven from the cache.
+//
+static int atr_match1_cmd
+(
+    dbref thing,
+    dbref parent,
+    dbref player,
+    UTF8  *str,
+    UTF8  *raw_str,
+    int   check_exclude,
+    int   hash_insert
+)
+{
+    CMD_CACHE *pcc = cmdcache_get(parent);
+
+    if (0 < pcc->nPrefilter)
+    {
+        memset(pcc->abCandidate, 0, pcc->nPrefilter*sizeof(bool));
+        wild_prefilter_scan(pcc->pPrefilter, str, pcc->abCandidate);
+    }
+
+    int match = 0;
+    for (int i = 0; i < pcc->nEntries; i++)
+    {
+        CMD_ENTRY *pce = &pcc->aEntries[i];
+        ATTR *ap = atr_num(pce->atr);
+
+        // Never check NOPROG attributes.
+        //
+        if (  !ap
+           || (ap->flags & AF_NOPROG))
+        {
+            continue;
+        }
+
+        // If we aren't the bottom level, check if we saw this attr
+        // before. Also exclude it if the attribute type is PRIVATE.
+        //
+        if (  check_exclude
+           && (  (ap->flags & AF_PRIVATE)
+              || (pce->aflags & AF_PRIVATE)
+              || hashfindLEN(&(ap->number), sizeof(ap->number), &mudstate.parent_htab)))
+        {
+            continue;
+        }
+
+        // If we aren't the top level, remember this attr so we
+        // exclude it from now on.
+        //
+        if (hash_insert)
+        {
+            hashaddLEN(&(ap->number), sizeof(ap->number), &pce->atr, &mudstate.parent_htab);
+        }
+
+        if (  NULL == pce->pPattern
+           || (  -1 != pce->iPrefilter
+              && !pcc->abCandidate[pce->iPrefilter]))
+        {
+            continue;
+        }
+
+        UTF8 *args[NUM_ENV_VARS];
+        UTF8 *target = (pce->aflags & AF_NOPARSE) ? raw_str : str;
+        if (  NULL == pce->pProgram
+           ? regexp_match(pce->pPattern, target,
+                ((pce->aflags & AF_CASE) ? 0 : PCRE_CASELESS), args, NUM_ENV_VARS)
+           : wild_exec(pce->pProgram, target, args, NUM_ENV_VARS))
+        {
+            match = 1;
+            CLinearTimeAbsolute lta;
+            wait_que(thing, player, player, AttrTrace(pce->aflags, 0), false, lta,
+                NOTHING, 0,
+                pce->pAction,
+                NUM_ENV_VARS, (const UTF8 **)args,
+                mudstate.global_regs);
+
+            for (int j = 0; j < NUM_ENV_VARS; j++)
+            {
+                if (args[j])
+                {
+                    free_lbuf(args[j]);
+                }
+            }
+        }
+    }
+
+    if (pcc->bCommands)
+    {
+        mudstate.bfNoCommands.Clear(parent);
+        mudstate.bfCommands.Set(parent);
+    }
+    else
+    {
+        mudstate.bfCommands.Clear(parent);
+        mudstate.bfNoCommands.Set(parent);
+    }
+
+    if (pcc->bListens)
+    {
+        mudstate.bfNoListens.Clear(parent);
+        mudstate.bfListens.Set(parent);
+    }
+    else
+    {
+        mudstate.bfListens.Clear(parent);
+        mudstate.bfNoListens.Set(parent);
+    }
+    return match;
+}
+
 /* ----------------------------------------------------------------------
  * atr_match: Check attribute list for wild card matches and queue them.
  */
@@ -216,6 +703,12 @@ static int atr_match1
         return match;
     }
 
+    if (AMATCH_CMD == type)
+    {
+        return atr_match1_cmd(thing, parent, player, str, raw_str,
+            check_exclude, hash_insert);
+    }
+
     bool bFoundCommands = false;
     bool bFoundListens  = false;
 
@@ -1648,6 +2141,7 @@ void fork_and_dump(int key)
     {
         key = DUMP_TEXT+DUMP_STRUCT;
     }
+    mudstate.dump_started.GetUTC();
 
     if (*mudconf.dump_msg)
     {
@@ -1782,6 +2276,12 @@ void fork_and_dump(int key)
 #endif // HAVE_WORKING_FORK
     }
 
+    CLinearTimeAbsolute ltaDone;
+    ltaDone.GetUTC();
+    mudstate.dump_stall = ltaDone - mudstate.dump_started;
+    flight_record(FLIGHT_DUMP, NOTHING, NOTHING,
+        mudstate.dump_stall.ReturnMicroseconds(), T("stall"));
+
 #if defined(HAVE_WORKING_FORK)
     mudstate.write_protect = false;
     if (!bChildExists)
@@ -1791,6 +2291,14 @@ void fork_and_dump(int key)
         // need to dump the structure or a flatfile; or, the child has finished
         // dumping already.
         //
+        if (mudstate.dumping)
+        {
+            // A child which exited before fork() returned was counted by
+            // the SIGCHLD handler, which also cleared mudstate.dumping.
+            //
+            mudstate.dump_duration = mudstate.dump_stall;
+            mudstate.dump_count++;
+        }
         mudstate.dumper = 0;
         mudstate.dumping = false;
         local_dump_complete_signal();
@@ -1804,6 +2312,9 @@ void fork_and_dump(int key)
 #endif // TINYMUX_MODULES
     }
     bRequestAccepted = false;
+#else // HAVE_WORKING_FORK
+    mudstate.dump_duration = mudstate.dump_stall;
+    mudstate.dump_count++;
 #endif // HAVE_WORKING_FORK
 
     if (*mudconf.postdump_msg)
@@ -2405,6 +2916,314 @@ static void write_pidfile(const UTF8 *pFilename)
     }
 }
 
+// Headless benchmark mode.  The test cases in testcases/*_fn.mux are
+// unformatted the same way tools/unformat.pl does it, and the condition of
+// each case's top-level @if is evaluated repeatedly through mux_exec()
+// against the loaded database.  No ports are opened and no queue is run.
+//
+#define BENCH_MAX_FILES 64
+
+static const UTF8 *bench_files[BENCH_MAX_FILES];
+static int bench_nfiles = 0;
+static long bench_msec = 250;
+
+/*! \brief Finds the condition of an @if command.
+ *
+ * \param pBody  Command text.
+ * \param pn     Length of the condition.
+ * \return       Start of the condition or NULL if pBody is not an @if.
+ */
+
+static const UTF8 *bench_condition(const UTF8 *pBody, size_t *pn)
+{
+    int n = string_prefix(pBody, T("@if "));
+    if (0 == n)
+    {
+        return NULL;
+    }
+    pBody += n;
+    while (mux_isspace(*pBody))
+    {
+        pBody++;
+    }
+
+    int nDepth = 0;
+    const UTF8 *p = pBody;
+    while ('\0' != *p)
+    {
+        switch (*p)
+        {
+        case '%':
+        case '\\':
+            if ('\0' != p[1])
+            {
+                p++;
+            }
+            break;
+
+        case '(':
+        case '[':
+        case '{':
+            nDepth++;
+            break;
+
+        case ')':
+        case ']':
+        case '}':
+            nDepth--;
+            break;
+
+        case '=':
+            if (0 == nDepth)
+            {
+                *pn = p - pBody;
+                return pBody;
+            }
+            break;
+        }
+        p++;
+    }
+    return NULL;
+}
+
+/*! \brief Finds the object a test case is installed on.
+ *
+ * \param pName  Object name from the test case.
+ * \return       The object, or GOD if it is not in the database.
+ */
+
+static dbref bench_object(const UTF8 *pName)
+{
+    dbref thing;
+    DO_WHOLE_DB(thing)
+    {
+        if (  !Going(thing)
+           && string_compare(PureName(thing), pName) == 0)
+        {
+            return thing;
+        }
+    }
+    return GOD;
+}
+
+/*! \brief Evaluates an expression the way a queued command would.
+ *
+ * \param pExpr     Expression.
+ * \param nExpr     Length of the expression.
+ * \param executor  Object evaluating it.
+ * \param buff      Result buffer.
+ * \return          None.
+ */
+
+static void bench_eval(const UTF8 *pExpr, size_t nExpr, dbref executor, UTF8 *buff)
+{
+    pool_arena_open();
+    mudstate.func_nest_lev = 0;
+    mudstate.func_invk_ctr = 0;
+    mudstate.ntfy_nest_lev = 0;
+    mudstate.lock_nest_lev = 0;
+    mudstate.nStackNest = 0;
+    mudstate.bStackLimitReached = false;
+
+    UTF8 *bp = buff;
+    mux_exec(pExpr, nExpr, buff, &bp, executor, executor, executor,
+        EV_FCHECK|EV_EVAL|EV_TOP, NULL, 0);
+    *bp = '\0';
+    pool_arena_close();
+}
+
+/*! \brief Times one unformatted command if it installs an @if test case.
+ *
+ * \param pFile  Name of the .mux file, for the report.
+ * \param pCmd   Unformatted command.
+ * \return       None.
+ */
+
+static void bench_case(const UTF8 *pFile, UTF8 *pCmd)
+{
+    if ('&' != pCmd[0])
+    {
+        return;
+    }
+    UTF8 *pEqual = (UTF8 *)strchr((char *)pCmd, '=');
+    if (NULL == pEqual)
+    {
+        return;
+    }
+    *pEqual = '\0';
+
+    UTF8 *pAttr = pCmd + 1;
+    UTF8 *pObj = pAttr;
+    while (  '\0' != *pObj
+          && !mux_isspace(*pObj))
+    {
+        pObj++;
+    }
+    if ('\0' != *pObj)
+    {
+        *pObj++ = '\0';
+    }
+    pObj = trim_spaces(pObj);
+
+    UTF8 *pBody = pEqual + 1;
+    while (mux_isspace(*pBody))
+    {
+        pBody++;
+    }
+
+    size_t nExpr;
+    const UTF8 *pCond = bench_condition(pBody, &nExpr);
+    if (NULL == pCond)
+    {
+        free_lbuf(pObj);
+        return;
+    }
+
+    UTF8 *pExpr = alloc_lbuf("bench_case.expr");
+    memcpy(pExpr, pCond, nExpr);
+    pExpr[nExpr] = '\0';
+
+    dbref executor = bench_object(pObj);
+    free_lbuf(pObj);
+
+    // One untimed pass warms the caches and shows which way the @if goes.
+    //
+    UTF8 *buff = alloc_lbuf("bench_case");
+    bench_eval(pExpr, nExpr, executor, buff);
+    bool bTrue = xlate(buff);
+
+    INT64 nIters = 0;
+    INT64 nBatch = 1;
+    UINT64 nAllocs = pool_total_allocs();
+    CLinearTimeAbsolute ltaStart, ltaNow;
+    CLinearTimeDelta ltd;
+    ltaStart.GetUTC();
+    for (;;)
+    {
+        for (INT64 i = 0; i < nBatch; i++)
+        {
+            bench_eval(pExpr, nExpr, executor, buff);
+        }
+        nIters += nBatch;
+        ltaNow.GetUTC();
+        ltd = ltaNow - ltaStart;
+        if (bench_msec <= ltd.ReturnMilliseconds())
+        {
+            break;
+        }
+        if (nBatch < 1024)
+        {
+            nBatch *= 2;
+        }
+    }
+    nAllocs = pool_total_allocs() - nAllocs;
+
+    INT64 ns = (ltd.Return100ns() * 100 + nIters/2) / nIters;
+    UTF8 *pAllocs = mux_ftoa((double)(INT64)nAllocs / nIters, true, 2);
+
+    UTF8 *p = buff;
+    p += LeftJustifyString(p, 30, tprintf(T("%s %s"), pFile, pAttr)); *p++ = ' ';
+    p += RightJustifyNumber(p, 10, nIters, ' '); *p++ = ' ';
+    p += RightJustifyNumber(p, 12, ns, ' '); *p++ = ' ';
+    for (size_t n = strlen((char *)pAllocs); n < 10; n++)
+    {
+        *p++ = ' ';
+    }
+    safe_str(pAllocs, buff, &p);
+    *p++ = ' ';
+    *p++ = ' ';
+    safe_chr(bTrue ? '1' : '0', buff, &p);
+    *p = '\0';
+    mux_fprintf(stdout, T("%s" ENDLINE), buff);
+    fflush(stdout);
+
+    free_lbuf(buff);
+    free_lbuf(pExpr);
+}
+
+/*! \brief Unformats a .mux file and benchmarks each test case in it.
+ *
+ * \param pFile  Name of the .mux file.
+ * \return       None.
+ */
+
+static void bench_file(const UTF8 *pFile)
+{
+    FILE *fp;
+    if (!mux_fopen(&fp, pFile, T("rb")))
+    {
+        mux_fprintf(stderr, T("Couldn't open %s." ENDLINE), pFile);
+        return;
+    }
+
+    const UTF8 *pName = (UTF8 *)strrchr((char *)pFile, '/');
+    pName = (NULL == pName) ? pFile : pName + 1;
+
+    UTF8 *pLine = alloc_lbuf("bench_file.line");
+    UTF8 *pCmd = alloc_lbuf("bench_file.cmd");
+    UTF8 *bp = NULL;
+    while (fgets((char *)pLine, LBUF_SIZE, fp))
+    {
+        size_t n = strlen((char *)pLine);
+        while (  0 < n
+              && (  '\n' == pLine[n-1]
+                 || '\r' == pLine[n-1]))
+        {
+            pLine[--n] = '\0';
+        }
+
+        if (NULL == bp)
+        {
+            // Looking for the start of a command.
+            //
+            if (  '\0' != pLine[0]
+               && '#' != pLine[0]
+               && !mux_isspace(pLine[0]))
+            {
+                bp = pCmd;
+                safe_str(pLine, pCmd, &bp);
+            }
+        }
+        else if (strcmp((char *)pLine, "-") == 0)
+        {
+            *bp = '\0';
+            bench_case(pName, pCmd);
+            bp = NULL;
+        }
+        else if ('#' != pLine[0])
+        {
+            UTF8 *p = pLine;
+            while (mux_isspace(*p))
+            {
+                p++;
+            }
+            safe_str(p, pCmd, &bp);
+        }
+    }
+    if (NULL != bp)
+    {
+        *bp = '\0';
+        bench_case(pName, pCmd);
+    }
+    free_lbuf(pCmd);
+    free_lbuf(pLine);
+    fclose(fp);
+}
+
+/*! \brief Runs the benchmark over every file given with -b.
+ *
+ * \return  None.
+ */
+
+static void run_benchmarks(void)
+{
+    mux_fprintf(stdout, T("Case                           Iterations        ns/op  allocs/op  @if" ENDLINE));
+    for (int i = 0; i < bench_nfiles; i++)
+    {
+        bench_file(bench_files[i]);
+    }
+}
+
 #ifdef INLINESQL
 static void init_sql(void)
 {
@@ -2487,6 +3306,8 @@ long DebugTotalMemory = 0;
 #define CLI_DO_BASENAME    CLI_USER+9
 #define CLI_DO_PID_FILE    CLI_USER+10
 #define CLI_DO_ERRORPATH   CLI_USER+11
+#define CLI_DO_BENCHMARK   CLI_USER+12
+#define CLI_DO_BENCHTIME   CLI_USER+13
 
 static bool bMinDB = false;
 static bool bSyntaxError = false;
@@ -2511,7 +3332,9 @@ static CLI_OptionEntry OptionTable[] =
     { "d", CLI_REQUIRED, CLI_DO_BASENAME    },
 #endif // MEMORY_BASED
     { "p", CLI_REQUIRED, CLI_DO_PID_FILE    },
-    { "e", CLI_REQUIRED, CLI_DO_ERRORPATH   }
+    { "e", CLI_REQUIRED, CLI_DO_ERRORPATH   },
+    { "b", CLI_REQUIRED, CLI_DO_BENCHMARK   },
+    { "t", CLI_REQUIRED, CLI_DO_BENCHTIME   }
 };
 
 static void CLI_CallBack(CLI_OptionEntry *p, const char *pValue)
@@ -2545,6 +3368,23 @@ static void CLI_CallBack(CLI_OptionEntry *p, const char *pValue)
             pErrorBasename = (UTF8 *)pValue;
             break;
 
+        case CLI_DO_BENCHMARK:
+            bServerOption = true;
+            if (bench_nfiles < BENCH_MAX_FILES)
+            {
+                bench_files[bench_nfiles++] = (UTF8 *)pValue;
+            }
+            break;
+
+        case CLI_DO_BENCHTIME:
+            bServerOption = true;
+            bench_msec = mux_atol((UTF8 *)pValue);
+            if (bench_msec <= 0)
+            {
+                bSyntaxError = true;
+            }
+            break;
+
 #ifndef MEMORY_BASED
         case CLI_DO_INFILE:
             mudstate.bStandAlone = true;
@@ -3249,12 +4089,14 @@ int DCL_CDECL main(int argc, char *argv[])
         }
         else
         {
-            mux_fprintf(stderr, T("Usage: %s [-c <filename>] [-p <filename>] [-h] [-s] [-v]" ENDLINE), pProg);
+            mux_fprintf(stderr, T("Usage: %s [-c <filename>] [-p <filename>] [-h] [-s] [-v] [-b <filename> [-t <msec>]]" ENDLINE), pProg);
+            mux_fprintf(stderr, T("  -b  Benchmark the test cases in a .mux file and exit." ENDLINE));
             mux_fprintf(stderr, T("  -c  Specify configuration file." ENDLINE));
             mux_fprintf(stderr, T("  -e  Specify logfile basename (or '-' for stderr)." ENDLINE));
             mux_fprintf(stderr, T("  -h  Display this help." ENDLINE));
             mux_fprintf(stderr, T("  -p  Specify process ID file." ENDLINE));
             mux_fprintf(stderr, T("  -s  Start with a minimal database." ENDLINE));
+            mux_fprintf(stderr, T("  -t  Milliseconds to spend on each benchmark case." ENDLINE));
             mux_fprintf(stderr, T("  -v  Display version string." ENDLINE ENDLINE));
         }
         return 1;
@@ -3484,6 +4326,7 @@ int DCL_CDECL main(int argc, char *argv[])
             return 2;
         }
     }
+    rx_build();
     set_signals();
     Guest.StartUp();
 
@@ -3508,6 +4351,13 @@ int DCL_CDECL main(int argc, char *argv[])
     ValidateConfigurationDbrefs();
     process_preload();
 
+    if (0 < bench_nfiles)
+    {
+        run_benchmarks();
+        CLOSE;
+        return 0;
+    }
+
 #if defined(HAVE_WORKING_FORK)
     load_restart_db();
     if (!mudstate.restarting)
@@ -27,6 +27,7 @@ typedef struct bque BQUE;
 struct bque
 {
     CLinearTimeAbsolute waittime;   // time to run command
+    CLinearTimeAbsolute readytime;  // when the command could first run
     dbref   executor;               // executor who will do command
     dbref   caller;                 // caller.
     dbref   enactor;                // enactor causing command (for %N)
@@ -153,13 +153,39 @@ struct prog_data
 #define CHARSET_LATIN2          3
 #define CHARSET_UTF8            4
 
+//! \def NVT_OPTION_SLOTS
+// Number of telnet options which can be in some state other than OPTION_NO
+// at once. This is more than the number of options we ever ask for or agree
+// to.
+//
+#define NVT_OPTION_SLOTS 12
+
+typedef struct
+{
+    unsigned char option;
+    unsigned char him;
+    unsigned char us;
+} NVT_OPTION_STATE;
+
 typedef struct descriptor_data DESC;
 struct descriptor_data
 {
-  CLinearTimeAbsolute connected_at;
+  // The fields used by the DESC_ITER_ALL walks in shovechars(), check_idle()
+  // and update_quotas() are kept together at the front.
+  //
+  struct descriptor_data *next;
+  SOCKET descriptor;
+  int flags;
+  dbref player;
+  int quota;
+  int timeout;
+  TBLOCK *output_head;
+  CBLK *input_head;
   CLinearTimeAbsolute last_time;
 
-  SOCKET descriptor;
+  CLinearTimeAbsolute connected_at;
+  struct descriptor_data **prev;
+  struct descriptor_data *hashnext;
 
 #if defined(WINDOWS_NETWORKING)
   // these are for the Windows NT TCP/IO
@@ -172,42 +198,56 @@ struct descriptor_data
   bool bCallProcessOutputLater;   // Does the socket need priming for output.
 #endif // WINDOWS_NETWORKING
 
-  int flags;
+#if defined(UNIX_NETWORKING_THREADS)
+  // With io_threads, the socket is served by the thread numbered io_thread
+  // (otherwise -1), and io_pending counts messages about this descriptor
+  // still on their way to the main thread.
+  //
+  int io_thread;
+  int io_slot;
+  int io_state;
+  volatile int io_pending;
+#define IO_OPEN      0  // Reading and writing.
+#define IO_THROTTLED 1  // Lines were passed up and have not all been run.
+#define IO_CLOSING   2  // The connection failed; waiting for shutdownsock().
+#endif // UNIX_NETWORKING_THREADS
+
   int retries_left;
   int command_count;
-  int timeout;
-  dbref player;
   UTF8 *output_prefix;
   UTF8 *output_suffix;
   size_t output_size;
   size_t output_tot;
   size_t output_lost;
-  TBLOCK *output_head;
   TBLOCK *output_tail;
   size_t input_size;
   size_t input_tot;
   size_t input_lost;
-  CBLK *input_head;
   CBLK *input_tail;
+
+  // raw_input holds a partly-received line and aOption a partly-received
+  // telnet subnegotiation. Both are only allocated while in use.
+  //
   CBLK *raw_input;
   UTF8 *raw_input_at;
   size_t        nOption;
-  unsigned char aOption[SBUF_SIZE];
+  unsigned char *aOption;
   int raw_input_state;
   int raw_codepoint_state;
   size_t raw_codepoint_length;
-  int nvt_him_state[256];
-  int nvt_us_state[256];
+
+  // Negotiation state for options not in the OPTION_NO state on either side.
+  // Use HimState() and UsState() to read it.
+  //
+  int nvt_nstate;
+  NVT_OPTION_STATE nvt_state[NVT_OPTION_SLOTS];
+
   UTF8 *ttype;
   int encoding;
   int negotiated_encoding;
   int width;
   int height;
-  int quota;
   PROG *program_data;
-  struct descriptor_data *hashnext;
-  struct descriptor_data *next;
-  struct descriptor_data **prev;
 
   mux_sockaddr address;   /* added 3/6/90 SCG */
 
@@ -222,6 +262,8 @@ struct descriptor_data
 
 int HimState(DESC *d, unsigned char chOption);
 int UsState(DESC *d, unsigned char chOption);
+void InitOptionState(DESC *d);
+void RestoreOptionState(DESC *d, unsigned char chOption, int iHimState, int iUsState);
 void EnableHim(DESC *d, unsigned char chOption);
 void DisableHim(DESC *d, unsigned char chOption);
 void EnableUs(DESC *d, unsigned char chOption);
@@ -269,6 +311,14 @@ extern void shutdownsock(DESC *, int);
 extern void SetupPorts(int *pnPorts, PortInfo aPorts[], IntArray *pia, IntArray *piaSSL, const UTF8 *ip_address);
 extern void shovechars(int nPorts, PortInfo aPorts[]);
 void process_output(void *, int);
+#if defined(UNIX_NETWORKING_THREADS)
+extern bool lock_descriptor(DESC *d);
+extern void unlock_descriptor(DESC *d);
+extern bool on_io_thread(void);
+extern void io_input_drained(DESC *d);
+extern void stop_io_threads(void);
+#endif // UNIX_NETWORKING_THREADS
+extern void SetDescriptorEncoding(DESC *d, int iEncoding);
 #if defined(HAVE_WORKING_FORK)
 extern void dump_restart_db(void);
 #endif // HAVE_WORKING_FORK
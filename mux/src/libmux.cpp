@@ -15,6 +15,11 @@
 
 #include "libmux.h"
 
+#if defined(PIPE_RING)
+#include <sys/mman.h>
+#include <sys/eventfd.h>
+#endif // PIPE_RING
+
 extern "C"
 {
     typedef MUX_RESULT FPCANUNLOADNOW(void);
@@ -112,6 +117,10 @@ static QUEUE_INFO *g_pQueue_Out = NULL;
 static CHANNEL_INFO *aChannels = NULL;
 static UINT32        nChannels = 0;
 
+#if defined(UNIX_FILES)
+static int g_aCompletionPipe[2] = { -1, -1 };
+#endif // UNIX_FILES
+
 static LibraryState    g_LibraryState   = eLibraryDown;
 static process_context g_ProcessContext = IsUninitialized;
 
@@ -1302,6 +1311,16 @@ extern "C" MUX_RESULT DCL_EXPORT DCL_API mux_FinalizeModuleLibrary(void)
             pModule = pModule->pNext;
         }
 
+#if defined(UNIX_FILES)
+        if (0 <= g_aCompletionPipe[0])
+        {
+            close(g_aCompletionPipe[0]);
+            close(g_aCompletionPipe[1]);
+            g_aCompletionPipe[0] = -1;
+            g_aCompletionPipe[1] = -1;
+        }
+#endif // UNIX_FILES
+
         g_LibraryState   = eLibraryDown;
         g_ProcessContext = IsUninitialized;
     }
@@ -1744,6 +1763,7 @@ extern "C" void DCL_EXPORT DCL_API Pipe_AppendBytes(QUEUE_INFO *pqi, size_t n, c
     {
         // Continue copying data to the end of the queue until it is all consumed.
         //
+        const UINT8 *pch = static_cast<const UINT8 *>(p);
         QUEUE_BLOCK *pBlock = NULL;
         while (0 < n)
         {
@@ -1806,7 +1826,8 @@ extern "C" void DCL_EXPORT DCL_API Pipe_AppendBytes(QUEUE_INFO *pqi, size_t n, c
                 nCopy = n;
             }
 
-            memcpy(pFree, p, nCopy);
+            memcpy(pFree, pch, nCopy);
+            pch += nCopy;
             n -= nCopy;
             pBlock->nBuffer += nCopy;
             pqi->nBytes += nCopy;
@@ -2040,29 +2061,52 @@ const UINT8 decoder_stt[23][21] =
 
 // Decode bytes out of Queue_In to Queue_Frame.
 //
-extern "C" bool DCL_EXPORT DCL_API Pipe_DecodeFrames(UINT32 iReturnChannel, QUEUE_INFO *pqiFrame)
+// Move up to n bytes from the front of pqiIn to the end of pqiOut.  This
+// copies straight from one block to another without an intermediate buffer.
+//
+static size_t Pipe_MoveBytes(QUEUE_INFO *pqiOut, QUEUE_INFO *pqiIn, size_t n)
 {
-    UINT8 buffer[512];
+    size_t nMoved = 0;
+    QUEUE_BLOCK *pBlock;
+    while (  nMoved < n
+          && NULL != (pBlock = pqiIn->pHead))
+    {
+        if (0 == pBlock->nBuffer)
+        {
+            pqiIn->pHead = pBlock->pNext;
+            if (NULL == pqiIn->pHead)
+            {
+                pqiIn->pTail = NULL;
+            }
+            delete pBlock;
+            continue;
+        }
+
+        size_t nCopy = pBlock->nBuffer;
+        if (n - nMoved < nCopy)
+        {
+            nCopy = n - nMoved;
+        }
 
+        Pipe_AppendBytes(pqiOut, nCopy, pBlock->pBuffer);
+        pBlock->pBuffer += nCopy;
+        pBlock->nBuffer -= nCopy;
+        pqiIn->nBytes -= nCopy;
+        nMoved += nCopy;
+    }
+    return nMoved;
+}
+
+extern "C" bool DCL_EXPORT DCL_API Pipe_DecodeFrames(UINT32 iReturnChannel, QUEUE_INFO *pqiFrame)
+{
     if (8 == g_iState)
     {
         // We must remain in the Length3 state until we have consumed all of the expected data.
         //
-        while (0 < g_nLengthRemaining)
+        g_nLengthRemaining -= Pipe_MoveBytes(pqiFrame, g_pQueue_In, g_nLengthRemaining);
+        if (0 < g_nLengthRemaining)
         {
-            size_t nWanted = g_nLengthRemaining;
-            if (sizeof(buffer) < nWanted)
-            {
-                nWanted = sizeof(buffer);
-            }
-
-            if (  !Pipe_GetBytes(g_pQueue_In, &nWanted, buffer)
-               || 0 == nWanted)
-            {
-                return false;
-            }
-            Pipe_AppendBytes(pqiFrame, nWanted, buffer);
-            g_nLengthRemaining -= nWanted;
+            return false;
         }
     }
 
@@ -2106,23 +2150,12 @@ extern "C" bool DCL_EXPORT DCL_API Pipe_DecodeFrames(UINT32 iReturnChannel, QUEU
 
             // We've been told how long to expect the packet to be.
             //
-            while (0 < g_nLengthRemaining)
+            g_nLengthRemaining -= Pipe_MoveBytes(pqiFrame, g_pQueue_In, g_nLengthRemaining);
+            if (0 < g_nLengthRemaining)
             {
-                size_t nWanted = g_nLengthRemaining;
-                if (sizeof(buffer) < nWanted)
-                {
-                    nWanted = sizeof(buffer);
-                }
-
-                if (  !Pipe_GetBytes(g_pQueue_In, &nWanted, buffer)
-                   || 0 == nWanted)
-                {
-                    // We'll leave the state machine and try to pick up again at the same place later.
-                    //
-                    return false;
-                }
-                Pipe_AppendBytes(pqiFrame, nWanted, buffer);
-                g_nLengthRemaining -= nWanted;
+                // We'll leave the state machine and try to pick up again at the same place later.
+                //
+                return false;
             }
             break;
 
@@ -2269,3 +2302,365 @@ extern "C" MUX_RESULT DCL_EXPORT DCL_API Pipe_SendDiscPacket(UINT32 iReturnChann
     Pipe_AppendBytes(g_pQueue_Out, sizeof(EndMagic), EndMagic);
     return MUX_S_OK;
 }
+
+// Completions travel through a pipe.  A COMPLETION is smaller than PIPE_BUF,
+// so each write() is atomic with respect to writes from other threads, and
+// the pipe itself serves as the thread-safe queue.
+//
+typedef struct
+{
+    FCOMPLETION *pfCompletion;
+    void        *pContext;
+} COMPLETION;
+
+extern "C" int DCL_EXPORT DCL_API Pipe_GetCompletionHandle(void)
+{
+#if defined(UNIX_FILES)
+    if (  g_aCompletionPipe[0] < 0
+       && 0 == pipe(g_aCompletionPipe))
+    {
+        // Only the reading side is non-blocking.  A writer which gets too far
+        // ahead of the main thread should wait for it.
+        //
+        fcntl(g_aCompletionPipe[0], F_SETFL, fcntl(g_aCompletionPipe[0], F_GETFL, 0) | O_NONBLOCK);
+        fcntl(g_aCompletionPipe[0], F_SETFD, FD_CLOEXEC);
+        fcntl(g_aCompletionPipe[1], F_SETFD, FD_CLOEXEC);
+    }
+    return g_aCompletionPipe[0];
+#else
+    return -1;
+#endif // UNIX_FILES
+}
+
+extern "C" MUX_RESULT DCL_EXPORT DCL_API Pipe_PostCompletion(FCOMPLETION *pfCompletion, void *pContext)
+{
+#if defined(UNIX_FILES)
+    if (  NULL == pfCompletion
+       || g_aCompletionPipe[1] < 0)
+    {
+        return MUX_E_NOTREADY;
+    }
+
+    COMPLETION c;
+    c.pfCompletion = pfCompletion;
+    c.pContext     = pContext;
+
+    for (;;)
+    {
+        ssize_t n = write(g_aCompletionPipe[1], &c, sizeof(c));
+        if (sizeof(c) == n)
+        {
+            return MUX_S_OK;
+        }
+        else if (  n < 0
+                && EINTR != errno)
+        {
+            return MUX_E_FAIL;
+        }
+    }
+#else
+    UNUSED_PARAMETER(pfCompletion);
+    UNUSED_PARAMETER(pContext);
+    return MUX_E_NOTIMPLEMENTED;
+#endif // UNIX_FILES
+}
+
+extern "C" void DCL_EXPORT DCL_API Pipe_RunCompletions(void)
+{
+#if defined(UNIX_FILES)
+    if (g_aCompletionPipe[0] < 0)
+    {
+        return;
+    }
+
+    COMPLETION c;
+    while (sizeof(c) == read(g_aCompletionPipe[0], &c, sizeof(c)))
+    {
+        c.pfCompletion(c.pContext);
+    }
+#endif // UNIX_FILES
+}
+
+#if defined(PIPE_RING)
+
+// Each ring is a power of two in size.  The indices run freely and are
+// reduced modulo RING_SIZE when used.  Each index is written by only one
+// side, and the two are kept on separate cache lines.  bWriterWaiting is set
+// by a producer which found the ring full, and the consumer signals it after
+// making room.
+//
+#define RING_SIZE (8*QUEUE_BLOCK_SIZE)
+#define RING_BARRIER() __sync_synchronize()
+
+typedef struct
+{
+    volatile UINT32 iWrite;
+    volatile UINT32 bWriterWaiting;
+    char            aPad1[56];
+    volatile UINT32 iRead;
+    char            aPad2[60];
+    char            aBuffer[RING_SIZE];
+} SHARED_RING;
+
+// The creator (netmux) produces into the first ring and consumes from the
+// second.  The other side (stubslave) does the reverse.
+//
+static SHARED_RING *g_aRings        = NULL;
+static SHARED_RING *g_pRingIn       = NULL;
+static SHARED_RING *g_pRingOut      = NULL;
+static int        g_fdRingWake     = -1;
+static int        g_fdRingWakePeer = -1;
+
+static bool Ring_Map(int fdShared, bool bCreator)
+{
+    void *p = mmap(NULL, 2*sizeof(SHARED_RING), PROT_READ|PROT_WRITE, MAP_SHARED, fdShared, 0);
+    if (MAP_FAILED == p)
+    {
+        return false;
+    }
+
+    g_aRings = static_cast<SHARED_RING *>(p);
+    if (bCreator)
+    {
+        g_pRingOut = &g_aRings[0];
+        g_pRingIn  = &g_aRings[1];
+    }
+    else
+    {
+        g_pRingOut = &g_aRings[1];
+        g_pRingIn  = &g_aRings[0];
+    }
+    return true;
+}
+
+static void Ring_Signal(void)
+{
+    UINT64 n = 1;
+    while (  write(g_fdRingWakePeer, &n, sizeof(n)) < 0
+          && EINTR == errno)
+    {
+        ; // Nothing.
+    }
+}
+#endif // PIPE_RING
+
+extern "C" MUX_RESULT DCL_EXPORT DCL_API Pipe_CreateRing(int *pfdShared, int *pfdWake, int *pfdWakePeer)
+{
+#if defined(PIPE_RING)
+    Pipe_CloseRing();
+
+    // A memfd starts out zero-filled, so both rings start out empty.  All
+    // three descriptors are close-on-exec so that no other child of ours
+    // inherits them.  The caller clears that in the one child which should.
+    //
+    int fdShared = memfd_create("muxring", MFD_CLOEXEC);
+    if (fdShared < 0)
+    {
+        return MUX_E_FAIL;
+    }
+
+    int fdWake = -1;
+    int fdWakePeer = -1;
+    if (  0 != ftruncate(fdShared, 2*sizeof(SHARED_RING))
+       || (fdWake = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) < 0
+       || (fdWakePeer = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) < 0
+       || !Ring_Map(fdShared, true))
+    {
+        if (0 <= fdWake)
+        {
+            close(fdWake);
+        }
+        if (0 <= fdWakePeer)
+        {
+            close(fdWakePeer);
+        }
+        close(fdShared);
+        return MUX_E_FAIL;
+    }
+
+    g_fdRingWake     = fdWake;
+    g_fdRingWakePeer = fdWakePeer;
+
+    // The caller passes all three descriptors to the other process and
+    // closes fdShared afterwards.  The two eventfds remain ours.
+    //
+    *pfdShared   = fdShared;
+    *pfdWake     = fdWake;
+    *pfdWakePeer = fdWakePeer;
+    return MUX_S_OK;
+#else
+    UNUSED_PARAMETER(pfdShared);
+    UNUSED_PARAMETER(pfdWake);
+    UNUSED_PARAMETER(pfdWakePeer);
+    return MUX_E_NOTIMPLEMENTED;
+#endif // PIPE_RING
+}
+
+extern "C" MUX_RESULT DCL_EXPORT DCL_API Pipe_AttachRing(int fdShared, int fdWake, int fdWakePeer)
+{
+#if defined(PIPE_RING)
+    Pipe_CloseRing();
+
+    bool bMapped = Ring_Map(fdShared, false);
+    close(fdShared);
+    if (!bMapped)
+    {
+        close(fdWake);
+        close(fdWakePeer);
+        return MUX_E_FAIL;
+    }
+
+    fcntl(fdWake, F_SETFD, FD_CLOEXEC);
+    fcntl(fdWakePeer, F_SETFD, FD_CLOEXEC);
+    g_fdRingWake     = fdWake;
+    g_fdRingWakePeer = fdWakePeer;
+    return MUX_S_OK;
+#else
+    UNUSED_PARAMETER(fdShared);
+    UNUSED_PARAMETER(fdWake);
+    UNUSED_PARAMETER(fdWakePeer);
+    return MUX_E_NOTIMPLEMENTED;
+#endif // PIPE_RING
+}
+
+extern "C" void DCL_EXPORT DCL_API Pipe_CloseRing(void)
+{
+#if defined(PIPE_RING)
+    if (NULL != g_aRings)
+    {
+        munmap(g_aRings, 2*sizeof(SHARED_RING));
+        g_aRings   = NULL;
+        g_pRingIn  = NULL;
+        g_pRingOut = NULL;
+    }
+
+    if (0 <= g_fdRingWake)
+    {
+        close(g_fdRingWake);
+        g_fdRingWake = -1;
+    }
+
+    if (0 <= g_fdRingWakePeer)
+    {
+        close(g_fdRingWakePeer);
+        g_fdRingWakePeer = -1;
+    }
+#endif // PIPE_RING
+}
+
+extern "C" int DCL_EXPORT DCL_API Pipe_GetRingHandle(void)
+{
+#if defined(PIPE_RING)
+    if (NULL != g_aRings)
+    {
+        return g_fdRingWake;
+    }
+#endif // PIPE_RING
+    return -1;
+}
+
+extern "C" void DCL_EXPORT DCL_API Pipe_ReadRing(QUEUE_INFO *pqiIn)
+{
+#if defined(PIPE_RING)
+    if (NULL == g_aRings)
+    {
+        return;
+    }
+
+    // Reset the eventfd before looking at the ring so that a signal which
+    // arrives after this point is not lost.
+    //
+    UINT64 n;
+    if (read(g_fdRingWake, &n, sizeof(n)) < 0)
+    {
+        ; // Nothing was pending.
+    }
+
+    UINT32 iWrite = g_pRingIn->iWrite;
+    RING_BARRIER();
+    UINT32 iRead = g_pRingIn->iRead;
+    if (iRead != iWrite)
+    {
+        UINT32 nAvailable = iWrite - iRead;
+        UINT32 iStart = iRead & (RING_SIZE - 1);
+        UINT32 nFirst = RING_SIZE - iStart;
+        if (nAvailable < nFirst)
+        {
+            nFirst = nAvailable;
+        }
+        Pipe_AppendBytes(pqiIn, nFirst, g_pRingIn->aBuffer + iStart);
+        if (nFirst < nAvailable)
+        {
+            Pipe_AppendBytes(pqiIn, nAvailable - nFirst, g_pRingIn->aBuffer);
+        }
+
+        RING_BARRIER();
+        g_pRingIn->iRead = iWrite;
+        RING_BARRIER();
+        if (g_pRingIn->bWriterWaiting)
+        {
+            g_pRingIn->bWriterWaiting = 0;
+            Ring_Signal();
+        }
+    }
+#else
+    UNUSED_PARAMETER(pqiIn);
+#endif // PIPE_RING
+}
+
+extern "C" void DCL_EXPORT DCL_API Pipe_WriteRing(QUEUE_INFO *pqiOut)
+{
+#if defined(PIPE_RING)
+    if (NULL == g_aRings)
+    {
+        return;
+    }
+
+    bool bSignal = false;
+    while (0 < Pipe_QueueLength(pqiOut))
+    {
+        UINT32 iWrite = g_pRingOut->iWrite;
+        UINT32 iRead  = g_pRingOut->iRead;
+        RING_BARRIER();
+
+        UINT32 nFree = RING_SIZE - (iWrite - iRead);
+        if (0 == nFree)
+        {
+            // The other side signals us once it makes room, unless it made
+            // room while we were deciding to wait.
+            //
+            g_pRingOut->bWriterWaiting = 1;
+            RING_BARRIER();
+            if (g_pRingOut->iRead == iRead)
+            {
+                break;
+            }
+            continue;
+        }
+
+        UINT32 iStart = iWrite & (RING_SIZE - 1);
+        size_t nCopy = RING_SIZE - iStart;
+        if (nFree < nCopy)
+        {
+            nCopy = nFree;
+        }
+
+        if (  !Pipe_GetBytes(pqiOut, &nCopy, g_pRingOut->aBuffer + iStart)
+           || 0 == nCopy)
+        {
+            break;
+        }
+
+        RING_BARRIER();
+        g_pRingOut->iWrite = iWrite + static_cast<UINT32>(nCopy);
+        bSignal = true;
+    }
+
+    if (bSignal)
+    {
+        Ring_Signal();
+    }
+#else
+    UNUSED_PARAMETER(pqiOut);
+#endif // PIPE_RING
+}
@@ -184,6 +184,36 @@ extern "C" MUX_RESULT    DCL_EXPORT DCL_API Pipe_SendCallPacketAndWait(UINT32 nC
 extern "C" MUX_RESULT    DCL_EXPORT DCL_API Pipe_SendMsgPacket(UINT32 nChannel, QUEUE_INFO *pqi);
 extern "C" MUX_RESULT    DCL_EXPORT DCL_API Pipe_SendDiscPacket(UINT32 nChannel, QUEUE_INFO *pqi);
 
+// Libmux itself is single-threaded, but a module may do work on threads of
+// its own.  That work is handed back to the main thread as a completion.
+// Pipe_PostCompletion() may be called from any thread.  The hosting process
+// waits on the completion handle alongside its pipe and calls
+// Pipe_RunCompletions() on the main thread when the handle becomes readable.
+//
+typedef void FCOMPLETION(void *pContext);
+
+extern "C" MUX_RESULT    DCL_EXPORT DCL_API Pipe_PostCompletion(FCOMPLETION *pfCompletion, void *pContext);
+extern "C" int           DCL_EXPORT DCL_API Pipe_GetCompletionHandle(void);
+extern "C" void          DCL_EXPORT DCL_API Pipe_RunCompletions(void);
+
+// By default, netmux and stubslave exchange frames over a socket.  Where
+// shared memory and eventfd are available, netmux also creates a pair of
+// single-producer/single-consumer rings (one per direction) in memory shared
+// with stubslave, and each side waits on an eventfd which the other side
+// signals.  The frames carried by the rings are the same.  Pipe_ReadRing()
+// and Pipe_WriteRing() take the place of reading and writing the socket.
+//
+#if defined(HAVE_SYS_EVENTFD_H) && defined(HAVE_SYS_MMAN_H) && defined(HAVE_MEMFD_CREATE)
+#define PIPE_RING
+#endif // HAVE_SYS_EVENTFD_H && HAVE_SYS_MMAN_H && HAVE_MEMFD_CREATE
+
+extern "C" MUX_RESULT    DCL_EXPORT DCL_API Pipe_CreateRing(int *pfdShared, int *pfdWake, int *pfdWakePeer);
+extern "C" MUX_RESULT    DCL_EXPORT DCL_API Pipe_AttachRing(int fdShared, int fdWake, int fdWakePeer);
+extern "C" void          DCL_EXPORT DCL_API Pipe_CloseRing(void);
+extern "C" int           DCL_EXPORT DCL_API Pipe_GetRingHandle(void);
+extern "C" void          DCL_EXPORT DCL_API Pipe_ReadRing(QUEUE_INFO *pqiIn);
+extern "C" void          DCL_EXPORT DCL_API Pipe_WriteRing(QUEUE_INFO *pqiOut);
+
 // The following is part of what is called 'Custom Marshaling'.
 //
 interface mux_IMarshal : public mux_IUnknown
@@ -1018,7 +1018,7 @@ static bool show_a_desc(dbref player, dbref loc)
 
     dbref aowner1;
     int   aflags1;
-    bool indent = (isRoom(loc) && mudconf.indent_desc && atr_get_raw(loc, A_DESC));
+    bool indent = (isRoom(loc) && mudconf.indent_desc && atr_exists(loc, A_DESC));
 
     UTF8 *DescFormat = atr_pget(loc, A_DESCFORMAT, &aowner1, &aflags1);
     if (*DescFormat)
@@ -2067,6 +2067,33 @@ void do_inventory(dbref executor, dbref caller, dbref enactor, int eval, int key
     do_score(executor, caller, executor, 0, 0);
 }
 
+// Objects with a forwarding list that includes target.
+//
+static int forwarders(dbref target, dbref *aList)
+{
+    int n = 0;
+    int nKey;
+    UTF8 *pKey;
+    for (FWDLIST *fp = (FWDLIST *)hash_firstkey(&mudstate.fwdlist_htab, &nKey, &pKey);
+         NULL != fp;
+         fp = (FWDLIST *)hash_nextkey(&mudstate.fwdlist_htab, &nKey, &pKey))
+    {
+        for (int j = 0; j < fp->count; j++)
+        {
+            if (fp->data[j] == target)
+            {
+                if (NULL != aList)
+                {
+                    memcpy(&aList[n], pKey, sizeof(dbref));
+                }
+                n++;
+                break;
+            }
+        }
+    }
+    return n;
+}
+
 void do_entrances(dbref executor, dbref caller, dbref enactor, int eval, int key, UTF8 *name, const UTF8 *cargs[], int ncargs)
 {
     UNUSED_PARAMETER(caller);
@@ -2115,11 +2142,34 @@ void do_entrances(dbref executor, dbref caller, dbref enactor, int eval, int key
             mudconf.many_coins));
         return;
     }
+    // Only objects listed under thing as an entrance or as a parent, and
+    // objects that forward to it, need to be looked at.
+    //
+    int nList = rx_gather(RX_ENTRANCE, thing, NULL)
+              + rx_gather(RX_PARENT, thing, NULL)
+              + forwarders(thing, NULL);
+    dbref *aList = NULL;
+    if (0 < nList)
+    {
+        aList = (dbref *)MEMALLOC(nList * sizeof(dbref));
+        ISOUTOFMEMORY(aList);
+        int n = rx_gather(RX_ENTRANCE, thing, aList);
+        n += rx_gather(RX_PARENT, thing, aList + n);
+        n += forwarders(thing, aList + n);
+        nList = rx_sort(aList, n);
+    }
+
     message = alloc_lbuf("do_entrances");
     control_thing = Examinable(executor, thing);
     count = 0;
-    for (i = low_bound; i <= high_bound; i++)
+    for (int k = 0; k < nList; k++)
     {
+        i = aList[k];
+        if (  i < low_bound
+           || high_bound < i)
+        {
+            continue;
+        }
         if (control_thing || Examinable(executor, i))
         {
             switch (Typeof(i))
@@ -2187,6 +2237,11 @@ void do_entrances(dbref executor, dbref caller, dbref enactor, int eval, int key
             }
         }
     }
+    if (NULL != aList)
+    {
+        MEMFREE(aList);
+        aList = NULL;
+    }
     free_lbuf(message);
     notify(executor, tprintf(T("%d entrance%s found."), count,
         (count == 1) ? "" : "s"));
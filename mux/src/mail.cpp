@@ -1981,7 +1981,7 @@ static void do_expmail_start(dbref player, UTF8 *arg, UTF8 *subject)
     atr_add_raw(player, A_MAILSUB, subject);
     atr_add_raw(player, A_MAILFLAGS, T("0"));
     atr_clr(player, A_MAILMSG);
-    Flags2(player) |= PLAYER_MAILS;
+    s_Flags(player, FLAG_WORD2, Flags2(player) | PLAYER_MAILS);
     UTF8 *names = make_namelist(player, tolist);
     raw_notify(player, tprintf(T("MAIL: You are sending mail to \xE2\x80\x98%s\xE2\x80\x99."), names));
     free_lbuf(names);
@@ -4169,7 +4169,7 @@ static void do_expmail_stop(dbref player, int flags)
             free_lbuf(mailflags);
             free_lbuf(mailsub);
 
-            Flags2(player) &= ~PLAYER_MAILS;
+            s_Flags(player, FLAG_WORD2, Flags2(player) & ~PLAYER_MAILS);
         }
         free_lbuf(pMailMsg);
     }
@@ -4177,7 +4177,7 @@ static void do_expmail_stop(dbref player, int flags)
 
 static void do_expmail_abort(dbref player)
 {
-    Flags2(player) &= ~PLAYER_MAILS;
+    s_Flags(player, FLAG_WORD2, Flags2(player) & ~PLAYER_MAILS);
     raw_notify(player, T("MAIL: Message aborted."));
 }
 
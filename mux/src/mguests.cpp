@@ -165,7 +165,10 @@ const UTF8 *CGuests::Create(DESC *d)
 
             // Copy flags from guest prototype.
             //
-            db[guest_player].fs = db[mudconf.guest_char].fs;
+            for (int j = FLAG_WORD1; j <= FLAG_WORD3; j++)
+            {
+                s_Flags(guest_player, j, db[mudconf.guest_char].fs.word[j]);
+            }
 
             // Strip flags, enforce PLAYER type.
             //
@@ -333,7 +336,9 @@ dbref CGuests::MakeGuestChar(void)
     //
     FLAGSET f = db[mudconf.guest_char].fs;
     f.word[FLAG_WORD1] |= TYPE_PLAYER;
-    db[player].fs = f;
+    s_Flags(player, FLAG_WORD1, f.word[FLAG_WORD1]);
+    s_Flags(player, FLAG_WORD2, f.word[FLAG_WORD2]);
+    s_Flags(player, FLAG_WORD3, f.word[FLAG_WORD3]);
 
     // Strip flags.
     //
@@ -115,6 +115,7 @@ extern "C" MUX_RESULT DCL_API netmux_GetClassObject(MUX_CID cid, MUX_IID iid, vo
 #ifdef STUB_SLAVE
 QUEUE_INFO Queue_In;
 QUEUE_INFO Queue_Out;
+QUEUE_INFO Queue_Frame;
 #endif
 
 void init_modules(void)
@@ -122,6 +123,7 @@ void init_modules(void)
 #ifdef STUB_SLAVE
     Pipe_InitializeQueueInfo(&Queue_In);
     Pipe_InitializeQueueInfo(&Queue_Out);
+    Pipe_InitializeQueueInfo(&Queue_Frame);
     MUX_RESULT mr = mux_InitModuleLibrary(IsMainProcess, pipepump, &Queue_In, &Queue_Out);
 #else
     MUX_RESULT mr = mux_InitModuleLibrary(IsMainProcess, NULL, NULL, NULL);
@@ -1072,12 +1074,19 @@ MUX_RESULT CStubSlaveProxyFactory::LockServer(bool bLock)
 
 // CQueryClient component which is not directly accessible.
 //
-CQueryClient::CQueryClient(void) : m_cRef(1)
+CQueryClient::CQueryClient(void) : m_cRef(1), m_pPending(NULL)
 {
 }
 
 CQueryClient::~CQueryClient()
 {
+    while (NULL != m_pPending)
+    {
+        PENDING_ROWS *p = m_pPending;
+        m_pPending = p->pNext;
+        Pipe_EmptyQueue(&p->qiRows);
+        delete p;
+    }
 }
 
 MUX_RESULT CQueryClient::QueryInterface(MUX_IID iid, void **ppv)
@@ -1191,6 +1200,35 @@ MUX_RESULT CQueryClient_Call(CHANNEL_INFO *pci, QUEUE_INFO *pqi)
             return MUX_S_OK;
         }
         break;
+
+    case 4:  // MUX_RESULT Rows(UINT32 iQueryHandle, QUEUE_INFO *pqiRows)
+        {
+            struct FRAME
+            {
+                UINT32 iQueryHandle;
+            } CallFrame;
+
+            struct RETURN
+            {
+                MUX_RESULT mr;
+            } ReturnFrame = { MUX_S_OK };
+
+            nWanted = sizeof(CallFrame);
+            if (  !Pipe_GetBytes(pqi, &nWanted, &CallFrame)
+               || nWanted != sizeof(CallFrame))
+            {
+                ReturnFrame.mr = MUX_E_INVALIDARG;
+            }
+            else
+            {
+                ReturnFrame.mr = pIQuerySink->Rows(CallFrame.iQueryHandle, pqi);
+            }
+
+            Pipe_EmptyQueue(pqi);
+            Pipe_AppendBytes(pqi, sizeof(ReturnFrame), &ReturnFrame);
+            return MUX_S_OK;
+        }
+        break;
     }
     return MUX_E_NOTIMPLEMENTED;
 }
@@ -1312,8 +1350,75 @@ MUX_RESULT CQueryClient::DisconnectObject(void)
     return MUX_S_OK;
 }
 
+MUX_RESULT CQueryClient::Rows(UINT32 hQuery, QUEUE_INFO *pqiRows)
+{
+    PENDING_ROWS *p = m_pPending;
+    while (  NULL != p
+          && p->iQueryHandle != hQuery)
+    {
+        p = p->pNext;
+    }
+
+    if (NULL == p)
+    {
+        try
+        {
+            p = new PENDING_ROWS;
+        }
+        catch (...)
+        {
+            ; // Nothing.
+        }
+
+        if (NULL == p)
+        {
+            return MUX_E_OUTOFMEMORY;
+        }
+
+        p->iQueryHandle = hQuery;
+        Pipe_InitializeQueueInfo(&p->qiRows);
+        p->pNext = m_pPending;
+        m_pPending = p;
+    }
+
+    Pipe_AppendQueue(&p->qiRows, pqiRows);
+    return MUX_S_OK;
+}
+
 MUX_RESULT CQueryClient::Result(UINT32 hQuery, UINT32 iError, QUEUE_INFO *pqiResultsSet)
 {
+    // If rows for this query arrived ahead of time, splice them back in
+    // between the field count and the remaining rows.
+    //
+    QUEUE_INFO qiResultsSet;
+    Pipe_InitializeQueueInfo(&qiResultsSet);
+
+    PENDING_ROWS **pp = &m_pPending;
+    while (  NULL != *pp
+          && (*pp)->iQueryHandle != hQuery)
+    {
+        pp = &(*pp)->pNext;
+    }
+
+    if (NULL != *pp)
+    {
+        PENDING_ROWS *p = *pp;
+        *pp = p->pNext;
+
+        int nFields = 0;
+        size_t nWanted = sizeof(nFields);
+        if (  Pipe_GetBytes(pqiResultsSet, &nWanted, &nFields)
+           && nWanted == sizeof(nFields))
+        {
+            Pipe_AppendBytes(&qiResultsSet, sizeof(nFields), &nFields);
+            Pipe_AppendQueue(&qiResultsSet, &p->qiRows);
+            Pipe_AppendQueue(&qiResultsSet, pqiResultsSet);
+            pqiResultsSet = &qiResultsSet;
+        }
+        Pipe_EmptyQueue(&p->qiRows);
+        delete p;
+    }
+
 #if defined(STUB_SLAVE)
     CResultsSet *prs = NULL;
     try
@@ -1329,8 +1434,8 @@ MUX_RESULT CQueryClient::Result(UINT32 hQuery, UINT32 iError, QUEUE_INFO *pqiRes
 #else
     UNUSED_PARAMETER(hQuery);
     UNUSED_PARAMETER(iError);
-    UNUSED_PARAMETER(pqiResultsSet);
 #endif // STUB_SLAVE
+    Pipe_EmptyQueue(&qiResultsSet);
     return MUX_S_OK;
 }
 
@@ -394,6 +394,7 @@ interface mux_IQuerySink : public mux_IUnknown
 {
 public:
     virtual MUX_RESULT Result(UINT32 iQueryHandle, UINT32 iError, QUEUE_INFO *pqiResultsSet) = 0;
+    virtual MUX_RESULT Rows(UINT32 iQueryHandle, QUEUE_INFO *pqiRows) = 0;
 };
 
 interface mux_IQueryControl : public mux_IUnknown
@@ -424,6 +425,7 @@ public:
     // mux_IQuerySink
     //
     virtual MUX_RESULT Result(UINT32 iQueryHandle, UINT32 iError, QUEUE_INFO *pqiResultsSet);
+    virtual MUX_RESULT Rows(UINT32 iQueryHandle, QUEUE_INFO *pqiRows);
 
     CQueryClient(void);
     MUX_RESULT FinalConstruct(void);
@@ -431,6 +433,18 @@ public:
 
 private:
     UINT32 m_cRef;
+
+    // Batches of rows which arrive ahead of the final Result() for a query
+    // are held here until that Result() arrives.
+    //
+    typedef struct pending_rows
+    {
+        struct pending_rows *pNext;
+        UINT32               iQueryHandle;
+        QUEUE_INFO           qiRows;
+    } PENDING_ROWS;
+
+    PENDING_ROWS *m_pPending;
 };
 
 class CQueryClientFactory : public mux_IClassFactory
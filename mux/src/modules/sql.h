@@ -49,6 +49,7 @@ public:
     // mux_IQuerySink
     //
     virtual MUX_RESULT Result(UINT32 iQueryHandle, UINT32 iError, QUEUE_INFO *pqiResultsSet);
+    virtual MUX_RESULT Rows(UINT32 iQueryHandle, QUEUE_INFO *pqiRows);
 
     CQuerySinkProxy(void);
     MUX_RESULT FinalConstruct(void);
@@ -13,8 +13,135 @@
 #if defined(HAVE_MYSQL_H)
 #include <mysql.h>
 #endif // HAVE_MYSQL_H
+#if defined(HAVE_SQLITE3_H)
+#include <sqlite3.h>
+#endif // HAVE_SQLITE3_H
+#if defined(HAVE_PTHREAD_H)
+#include <pthread.h>
+#endif // HAVE_PTHREAD_H
 #include "sql.h"
 
+#if defined(HAVE_MYSQL) && !defined(HAVE_MYSQL_H)
+#undef HAVE_MYSQL
+#endif
+#if defined(HAVE_SQLITE3) && !defined(HAVE_SQLITE3_H)
+#undef HAVE_SQLITE3
+#endif
+#if defined(HAVE_LIBPTHREAD) && defined(HAVE_PTHREAD_H) && defined(UNIX_FILES)
+#define QS_THREADS
+#endif
+
+// Number of database sessions (and worker threads) in the pool.  Queries are
+// run concurrently on up to this many sessions.
+//
+#if !defined(QS_SESSIONS)
+#define QS_SESSIONS 4
+#endif
+
+// Rows are shipped back to netmux in batches of about this many bytes while
+// the query is still producing them.
+//
+#define QS_BATCH_SIZE (2*QUEUE_BLOCK_SIZE)
+
+// When sql_server is set to this, sql_database names an SQLite database file
+// instead of a database on a MySQL server.
+//
+#define QS_SQLITE_SERVER "sqlite"
+
+class CQueryServer;
+
+typedef struct query_completion
+{
+    CQueryServer *pServer;
+    UINT32        iQueryHandle;
+    UINT32        iError;
+    bool          bFinal;
+    QUEUE_INFO    qi;
+} QUERY_COMPLETION;
+
+// CResultsWriter serializes a result set in the format CResultsSet expects:
+// the field count, each row as a sequence of length-prefixed fields, and
+// finally the row count.  Each row is built contiguously so that it costs a
+// single Pipe_AppendBytes, and full batches of rows are handed back to the
+// main thread while the query continues.
+//
+class CResultsWriter
+{
+public:
+    CResultsWriter(CQueryServer *pServer, UINT32 iQueryHandle);
+    ~CResultsWriter();
+
+    void SetFieldCount(int nFields);
+    bool AddField(const char *p);
+    void EndRow(void);
+    void Finish(UINT32 iError);
+
+private:
+    void Post(bool bFinal, UINT32 iError);
+
+    CQueryServer *m_pServer;
+    UINT32        m_iQueryHandle;
+    int           m_nFields;
+    size_t        m_nRows;
+    QUEUE_INFO    m_qiRows;
+    char         *m_pRow;
+    size_t        m_nRow;
+    size_t        m_nRowAllocated;
+};
+
+// CQuerySession is the backend interface.  Each backend implements a single
+// session with a database, and a session is only used by one thread at a
+// time.
+//
+class CQuerySession
+{
+public:
+    virtual ~CQuerySession() {}
+    virtual bool   Open(const UTF8 *pServer, const UTF8 *pDatabase, const UTF8 *pUser, const UTF8 *pPassword) = 0;
+    virtual UINT32 Execute(const UTF8 *pQuery, CResultsWriter *prw) = 0;
+};
+
+#if defined(HAVE_MYSQL)
+class CMySQLSession : public CQuerySession
+{
+public:
+    CMySQLSession(void);
+    virtual ~CMySQLSession();
+    virtual bool   Open(const UTF8 *pServer, const UTF8 *pDatabase, const UTF8 *pUser, const UTF8 *pPassword);
+    virtual UINT32 Execute(const UTF8 *pQuery, CResultsWriter *prw);
+
+private:
+    void ConnectionHelper(void);
+
+    MYSQL      *m_database;
+    const UTF8 *m_pServer;
+    const UTF8 *m_pDatabase;
+    const UTF8 *m_pUser;
+    const UTF8 *m_pPassword;
+};
+#endif // HAVE_MYSQL
+
+#if defined(HAVE_SQLITE3)
+class CSQLiteSession : public CQuerySession
+{
+public:
+    CSQLiteSession(void);
+    virtual ~CSQLiteSession();
+    virtual bool   Open(const UTF8 *pServer, const UTF8 *pDatabase, const UTF8 *pUser, const UTF8 *pPassword);
+    virtual UINT32 Execute(const UTF8 *pQuery, CResultsWriter *prw);
+
+private:
+    sqlite3 *m_database;
+};
+#endif // HAVE_SQLITE3
+
+typedef struct query_job
+{
+    struct query_job *pNext;
+    UINT32            iQueryHandle;
+    UTF8             *pQuery;
+} QUERY_JOB;
+
 class CQueryServer : public mux_IQueryControl, public mux_IMarshal
 {
 public:
@@ -42,18 +169,48 @@ public:
     MUX_RESULT FinalConstruct(void);
     virtual ~CQueryServer();
 
+    bool IsThreaded(void);
+    void Deliver(QUERY_COMPLETION *pqc);
+
+#if defined(QS_THREADS)
+    void WorkerProc(void);
+#endif // QS_THREADS
+
 private:
     UINT32          m_cRef;
     mux_IQuerySink *m_pIQuerySink;
-#if defined(HAVE_MYSQL)
-    MYSQL          *m_database;
-#endif // HAVE_MYSQL
     const UTF8     *m_pServer;
     const UTF8     *m_pDatabase;
     const UTF8     *m_pUser;
     const UTF8     *m_pPassword;
 
-    void ConnectionHelper();
+    // Sessions compare their generation against m_iGeneration to discover
+    // that Connect() has been called again with new parameters.
+    //
+    UINT32          m_iGeneration;
+
+    CQuerySession  *NewSession(void);
+    void            RunQuery(CQuerySession **ppSession, UINT32 *piGeneration, QUERY_JOB *pJob);
+
+    // Without threads, queries run to completion on the main thread against
+    // a single session.
+    //
+    CQuerySession  *m_pSession;
+    UINT32          m_iSessionGeneration;
+    bool            m_bThreaded;
+
+#if defined(QS_THREADS)
+    void            StartWorkers(void);
+    void            StopWorkers(void);
+
+    pthread_mutex_t m_mutex;
+    pthread_cond_t  m_cond;
+    pthread_t       m_aThreads[QS_SESSIONS];
+    int             m_nThreads;
+    bool            m_bShutdown;
+    QUERY_JOB      *m_pJobHead;
+    QUERY_JOB      *m_pJobTail;
+#endif // QS_THREADS
 };
 
 static INT32 g_cComponents  = 0;
@@ -153,17 +310,51 @@ extern "C" MUX_RESULT DCL_EXPORT DCL_API mux_Unregister(void)
     return mux_RevokeClassObjects(NUM_CLASSES, sum_classes);
 }
 
+static UTF8 *CopyString(const UTF8 *pString)
+{
+    UTF8 *p = NULL;
+    if (NULL != pString)
+    {
+        size_t n = strlen((const char *)pString) + 1;
+        try
+        {
+            p = new UTF8[n];
+        }
+        catch (...)
+        {
+            ; // Nothing.
+        }
+
+        if (NULL != p)
+        {
+            memcpy(p, pString, n);
+        }
+    }
+    return p;
+}
+
 // QueryServer component which is not directly accessible.
 //
 CQueryServer::CQueryServer(void) : m_cRef(1), m_pIQuerySink(NULL)
 {
-#if defined(HAVE_MYSQL)
-    m_database = NULL;
-#endif // HAVE_MYSQL
     m_pServer = NULL;
     m_pDatabase = NULL;
     m_pUser = NULL;
     m_pPassword = NULL;
+    m_iGeneration = 0;
+
+    m_pSession = NULL;
+    m_iSessionGeneration = 0;
+    m_bThreaded = false;
+
+#if defined(QS_THREADS)
+    pthread_mutex_init(&m_mutex, NULL);
+    pthread_cond_init(&m_cond, NULL);
+    m_nThreads = 0;
+    m_bShutdown = false;
+    m_pJobHead = NULL;
+    m_pJobTail = NULL;
+#endif // QS_THREADS
 
     g_cComponents++;
 }
@@ -171,23 +362,39 @@ CQueryServer::CQueryServer(void) : m_cRef(1), m_pIQuerySink(NULL)
 MUX_RESULT CQueryServer::FinalConstruct(void)
 {
     MUX_RESULT mr = MUX_S_OK;
+
+#if defined(QS_THREADS)
+    // The worker threads can only hand results back if the hosting process
+    // waits on the completion handle.
+    //
+    if (0 <= Pipe_GetCompletionHandle())
+    {
+        StartWorkers();
+    }
+#endif // QS_THREADS
     return mr;
 }
 
 CQueryServer::~CQueryServer()
 {
+#if defined(QS_THREADS)
+    StopWorkers();
+    pthread_cond_destroy(&m_cond);
+    pthread_mutex_destroy(&m_mutex);
+#endif // QS_THREADS
+
+    if (NULL != m_pSession)
+    {
+        delete m_pSession;
+        m_pSession = NULL;
+    }
+
     if (NULL != m_pIQuerySink)
     {
         m_pIQuerySink->Release();
         m_pIQuerySink = NULL;
     }
 
-#if defined(HAVE_MYSQL)
-    if (NULL != m_database)
-    {
-        mysql_close(m_database);
-        m_database = NULL;
-    }
     delete [] m_pServer;
     m_pServer = NULL;
     delete [] m_pDatabase;
@@ -196,7 +403,6 @@ CQueryServer::~CQueryServer()
     m_pUser = NULL;
     delete [] m_pPassword;
     m_pPassword = NULL;
-#endif // HAVE_MYSQL
 
     g_cComponents--;
 }
@@ -601,49 +807,538 @@ MUX_RESULT CQueryServer::DisconnectObject(void)
 
 MUX_RESULT CQueryServer::Connect(const UTF8 *pServer, const UTF8 *pDatabase, const UTF8 *pUser, const UTF8 *pPassword)
 {
+#if defined(QS_THREADS)
+    pthread_mutex_lock(&m_mutex);
+#endif // QS_THREADS
+
     // Free any previous Server/Database/User/Password values.
     //
     delete [] m_pServer;
-    m_pServer = NULL;
     delete [] m_pDatabase;
-    m_pDatabase = NULL;
     delete [] m_pUser;
-    m_pUser = NULL;
     delete [] m_pPassword;
-    m_pPassword = NULL;
 
-    // Save new Server/Database/User/Password values.  These are used later if reconnection is necessary.
+    // Save new Server/Database/User/Password values.  Each session picks
+    // these up the next time it runs a query, and they are used later if
+    // reconnection is necessary.
     //
-    m_pServer = pServer;
-    delete [] m_pDatabase;
+    m_pServer   = pServer;
     m_pDatabase = pDatabase;
-    delete [] m_pUser;
-    m_pUser = pUser;
-    delete [] m_pPassword;
+    m_pUser     = pUser;
     m_pPassword = pPassword;
 
+    m_iGeneration++;
+    if (0 == m_iGeneration)
+    {
+        m_iGeneration++;
+    }
+
+#if defined(QS_THREADS)
+    pthread_mutex_unlock(&m_mutex);
+#endif // QS_THREADS
+    return MUX_S_OK;
+}
+
+MUX_RESULT CQueryServer::Advise(mux_IQuerySink *pIQuerySink)
+{
+    if (NULL != m_pIQuerySink)
+    {
+        m_pIQuerySink->Release();
+        m_pIQuerySink = NULL;
+    }
+
+    if (NULL == pIQuerySink)
+    {
+        return MUX_E_INVALIDARG;
+    }
+
+    m_pIQuerySink = pIQuerySink;
+    return MUX_S_OK;
+}
+
+MUX_RESULT CQueryServer::Query(UINT32 iQueryHandle, const UTF8 *pDatabaseName, const UTF8 *pQuery)
+{
+    UNUSED_PARAMETER(pDatabaseName);
+
+    if (NULL == m_pIQuerySink)
+    {
+        return MUX_E_NOTREADY;
+    }
+
+    QUERY_JOB *pJob = NULL;
+    try
+    {
+        pJob = new QUERY_JOB;
+    }
+    catch (...)
+    {
+        ; // Nothing.
+    }
+
+    if (NULL == pJob)
+    {
+        return MUX_E_OUTOFMEMORY;
+    }
+
+    pJob->pNext = NULL;
+    pJob->iQueryHandle = iQueryHandle;
+    pJob->pQuery = CopyString(pQuery);
+    if (NULL == pJob->pQuery)
+    {
+        delete pJob;
+        return MUX_E_OUTOFMEMORY;
+    }
+
+    // Each outstanding query holds a reference which is released on the main
+    // thread when its final results are delivered.
+    //
+    AddRef();
+
+#if defined(QS_THREADS)
+    if (m_bThreaded)
+    {
+        pthread_mutex_lock(&m_mutex);
+        if (NULL == m_pJobTail)
+        {
+            m_pJobHead = pJob;
+        }
+        else
+        {
+            m_pJobTail->pNext = pJob;
+        }
+        m_pJobTail = pJob;
+        pthread_cond_signal(&m_cond);
+        pthread_mutex_unlock(&m_mutex);
+        return MUX_S_OK;
+    }
+#endif // QS_THREADS
+
+    RunQuery(&m_pSession, &m_iSessionGeneration, pJob);
+    delete [] pJob->pQuery;
+    delete pJob;
+    return MUX_S_OK;
+}
+
+bool CQueryServer::IsThreaded(void)
+{
+    return m_bThreaded;
+}
+
+CQuerySession *CQueryServer::NewSession(void)
+{
+    CQuerySession *pSession = NULL;
+    try
+    {
+        if (0 == strcmp((const char *)m_pServer, QS_SQLITE_SERVER))
+        {
+#if defined(HAVE_SQLITE3)
+            pSession = new CSQLiteSession;
+#endif // HAVE_SQLITE3
+        }
+        else
+        {
 #if defined(HAVE_MYSQL)
-    // Close any existing session.
+            pSession = new CMySQLSession;
+#endif // HAVE_MYSQL
+        }
+    }
+    catch (...)
+    {
+        ; // Nothing.
+    }
+    return pSession;
+}
+
+// Runs one query on the given session and delivers its results.  This is
+// called on a worker thread or, without threads, on the main thread.
+//
+void CQueryServer::RunQuery(CQuerySession **ppSession, UINT32 *piGeneration, QUERY_JOB *pJob)
+{
+    CResultsWriter rw(this, pJob->iQueryHandle);
+
+    // If Connect() has been called since this session was opened, re-open it
+    // with the new parameters.
     //
+#if defined(QS_THREADS)
+    pthread_mutex_lock(&m_mutex);
+#endif // QS_THREADS
+    if (*piGeneration != m_iGeneration)
+    {
+        if (NULL != *ppSession)
+        {
+            delete *ppSession;
+            *ppSession = NULL;
+        }
+
+        *piGeneration = m_iGeneration;
+        if (  NULL != m_pServer
+           && NULL != m_pDatabase
+           && NULL != m_pUser
+           && NULL != m_pPassword)
+        {
+            *ppSession = NewSession();
+            if (  NULL != *ppSession
+               && !(*ppSession)->Open(m_pServer, m_pDatabase, m_pUser, m_pPassword))
+            {
+                delete *ppSession;
+                *ppSession = NULL;
+            }
+        }
+    }
+#if defined(QS_THREADS)
+    pthread_mutex_unlock(&m_mutex);
+#endif // QS_THREADS
+
+    UINT32 iError;
+    if (NULL == *ppSession)
+    {
+        iError = QS_NO_SESSION;
+    }
+    else
+    {
+        iError = (*ppSession)->Execute(pJob->pQuery, &rw);
+    }
+    rw.Finish(iError);
+}
+
+// Called on the main thread with each batch of rows and with the final
+// results of a query.
+//
+void CQueryServer::Deliver(QUERY_COMPLETION *pqc)
+{
+    if (NULL != m_pIQuerySink)
+    {
+        if (pqc->bFinal)
+        {
+            m_pIQuerySink->Result(pqc->iQueryHandle, pqc->iError, &pqc->qi);
+        }
+        else
+        {
+            m_pIQuerySink->Rows(pqc->iQueryHandle, &pqc->qi);
+        }
+    }
+
+    bool bFinal = pqc->bFinal;
+    Pipe_EmptyQueue(&pqc->qi);
+    delete pqc;
+
+    if (bFinal)
+    {
+        Release();
+    }
+}
+
+static void QueryCompletion(void *pContext)
+{
+    QUERY_COMPLETION *pqc = static_cast<QUERY_COMPLETION *>(pContext);
+    pqc->pServer->Deliver(pqc);
+}
+
+#if defined(QS_THREADS)
+static void *QueryWorker(void *pContext)
+{
+    CQueryServer *pServer = static_cast<CQueryServer *>(pContext);
+    pServer->WorkerProc();
+    return NULL;
+}
+
+void CQueryServer::StartWorkers(void)
+{
+    // Signals belong to the main thread.
+    //
+    sigset_t all, old;
+    sigfillset(&all);
+    pthread_sigmask(SIG_SETMASK, &all, &old);
+
+    for (m_nThreads = 0; m_nThreads < QS_SESSIONS; m_nThreads++)
+    {
+        if (0 != pthread_create(&m_aThreads[m_nThreads], NULL, QueryWorker, this))
+        {
+            break;
+        }
+    }
+
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+    m_bThreaded = (0 < m_nThreads);
+}
+
+void CQueryServer::StopWorkers(void)
+{
+    pthread_mutex_lock(&m_mutex);
+    m_bShutdown = true;
+    pthread_cond_broadcast(&m_cond);
+    pthread_mutex_unlock(&m_mutex);
+
+    for (int i = 0; i < m_nThreads; i++)
+    {
+        pthread_join(m_aThreads[i], NULL);
+    }
+    m_nThreads = 0;
+
+    // Every queued query holds a reference, so nothing should be left.
+    //
+    while (NULL != m_pJobHead)
+    {
+        QUERY_JOB *pJob = m_pJobHead;
+        m_pJobHead = pJob->pNext;
+        delete [] pJob->pQuery;
+        delete pJob;
+    }
+    m_pJobTail = NULL;
+}
+
+void CQueryServer::WorkerProc(void)
+{
+#if defined(HAVE_MYSQL)
+    mysql_thread_init();
+#endif // HAVE_MYSQL
+
+    CQuerySession *pSession = NULL;
+    UINT32 iGeneration = 0;
+
+    pthread_mutex_lock(&m_mutex);
+    for (;;)
+    {
+        while (  !m_bShutdown
+              && NULL == m_pJobHead)
+        {
+            pthread_cond_wait(&m_cond, &m_mutex);
+        }
+
+        if (m_bShutdown)
+        {
+            break;
+        }
+
+        QUERY_JOB *pJob = m_pJobHead;
+        m_pJobHead = pJob->pNext;
+        if (NULL == m_pJobHead)
+        {
+            m_pJobTail = NULL;
+        }
+        pthread_mutex_unlock(&m_mutex);
+
+        RunQuery(&pSession, &iGeneration, pJob);
+        delete [] pJob->pQuery;
+        delete pJob;
+
+        pthread_mutex_lock(&m_mutex);
+    }
+    pthread_mutex_unlock(&m_mutex);
+
+    if (NULL != pSession)
+    {
+        delete pSession;
+    }
+
+#if defined(HAVE_MYSQL)
+    mysql_thread_end();
+#endif // HAVE_MYSQL
+}
+#endif // QS_THREADS
+
+CResultsWriter::CResultsWriter(CQueryServer *pServer, UINT32 iQueryHandle) :
+    m_pServer(pServer), m_iQueryHandle(iQueryHandle), m_nFields(0),
+    m_nRows(0), m_pRow(NULL), m_nRow(0), m_nRowAllocated(0)
+{
+    Pipe_InitializeQueueInfo(&m_qiRows);
+}
+
+CResultsWriter::~CResultsWriter()
+{
+    Pipe_EmptyQueue(&m_qiRows);
+    delete [] m_pRow;
+    m_pRow = NULL;
+}
+
+void CResultsWriter::SetFieldCount(int nFields)
+{
+    m_nFields = nFields;
+}
+
+// AddField: Append one field to the current row.  If the row cannot grow,
+// it is discarded and false is returned, and the caller should fail the
+// query rather than end a short row.
+//
+bool CResultsWriter::AddField(const char *p)
+{
+    if (NULL == p)
+    {
+        p = "";
+    }
+    size_t n = strlen(p) + 1;
+
+    size_t nNeeded = m_nRow + sizeof(n) + n;
+    if (m_nRowAllocated < nNeeded)
+    {
+        size_t nAllocate = 2*m_nRowAllocated;
+        if (nAllocate < nNeeded)
+        {
+            nAllocate = nNeeded;
+        }
+
+        char *pRow = NULL;
+        try
+        {
+            pRow = new char[nAllocate];
+        }
+        catch (...)
+        {
+            ; // Nothing.
+        }
+
+        if (NULL == pRow)
+        {
+            m_nRow = 0;
+            return false;
+        }
+
+        if (0 < m_nRow)
+        {
+            memcpy(pRow, m_pRow, m_nRow);
+        }
+        delete [] m_pRow;
+        m_pRow = pRow;
+        m_nRowAllocated = nAllocate;
+    }
+
+    memcpy(m_pRow + m_nRow, &n, sizeof(n));
+    m_nRow += sizeof(n);
+    memcpy(m_pRow + m_nRow, p, n);
+    m_nRow += n;
+    return true;
+}
+
+void CResultsWriter::EndRow(void)
+{
+    Pipe_AppendBytes(&m_qiRows, m_nRow, m_pRow);
+    m_nRow = 0;
+    m_nRows++;
+
+    if (QS_BATCH_SIZE <= Pipe_QueueLength(&m_qiRows))
+    {
+        Post(false, QS_SUCCESS);
+    }
+}
+
+void CResultsWriter::Finish(UINT32 iError)
+{
+    Post(true, iError);
+}
+
+void CResultsWriter::Post(bool bFinal, UINT32 iError)
+{
+    QUERY_COMPLETION *pqc = NULL;
+    try
+    {
+        pqc = new QUERY_COMPLETION;
+    }
+    catch (...)
+    {
+        ; // Nothing.
+    }
+
+    if (NULL == pqc)
+    {
+        return;
+    }
+
+    pqc->pServer      = m_pServer;
+    pqc->iQueryHandle = m_iQueryHandle;
+    pqc->iError       = iError;
+    pqc->bFinal       = bFinal;
+
+    if (!bFinal)
+    {
+        // Hand over the blocks of the batch as they are.
+        //
+        pqc->qi = m_qiRows;
+        Pipe_InitializeQueueInfo(&m_qiRows);
+    }
+    else
+    {
+        Pipe_InitializeQueueInfo(&pqc->qi);
+        if (QS_SUCCESS == iError)
+        {
+            Pipe_AppendBytes(&pqc->qi, sizeof(m_nFields), &m_nFields);
+            Pipe_AppendQueue(&pqc->qi, &m_qiRows);
+            Pipe_AppendBytes(&pqc->qi, sizeof(m_nRows), &m_nRows);
+        }
+        else
+        {
+            Pipe_EmptyQueue(&m_qiRows);
+        }
+    }
+
+    if (m_pServer->IsThreaded())
+    {
+        if (MUX_FAILED(Pipe_PostCompletion(QueryCompletion, pqc)))
+        {
+            Pipe_EmptyQueue(&pqc->qi);
+            delete pqc;
+        }
+    }
+    else
+    {
+        m_pServer->Deliver(pqc);
+    }
+}
+
+#if defined(HAVE_MYSQL)
+CMySQLSession::CMySQLSession(void) : m_database(NULL)
+{
+    m_pServer = NULL;
+    m_pDatabase = NULL;
+    m_pUser = NULL;
+    m_pPassword = NULL;
+}
+
+CMySQLSession::~CMySQLSession()
+{
     if (NULL != m_database)
     {
         mysql_close(m_database);
         m_database = NULL;
     }
+    delete [] m_pServer;
+    m_pServer = NULL;
+    delete [] m_pDatabase;
+    m_pDatabase = NULL;
+    delete [] m_pUser;
+    m_pUser = NULL;
+    delete [] m_pPassword;
+    m_pPassword = NULL;
+}
 
-    m_database = mysql_init(NULL);
+bool CMySQLSession::Open(const UTF8 *pServer, const UTF8 *pDatabase, const UTF8 *pUser, const UTF8 *pPassword)
+{
+    // Save our own copies of Server/Database/User/Password.  These are used
+    // later if reconnection is necessary.
+    //
+    m_pServer   = CopyString(pServer);
+    m_pDatabase = CopyString(pDatabase);
+    m_pUser     = CopyString(pUser);
+    m_pPassword = CopyString(pPassword);
+    if (  NULL == m_pServer
+       || NULL == m_pDatabase
+       || NULL == m_pUser
+       || NULL == m_pPassword)
+    {
+        return false;
+    }
 
-    if (NULL != m_database)
+    m_database = mysql_init(NULL);
+    if (NULL == m_database)
     {
-        ConnectionHelper();
+        return false;
     }
-#endif // HAVE_MYSQL
-    return MUX_S_OK;
+
+    ConnectionHelper();
+    return true;
 }
 
-void CQueryServer::ConnectionHelper()
+void CMySQLSession::ConnectionHelper(void)
 {
-#if defined(HAVE_MYSQL)
     if ('\0' != m_pServer[0])
     {
 #ifdef MYSQL_OPT_RECONNECT
@@ -665,128 +1360,175 @@ void CQueryServer::ConnectionHelper()
 #endif
         }
     }
-#endif
 }
 
-MUX_RESULT CQueryServer::Advise(mux_IQuerySink *pIQuerySink)
+UINT32 CMySQLSession::Execute(const UTF8 *pQuery, CResultsWriter *prw)
 {
-    if (NULL != m_pIQuerySink)
+    unsigned long lThreadId_before = mysql_thread_id(m_database);
+    if (mysql_ping(m_database) != 0)
     {
-        m_pIQuerySink->Release();
-        m_pIQuerySink = NULL;
+        // Attempt our own reconnection.
+        //
+        ConnectionHelper();
+        if (mysql_ping(m_database) != 0)
+        {
+            return QS_SQL_UNAVAILABLE;
+        }
     }
-
-    if (NULL == pIQuerySink)
+    else
     {
-        return MUX_E_INVALIDARG;
+        unsigned long lThreadId_after = mysql_thread_id(m_database);
+        if (lThreadId_before != lThreadId_after)
+        {
+            // Respond to detected reconnection.
+            //
+        }
     }
 
-    m_pIQuerySink = pIQuerySink;
-    return MUX_S_OK;
-}
-
-MUX_RESULT CQueryServer::Query(UINT32 iQueryHandle, const UTF8 *pDatabaseName, const UTF8 *pQuery)
-{
-    UNUSED_PARAMETER(pDatabaseName);
-
-    if (NULL == m_pIQuerySink)
+    if (mysql_real_query(m_database, (char *)pQuery, strlen((char *)pQuery)) != 0)
     {
-        return MUX_E_NOTREADY;
+        return QS_QUERY_ERROR;
     }
 
-    UINT32 iError = QS_SUCCESS;
-
-    QUEUE_INFO qiResultsSet;
-    Pipe_InitializeQueueInfo(&qiResultsSet);
-
-#if defined(HAVE_MYSQL)
-    if (NULL == m_database)
+    // Stream the rows from the server rather than storing the entire result
+    // set on this side first.
+    //
+    MYSQL_RES *result = mysql_use_result(m_database);
+    if (NULL == result)
     {
-        iError = QS_NO_SESSION;
+        return QS_SUCCESS;
     }
-    else
+
+    int nFields = mysql_num_fields(result);
+    prw->SetFieldCount(nFields);
+
+    UINT32 iError = QS_SUCCESS;
+    MYSQL_ROW row;
+    while (  QS_SUCCESS == iError
+          && NULL != (row = mysql_fetch_row(result)))
     {
-        unsigned long lThreadId_before = mysql_thread_id(m_database);
-        if (mysql_ping(m_database) != 0)
+        for (int i = 0; i < nFields; i++)
         {
-            // Attempt our own reconnection.
-            //
-            ConnectionHelper();
-            if (mysql_ping(m_database) != 0)
+            if (!prw->AddField(row[i]))
             {
-                iError = QS_SQL_UNAVAILABLE;
+                iError = QS_QUERY_ERROR;
+                break;
             }
         }
-        else
+
+        if (QS_SUCCESS == iError)
         {
-            unsigned long lThreadId_after = mysql_thread_id(m_database);
-            if (lThreadId_before != lThreadId_after)
-            {
-                // Respond to detected reconnection.
-                //
-            }
+            prw->EndRow();
         }
     }
 
-    if (  QS_SUCCESS == iError
-       && mysql_real_query(m_database, (char *)pQuery, strlen((char *)pQuery)) != 0)
+    if (0 != mysql_errno(m_database))
     {
         iError = QS_QUERY_ERROR;
     }
+    mysql_free_result(result);
+    return iError;
+}
+#endif // HAVE_MYSQL
 
-    MYSQL_RES *result = NULL;
-    MYSQL_ROW  row;
+#if defined(HAVE_SQLITE3)
+CSQLiteSession::CSQLiteSession(void) : m_database(NULL)
+{
+}
 
-    int nFields = 0;
-    if (iError == QS_SUCCESS)
+CSQLiteSession::~CSQLiteSession()
+{
+    if (NULL != m_database)
     {
-        size_t nRows = 0;
-        result = mysql_store_result(m_database);
-        if (NULL == result)
+        sqlite3_close(m_database);
+        m_database = NULL;
+    }
+}
+
+bool CSQLiteSession::Open(const UTF8 *pServer, const UTF8 *pDatabase, const UTF8 *pUser, const UTF8 *pPassword)
+{
+    UNUSED_PARAMETER(pServer);
+    UNUSED_PARAMETER(pUser);
+    UNUSED_PARAMETER(pPassword);
+
+    // The database is a file, and each session has its own connection to it.
+    //
+    if (SQLITE_OK != sqlite3_open_v2((const char *)pDatabase, &m_database,
+         SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_NOMUTEX, NULL))
+    {
+        if (NULL != m_database)
         {
-            Pipe_AppendBytes(&qiResultsSet, sizeof(nFields), &nFields);
-            Pipe_AppendBytes(&qiResultsSet, sizeof(nRows), &nRows);
+            sqlite3_close(m_database);
+            m_database = NULL;
         }
-        else
-        {
-            nFields = mysql_num_fields(result);
-            Pipe_AppendBytes(&qiResultsSet, sizeof(nFields), &nFields);
+        return false;
+    }
 
-            row = mysql_fetch_row(result);
-            while (row)
-            {
-                nRows++;
+    // Sessions in the pool contend for the same file, so wait on a locked
+    // database instead of failing immediately.
+    //
+    sqlite3_busy_timeout(m_database, 5000);
+    return true;
+}
 
-                int loop;
-                for (loop = 0; loop < nFields; loop++)
-                {
-                    const char *p;
-                    if (NULL != row[loop])
-                    {
-                        p = row[loop];
-                    }
-                    else
-                    {
-                        p = "";
-                    }
-                    size_t n = strlen(p)+1;
-                    Pipe_AppendBytes(&qiResultsSet, sizeof(n), &n);
-                    Pipe_AppendBytes(&qiResultsSet, n, p);
-                }
-                row = mysql_fetch_row(result);
+UINT32 CSQLiteSession::Execute(const UTF8 *pQuery, CResultsWriter *prw)
+{
+    sqlite3_stmt *pStmt = NULL;
+    const char *pTail = NULL;
+    if (SQLITE_OK != sqlite3_prepare_v2(m_database, (const char *)pQuery, -1, &pStmt, &pTail))
+    {
+        return QS_QUERY_ERROR;
+    }
+    else if (NULL == pStmt)
+    {
+        // The query was empty.
+        //
+        return QS_SUCCESS;
+    }
+
+    // As with MySQL, only one statement per query is accepted.
+    //
+    while (  ' '  == *pTail
+          || '\t' == *pTail
+          || '\r' == *pTail
+          || '\n' == *pTail
+          || ';'  == *pTail)
+    {
+        pTail++;
+    }
+
+    if ('\0' != *pTail)
+    {
+        sqlite3_finalize(pStmt);
+        return QS_QUERY_ERROR;
+    }
+
+    int nFields = sqlite3_column_count(pStmt);
+    prw->SetFieldCount(nFields);
+
+    int rc;
+    while (SQLITE_ROW == (rc = sqlite3_step(pStmt)))
+    {
+        int i;
+        for (i = 0; i < nFields; i++)
+        {
+            if (!prw->AddField((const char *)sqlite3_column_text(pStmt, i)))
+            {
+                break;
             }
-            mysql_free_result(result);
-            Pipe_AppendBytes(&qiResultsSet, sizeof(nRows), &nRows);
         }
+
+        if (i < nFields)
+        {
+            break;
+        }
+        prw->EndRow();
     }
-#else // HAVE_MYSQL
-    iError = QS_NO_SESSION;
-#endif // HAVE_MYSQL
+    sqlite3_finalize(pStmt);
 
-    MUX_RESULT mr = m_pIQuerySink->Result(iQueryHandle, iError, &qiResultsSet);
-    Pipe_EmptyQueue(&qiResultsSet);
-    return mr;
+    return (SQLITE_DONE == rc) ? QS_SUCCESS : QS_QUERY_ERROR;
 }
+#endif // HAVE_SQLITE3
 
 // Factory for CQueryServer component which is not directly accessible.
 //
@@ -1053,6 +1795,31 @@ MUX_RESULT CQuerySinkProxy::Result(UINT32 iQueryHandle, UINT32 iError, QUEUE_INF
     return mr;
 }
 
+MUX_RESULT CQuerySinkProxy::Rows(UINT32 iQueryHandle, QUEUE_INFO *pqiRows)
+{
+    // Communicate with the remote component to service this request.
+    //
+    QUEUE_INFO qiFrame;
+    Pipe_InitializeQueueInfo(&qiFrame);
+
+    UINT32 iMethod = 4;
+    Pipe_AppendBytes(&qiFrame, sizeof(iMethod), &iMethod);
+
+    struct FRAME
+    {
+        UINT32 iQueryHandle;
+    } CallFrame;
+
+    CallFrame.iQueryHandle = iQueryHandle;
+
+    Pipe_AppendBytes(&qiFrame, sizeof(CallFrame), &CallFrame);
+    Pipe_AppendQueue(&qiFrame, pqiRows);
+
+    MUX_RESULT mr = Pipe_SendMsgPacket(m_nChannel, &qiFrame);
+    Pipe_EmptyQueue(&qiFrame);
+    return mr;
+}
+
 // Factory for QuerySinkProxy component which is not directly accessible.
 //
 CQuerySinkProxyFactory::CQuerySinkProxyFactory(void) : m_cRef(1)
@@ -525,7 +525,7 @@ void move_exit(dbref player, dbref exit, bool divest, const UTF8 *failmsg, int h
     bool bDoit = false;
 
     dbref loc = Location(exit);
-    if (atr_get_raw(exit, A_EXITVARDEST) != NULL)
+    if (atr_exists(exit, A_EXITVARDEST))
     {
         loc = get_exit_dest(player, exit);
     }
@@ -41,6 +41,7 @@ struct confdata
     bool    compress_db;        // should we use compress.
     bool    dark_sleepers;      /* Are sleeping players 'dark'? */
     bool    destroy_going_now;  // Does GOING act like DESTROY_OK?
+    bool    eval_arena;         // Take command temporaries from an arena?
     bool    eval_comtitle;      /* Should Comtitles Evaluate? */
     bool    ex_flags;           /* true = show flags on examine */
     bool    exam_public;        /* Does EXAM show public attrs by default? */
@@ -55,6 +56,7 @@ struct confdata
     bool    match_mine_pl;      /* Should players check selves for $-cmds? */
     bool    name_spaces;        // allow player names to have spaces.
     bool    paranoid_alloc;     /* Rigorous buffer integrity checks */
+    bool    profile_softcode;   // Time functions and attributes?
     bool    pemit_any;          /* Can you @pemit to ANY remote object? */
     bool    pemit_players;      /* Can you @pemit to faraway players? */
     bool    player_listen;      /* Are AxHEAR triggered on players? */
@@ -99,6 +101,7 @@ struct confdata
     int     cache_pages;        // Size of hash page cache (in pages).
     int     check_interval;     /* interval between db check/cleans in secs */
     int     check_offset;       /* when to perform first check and clean */
+    int     check_slice;        // Objects examined per step of a periodic check.
     int     cmd_quota_incr;     /* Bump #cmds allowed by this each timeslice */
     int     cmd_quota_max;      /* Max commands at one time */
     int     conn_timeout;       /* Allow this long to connect before booting */
@@ -114,6 +117,7 @@ struct confdata
     int     func_nest_lim;      /* Max nesting of functions */
     int     idle_interval;      /* when to check for idle users */
     int     idle_timeout;       /* Boot off players idle this long in secs */
+    int     io_threads;         // Threads doing socket I/O, or 0 for none.
     int     init_size;          // initial db size.
     int     killguarantee;      /* cost of kill cmd that guarantees success */
     int     killmax;            /* max cost of kill command */
@@ -126,9 +130,11 @@ struct confdata
     int     mail_expiration;    /* Number of days to wait to delete mail */
     int     mail_per_hour;      // Maximum sent @mail per hour per object.
     int     max_players;        /* Max # of connected players */
+    int     metrics_port;       // Loopback port for the metrics page, or 0.
     int     min_guests;         // The # we should start nuking at.
     int     nStackLimit;        // Current stack limit.
     int     attr_name_charset;  // Charset restrictions for attribute names.
+    int     attr_compress_size; // Compress attribute values at least this long.
     int     exit_name_charset;  // Charset restrictions for exit names.
     int     player_name_charset; // Charset restrictions for player names.
     int     room_name_charset;  // Charset restrictions for room names.
@@ -173,6 +179,7 @@ struct confdata
     int     sacadjust;          /* sacrifice earns (obj_cost/sfactor) + sadj */
     int     sacfactor;          /* ... */
     int     searchcost;         /* cost of commands that search the whole DB */
+    int     search_threads;     // Threads used to scan the db for @search.
     int     sig_action;         // What to do with fatal signals.
     int     stack_limit;        /* How big can stacks get? */
     int     start_quota;        /* Quota for new players */
@@ -188,6 +195,7 @@ struct confdata
     int     lbuf_size;          // LBUF_SIZE accessible to softcode.
 
     unsigned int    max_cache_size; /* Max size of attribute cache */
+    unsigned int    max_cmd_cache_size; // Max size of compiled $-command cache
     unsigned int    site_chars; // where to truncate site name.
 
     IntArray    ports;          // user ports.
@@ -243,6 +251,7 @@ struct confdata
     UTF8    *crea_file;         /* display this on login for new users */
     UTF8    *creg_file;         /* display on connect if registration */
     UTF8    *down_file;         /* display this file if no logins */
+    UTF8    *flight_file;       /* write flight recorder here on signals */
     UTF8    *full_file;         /* display when max users exceeded */
     UTF8    *game_dir;          /* use this game CHashFile DIR file if we need one */
     UTF8    *game_pag;          /* use this game CHashFile PAG file if we need one */
@@ -252,6 +261,7 @@ struct confdata
     UTF8    *mail_db;           /* name of the @mail database */
     UTF8    *motd_file;         /* display this file on login */
     UTF8    *outdb;             /* checkpoint the database to here */
+    UTF8    *profile_file;      // Collapsed stacks from @list profile=write
     UTF8    *quit_file;         /* display on quit */
     UTF8    *regf_file;         /* display on (failed) create if reg is on */
     UTF8    *site_file;         /* display if conn from bad site */
@@ -486,12 +496,16 @@ struct statedata
     size_t  mod_alist_len;      /* Length of mod_alist */
     size_t  mod_size;           /* Length of modified buffer */
     unsigned int restart_count; // Number of @restarts since initial startup
+    unsigned int dump_count;    // Number of checkpoint dumps finished.
+    UINT64  commands_total;     // Commands received from connections.
+    UINT64  output_bytes;       // Bytes queued for connections.
 
     UTF8    short_ver[64];      /* Short version number (for INFO) */
     UTF8    doing_hdr[SIZEOF_DOING_STRING];  /* Doing column header in the WHO display */
     UTF8    version[128];       /* MUX version string */
     const UTF8    *curr_cmd;    /* The current command */
     const UTF8    *debug_cmd;   // The command we are executing (if any).
+    const UTF8    *latency_cmd; // Built-in command being timed (if any).
     unsigned char *mod_alist;   /* Attribute list for modifying */
     UTF8    *pout;              /* The output of the pipe used in %| */
     UTF8    *poutbufc;          /* Buffer position for poutnew */
@@ -516,13 +530,18 @@ struct statedata
     CLinearTimeAbsolute check_counter;  /* Countdown to next db check */
     CLinearTimeAbsolute cpu_count_from; /* When did we last reset CPU counters? */
     CLinearTimeAbsolute dump_counter;   /* Countdown to next db dump */
+    CLinearTimeAbsolute dump_started;   // When the last checkpoint dump began.
+    CLinearTimeDelta dump_stall;        // How long that dump held the main loop.
+    CLinearTimeDelta dump_duration;     // How long that dump took to finish.
     CLinearTimeAbsolute events_counter; /* Countdown to next events check */
     CLinearTimeAbsolute idle_counter;   /* Countdown to next idle check */
     CLinearTimeAbsolute start_time;     /* When was MUX started */
     CLinearTimeAbsolute restart_time;   /* When was MUX restarted */
     CLinearTimeAbsolute tThrottleExpired; // How much time is left in this hour of throttling.
 
-#if !defined(MEMORY_BASED)
+#if defined(MEMORY_BASED)
+    CHashTable atr_value_htab;  // Interned attribute values
+#else // MEMORY_BASED
     CHashTable acache_htab;     // Attribute Cache
 #endif // MEMORY_BASED
     CHashTable attr_name_htab;  /* Attribute names hashtable */
@@ -546,6 +565,8 @@ struct statedata
     CBitField bfNoCommands;     // Cache knowledge that there are no $-Commands.
     CBitField bfCommands;       // Cache knowledge that there are $-Commands.
     CBitField bfListens;        // Cache knowledge that there are ^-Commands.
+    CBitField bfDbckDirty;      // Objects changed since the periodic @dbck saw them.
+    CBitField bfDbckHold;       // GOING objects the periodic @dbck must not purge yet.
 
     CBitField bfReport;         // Used for LROOMS.
     CBitField bfTraverse;       // Used for LROOMS.
@@ -421,6 +421,22 @@ void queue_write_LEN(DESC *d, const char *b, size_t n)
         return;
     }
 
+#if defined(UNIX_NETWORKING_THREADS)
+    // An I/O thread only queues telnet replies, and it already holds the
+    // lock.  It must not log or call process_output(), so the output limit
+    // is left to the main thread.
+    //
+    if (on_io_thread())
+    {
+        add_to_output_queue(d, b, n);
+        d->output_size += n;
+        d->output_tot += n;
+        return;
+    }
+    bool bLocked = lock_descriptor(d);
+#endif // UNIX_NETWORKING_THREADS
+    mudstate.output_bytes += n;
+
     // If the output queue has grown enough that it needs to be chopped, spend
     // some time attempting to push at least some of it out. It may be that
     // writes are already flowing out to the network, but we check anyway.
@@ -519,6 +535,13 @@ void queue_write_LEN(DESC *d, const char *b, size_t n)
         d->bCallProcessOutputLater = true;
     }
 #endif // WINDOWS_NETWORKING
+
+#if defined(UNIX_NETWORKING_THREADS)
+    if (bLocked)
+    {
+        unlock_descriptor(d);
+    }
+#endif // UNIX_NETWORKING_THREADS
 }
 
 void queue_write(DESC *d, const char *b)
@@ -687,16 +710,15 @@ void freeqs(DESC *d)
     d->raw_input = NULL;
 
     d->raw_input_at = NULL;
-    d->nOption = 0;
-    d->raw_input_state    = NVT_IS_NORMAL;
-    for (int i = 0; i < 256; i++)
-    {
-        d->nvt_him_state[i] = OPTION_NO;
-    }
-    for (int i = 0; i < 256; i++)
+
+    if (d->aOption)
     {
-        d->nvt_us_state[i] = OPTION_NO;
+        free_sbuf(d->aOption);
     }
+    d->aOption = NULL;
+    d->nOption = 0;
+    d->raw_input_state    = NVT_IS_NORMAL;
+    InitOptionState(d);
     if (d->ttype)
     {
         MEMFREE(d->ttype);
@@ -811,7 +833,7 @@ static void set_userstring(UTF8 **userstring, const UTF8 *command)
     {
         if (*userstring == NULL)
         {
-            *userstring = alloc_lbuf("set_userstring");
+            *userstring = alloc_lbuf_keep("set_userstring");
         }
         mux_strncpy(*userstring, command, LBUF_SIZE-1);
     }
@@ -990,14 +1012,7 @@ static void announce_connect(dbref player, DESC *d)
     {
         DESC_ITER_PLAYER(player, dtemp)
         {
-            if (CHARSET_UTF8 != dtemp->encoding)
-            {
-                // Since we are changing to the UTF-8 character set, the
-                // printable state machine needs to be initialized.
-                //
-                dtemp->encoding = CHARSET_UTF8;
-                dtemp->raw_codepoint_state = CL_PRINT_START_STATE;
-            }
+            SetDescriptorEncoding(dtemp, CHARSET_UTF8);
         }
     }
 
@@ -1005,7 +1020,7 @@ static void announce_connect(dbref player, DESC *d)
     {
         DESC_ITER_PLAYER(player, dtemp)
         {
-            dtemp->encoding = CHARSET_ASCII;
+            SetDescriptorEncoding(dtemp, CHARSET_ASCII);
         }
     }
 
@@ -1015,7 +1030,7 @@ static void announce_connect(dbref player, DESC *d)
     s_Flags(player, FLAG_WORD2, Flags2(player) & ~VACATION);
     if (Guest(player))
     {
-        db[player].fs.word[FLAG_WORD1] &= ~DARK;
+        s_Flags(player, FLAG_WORD1, Flags(player) & ~DARK);
     }
 
     const UTF8 *pRoomAnnounceFmt;
@@ -1333,12 +1348,12 @@ void announce_disconnect(dbref player, DESC *d, const UTF8 *reason)
         if (d->flags & DS_AUTODARK)
         {
             d->flags &= ~DS_AUTODARK;
-            db[player].fs.word[FLAG_WORD1] &= ~DARK;
+            s_Flags(player, FLAG_WORD1, Flags(player) & ~DARK);
         }
 
         if (Guest(player))
         {
-            db[player].fs.word[FLAG_WORD1] |= DARK;
+            s_Flags(player, FLAG_WORD1, Flags(player) | DARK);
             halt_que(NOTHING, player);
         }
     }
@@ -1644,7 +1659,7 @@ void check_idle(void)
                     }
                     if (!bFound)
                     {
-                        db[d->player].fs.word[FLAG_WORD1] |= DARK;
+                        s_Flags(d->player, FLAG_WORD1, Flags(d->player) | DARK);
                         DESC_ITER_PLAYER(d->player, d1)
                         {
                             d1->flags |= DS_AUTODARK;
@@ -2334,7 +2349,16 @@ static bool check_connect(DESC *d, UTF8 *msg)
 
     // Hide the password length from SESSION.
     //
+#if defined(UNIX_NETWORKING_THREADS)
+    bool bLocked = lock_descriptor(d);
     d->input_tot -= (strlen((char *)msg) + 1);
+    if (bLocked)
+    {
+        unlock_descriptor(d);
+    }
+#else // UNIX_NETWORKING_THREADS
+    d->input_tot -= (strlen((char *)msg) + 1);
+#endif // UNIX_NETWORKING_THREADS
 
     // Crack the command apart.
     //
@@ -2447,7 +2471,7 @@ static bool check_connect(DESC *d, UTF8 *msg)
                && (  RealWizard(player)
                   || God(player)))
             {
-                db[player].fs.word[FLAG_WORD1] |= DARK;
+                s_Flags(player, FLAG_WORD1, Flags(player) | DARK);
             }
 
             // Make sure we don't have a guest from an unwanted host.
@@ -2748,6 +2772,7 @@ void do_command(DESC *d, UTF8 *command)
         // Normal logged-in command processing.
         //
         d->command_count++;
+        mudstate.commands_total++;
         if (d->output_prefix)
         {
             queue_string(d, d->output_prefix);
@@ -2773,6 +2798,8 @@ void do_command(DESC *d, UTF8 *command)
         }
 #endif // STUB_SLAVE
 
+        mudstate.latency_cmd = NULL;
+        UINT64 nOutputBegin = mudstate.output_bytes;
         CLinearTimeAbsolute ltaBegin;
         ltaBegin.GetUTC();
         MuxAlarm.Set(mudconf.max_cmdsecs);
@@ -2791,6 +2818,8 @@ void do_command(DESC *d, UTF8 *command)
         MuxAlarm.Clear();
 
         CLinearTimeDelta ltd = ltaEnd - ltaBegin;
+        latency_record_command(d->player, d->player, ltd,
+            mudstate.output_bytes - nOutputBegin);
         if (ltd > mudconf.rpt_cmdsecs)
         {
             STARTLOG(LOG_PROBLEMS, "CMD", "CPU");
@@ -2847,6 +2876,7 @@ void do_command(DESC *d, UTF8 *command)
     // handler.
     //
     d->command_count++;
+    mudstate.commands_total++;
     if (!(cp->flag & CMD_NOxFIX))
     {
         if (d->output_prefix)
@@ -2952,9 +2982,22 @@ void Task_ProcessCommand(void *arg_voidptr, int arg_iInteger)
                 else
                 {
                     d->input_tail = NULL;
+#if defined(UNIX_NETWORKING_THREADS)
+                    io_input_drained(d);
+#endif // UNIX_NETWORKING_THREADS
+                }
+#if defined(UNIX_NETWORKING_THREADS)
+                bool bLocked = lock_descriptor(d);
+                d->input_size -= strlen((char *)t->cmd);
+                if (bLocked)
+                {
+                    unlock_descriptor(d);
                 }
+#else // UNIX_NETWORKING_THREADS
                 d->input_size -= strlen((char *)t->cmd);
+#endif // UNIX_NETWORKING_THREADS
                 d->last_time.GetUTC();
+                pool_arena_open();
                 if (d->program_data != NULL)
                 {
                     handle_prog(d, t->cmd);
@@ -2963,6 +3006,7 @@ void Task_ProcessCommand(void *arg_voidptr, int arg_iInteger)
                 {
                     do_command(d, t->cmd);
                 }
+                pool_arena_close();
                 free_lbuf(t);
             }
             else
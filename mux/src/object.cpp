@@ -10,6 +10,11 @@
 #include "config.h"
 #include "externs.h"
 
+#if defined(HAVE_PTHREAD_H)
+#include <pthread.h>
+#include <signal.h>
+#endif // HAVE_PTHREAD_H
+
 #include "attrs.h"
 #include "command.h"
 #include "mathutil.h"
@@ -503,7 +508,9 @@ dbref create_obj(dbref player, int objtype, const UTF8 *name, int cost)
         s_Zone(obj, NOTHING);
     }
     f.word[FLAG_WORD1] |= objtype;
-    db[obj].fs = f;
+    s_Flags(obj, FLAG_WORD1, f.word[FLAG_WORD1]);
+    s_Flags(obj, FLAG_WORD2, f.word[FLAG_WORD2]);
+    s_Flags(obj, FLAG_WORD3, f.word[FLAG_WORD3]);
     s_Owner(obj, (self_owned ? obj : owner));
     s_Pennies(obj, value);
     Unmark(obj);
@@ -861,12 +868,17 @@ void destroy_player(dbref player, dbref victim)
     notify_quiet(player, tprintf(T("(%d objects @chowned to you)"), count));
 }
 
-static void purge_going(void)
+// With bHold, objects in mudstate.bfDbckHold are left GOING for a later
+// pass of the incremental check.
+//
+static void purge_going(bool bHold)
 {
     dbref i;
     DO_WHOLE_DB(i)
     {
-        if (!Going(i))
+        if (  !ScanGoing(i)
+           || (  bHold
+              && mudstate.bfDbckHold.IsSet(i)))
         {
             continue;
         }
@@ -888,7 +900,7 @@ static void purge_going(void)
                 }
                 log_text(T("GOING object doesn\xE2\x80\x99t remember its destroyer. GOING reset."));
                 ENDLOG;
-                db[i].fs.word[FLAG_WORD1] &= ~GOING;
+                s_Flags(i, FLAG_WORD1, Flags(i) & ~GOING);
             }
             else
             {
@@ -962,31 +974,52 @@ static void check_pennies(dbref thing, int limit, const UTF8 *qual)
     }
 }
 
-static void check_dead_refs(void)
+static void check_dead_ref(dbref i)
 {
-    dbref targ, owner, i, j;
+    dbref targ, owner, j;
     int aflags;
     UTF8 *str;
     FWDLIST *fp;
     bool dirty;
 
-    DO_WHOLE_DB(i)
+    // Check the owner.
+    //
+    owner = ScanOwner(i);
+    if (!Good_obj(owner))
     {
-        // Check the owner.
-        //
-        owner = Owner(i);
-        if (!Good_obj(owner))
+        if (isPlayer(i))
+        {
+            Log_header_err(i, NOTHING, owner, true, T("Owner"),
+                T("is invalid.  Set to player."));
+            owner = i;
+        }
+        else
+        {
+            Log_header_err(i, NOTHING, owner, true, T("Owner"),
+                T("is invalid.  Set to GOD."));
+            owner = GOD;
+        }
+        s_Owner(i, owner);
+        if (!mudstate.bStandAlone)
+        {
+            halt_que(NOTHING, i);
+        }
+        s_Halted(i);
+    }
+    else if (check_type & DBCK_FULL)
+    {
+        if (ScanGoing(owner))
         {
             if (isPlayer(i))
             {
-                Log_header_err(i, NOTHING, owner, true, T("Owner"),
-                    T("is invalid.  Set to player."));
+                Log_header_err(i, NOTHING, owner, true,
+                   T("Owner"), T("is set GOING.  Set to player."));
                 owner = i;
             }
             else
             {
-                Log_header_err(i, NOTHING, owner, true, T("Owner"),
-                    T("is invalid.  Set to GOD."));
+                Log_header_err(i, NOTHING, owner, true,
+                   T("Owner"), T("is set GOING.  Set to GOD."));
                 owner = GOD;
             }
             s_Owner(i, owner);
@@ -996,391 +1029,376 @@ static void check_dead_refs(void)
             }
             s_Halted(i);
         }
-        else if (check_type & DBCK_FULL)
+        else if (!OwnsOthers(owner))
         {
-            if (Going(owner))
+            if (isPlayer(i))
             {
-                if (isPlayer(i))
-                {
-                    Log_header_err(i, NOTHING, owner, true,
-                       T("Owner"), T("is set GOING.  Set to player."));
-                    owner = i;
-                }
-                else
-                {
-                    Log_header_err(i, NOTHING, owner, true,
-                       T("Owner"), T("is set GOING.  Set to GOD."));
-                    owner = GOD;
-                }
-                s_Owner(i, owner);
-                if (!mudstate.bStandAlone)
-                {
-                    halt_que(NOTHING, i);
-                }
-                s_Halted(i);
+                Log_header_err(i, NOTHING, owner, true,
+                   T("Owner"), T("is not a valid owner type.  Set to player."));
+                owner = i;
             }
-            else if (!OwnsOthers(owner))
+            else
             {
-                if (isPlayer(i))
-                {
-                    Log_header_err(i, NOTHING, owner, true,
-                       T("Owner"), T("is not a valid owner type.  Set to player."));
-                    owner = i;
-                }
-                else
-                {
-                    Log_header_err(i, NOTHING, owner, true,
-                       T("Owner"), T("is not a valid owner type.  Set to GOD."));
-                    owner = GOD;
-                }
-                s_Owner(i, owner);
+                Log_header_err(i, NOTHING, owner, true,
+                   T("Owner"), T("is not a valid owner type.  Set to GOD."));
+                owner = GOD;
             }
+            s_Owner(i, owner);
         }
+    }
 
-        // Check the parent
-        //
-        targ = Parent(i);
-        if (Good_obj(targ))
+    // Check the parent
+    //
+    targ = ScanParent(i);
+    if (Good_obj(targ))
+    {
+        if (ScanGoing(targ))
         {
-            if (Going(targ))
+            s_Parent(i, NOTHING);
+            if (!mudstate.bStandAlone)
             {
-                s_Parent(i, NOTHING);
-                if (!mudstate.bStandAlone)
+                if (  !Quiet(i)
+                   && !Quiet(owner))
                 {
-                    if (  !Quiet(i)
-                       && !Quiet(owner))
-                    {
-                        notify(owner, tprintf(T("Parent cleared on %s(#%d)"),
-                            Moniker(i), i));
-                    }
+                    notify(owner, tprintf(T("Parent cleared on %s(#%d)"),
+                        Moniker(i), i));
                 }
-                else
+            }
+            else
+            {
+                Log_header_err(i, Location(i), targ, true, T("Parent"),
+                    T("is invalid.  Cleared."));
+            }
+        }
+    }
+    else if (targ != NOTHING)
+    {
+        Log_header_err(i, Location(i), targ, true,
+            T("Parent"), T("is invalid.  Cleared."));
+        s_Parent(i, NOTHING);
+    }
+
+    // Check the zone.
+    //
+    targ = ScanZone(i);
+    if (Good_obj(targ))
+    {
+        if (ScanGoing(targ))
+        {
+            s_Zone(i, NOTHING);
+            if (!mudstate.bStandAlone)
+            {
+                owner = Owner(i);
+                if (  !Quiet(i)
+                   && !Quiet(owner))
                 {
-                    Log_header_err(i, Location(i), targ, true, T("Parent"),
-                        T("is invalid.  Cleared."));
+                    notify(owner, tprintf(T("Zone cleared on %s(#%d)"),
+                        Moniker(i), i));
                 }
             }
+            else
+            {
+                Log_header_err(i, Location(i), targ, true, T("Zone"),
+                    T("is invalid.  Cleared."));
+            }
         }
-        else if (targ != NOTHING)
+    }
+    else if (targ != NOTHING)
+    {
+        Log_header_err(i, Location(i), targ, true, T("Zone"),
+            T("is invalid.  Cleared."));
+        s_Zone(i, NOTHING);
+    }
+
+    // Check forwardlist
+    //
+    fp = (ScanFlags(i, FLAG_WORD2) & HAS_FWDLIST) ? fwdlist_get(i) : NULL;
+    dirty = false;
+    if (fp)
+    {
+        for (j = 0; j < fp->count; j++)
         {
-            Log_header_err(i, Location(i), targ, true,
-                T("Parent"), T("is invalid.  Cleared."));
-            s_Parent(i, NOTHING);
+            targ = fp->data[j];
+            if (  Good_obj(targ)
+               && Going(targ))
+            {
+                fp->data[j] = NOTHING;
+                dirty = true;
+            }
+            else if (  !Good_obj(targ)
+                    && targ != NOTHING)
+            {
+                fp->data[j] = NOTHING;
+                dirty = true;
+            }
         }
+    }
+    if (dirty)
+    {
+        str = alloc_lbuf("purge_going");
+        (void)fwdlist_rewrite(fp, str);
+        atr_get_info(i, A_FORWARDLIST, &owner, &aflags);
+        atr_add(i, A_FORWARDLIST, str, owner, aflags);
+        free_lbuf(str);
+    }
 
-        // Check the zone.
+    if (check_type & DBCK_FULL)
+    {
+        // Check for wizards
         //
-        targ = Zone(i);
-        if (Good_obj(targ))
+        if (RealWizard(i))
         {
-            if (Going(targ))
+            if (isPlayer(i))
             {
-                s_Zone(i, NOTHING);
-                if (!mudstate.bStandAlone)
-                {
-                    owner = Owner(i);
-                    if (  !Quiet(i)
-                       && !Quiet(owner))
-                    {
-                        notify(owner, tprintf(T("Zone cleared on %s(#%d)"),
-                            Moniker(i), i));
-                    }
-                }
-                else
-                {
-                    Log_header_err(i, Location(i), targ, true, T("Zone"),
-                        T("is invalid.  Cleared."));
-                }
+                Log_simple_err(i, NOTHING, T("Player is a WIZARD."));
+            }
+            if (!Wizard(Owner(i)))
+            {
+                Log_header_err(i, NOTHING, Owner(i), true,
+                           T("Owner"), T("of a WIZARD object is not a wizard"));
             }
         }
-        else if (targ != NOTHING)
+    }
+
+    switch (Typeof(i))
+    {
+    case TYPE_PLAYER:
+        // Check home.
+        //
+        targ = Home(i);
+        if (  !Good_obj(targ)
+           || !Has_contents(targ))
         {
-            Log_header_err(i, Location(i), targ, true, T("Zone"),
-                T("is invalid.  Cleared."));
-            s_Zone(i, NOTHING);
+            Log_simple_err(i, Location(i), T("Bad home. Reset."));
+            s_Home(i, default_home());
         }
 
-        // Check forwardlist
+        // Check the location.
         //
-        fp = fwdlist_get(i);
-        dirty = false;
-        if (fp)
+        targ = Location(i);
+        if (  !Good_obj(targ)
+           || !Has_contents(targ))
         {
-            for (j = 0; j < fp->count; j++)
-            {
-                targ = fp->data[j];
-                if (  Good_obj(targ)
-                   && Going(targ))
-                {
-                    fp->data[j] = NOTHING;
-                    dirty = true;
-                }
-                else if (  !Good_obj(targ)
-                        && targ != NOTHING)
-                {
-                    fp->data[j] = NOTHING;
-                    dirty = true;
-                }
-            }
+            Log_pointer_err(NOTHING, i, NOTHING, targ, T("Location"),
+                T("is invalid.  Moved to home."));
+            move_object(i, Home(i));
         }
-        if (dirty)
+
+        // Check for self-referential Next().
+        //
+        if (Next(i) == i)
         {
-            str = alloc_lbuf("purge_going");
-            (void)fwdlist_rewrite(fp, str);
-            atr_get_info(i, A_FORWARDLIST, &owner, &aflags);
-            atr_add(i, A_FORWARDLIST, str, owner, aflags);
-            free_lbuf(str);
+            Log_simple_err(i, NOTHING,
+                 T("Next points to self.  Next cleared."));
+            s_Next(i, NOTHING);
         }
 
         if (check_type & DBCK_FULL)
         {
-            // Check for wizards
+            // Check wealth.
             //
-            if (RealWizard(i))
+            targ = mudconf.paylimit;
+            check_pennies(i, targ, T("Wealth"));
+        }
+        break;
+
+    case TYPE_THING:
+
+        // Check home.
+        //
+        targ = Home(i);
+        if (  !Good_obj(targ)
+           || !Has_contents(targ))
+        {
+            if (!mudstate.bStandAlone)
             {
-                if (isPlayer(i))
+                if (  !Quiet(i)
+                   && !Quiet(owner))
                 {
-                    Log_simple_err(i, NOTHING, T("Player is a WIZARD."));
+                    notify(owner, tprintf(T("Home reset on %s(#%d)"),
+                        Moniker(i), i));
                 }
-                if (!Wizard(Owner(i)))
+                else
                 {
-                    Log_header_err(i, NOTHING, Owner(i), true,
-                               T("Owner"), T("of a WIZARD object is not a wizard"));
+                    Log_header_err(i, Location(i), targ, true, T("Home"),
+                        T("is invalid.  Cleared."));
                 }
             }
+            s_Home(i, new_home(i));
         }
 
-        switch (Typeof(i))
+        // Check the location.
+        //
+        targ = Location(i);
+        if (  !Good_obj(targ)
+           || !Has_contents(targ))
         {
-        case TYPE_PLAYER:
-            // Check home.
-            //
-            targ = Home(i);
-            if (  !Good_obj(targ)
-               || !Has_contents(targ))
-            {
-                Log_simple_err(i, Location(i), T("Bad home. Reset."));
-                s_Home(i, default_home());
-            }
-
-            // Check the location.
-            //
-            targ = Location(i);
-            if (  !Good_obj(targ)
-               || !Has_contents(targ))
-            {
-                Log_pointer_err(NOTHING, i, NOTHING, targ, T("Location"),
-                    T("is invalid.  Moved to home."));
-                move_object(i, Home(i));
-            }
+            Log_pointer_err(NOTHING, i, NOTHING, targ, T("Location"),
+                T("is invalid.  Moved to home."));
+            move_object(i, HOME);
+        }
 
-            // Check for self-referential Next().
+        // Check for self-referential Next().
+        //
+        if (Next(i) == i)
+        {
+            Log_simple_err(i, NOTHING,
+                T("Next points to self.  Next cleared."));
+            s_Next(i, NOTHING);
+        }
+        if (check_type & DBCK_FULL)
+        {
+            // Check value.
             //
-            if (Next(i) == i)
-            {
-                Log_simple_err(i, NOTHING,
-                     T("Next points to self.  Next cleared."));
-                s_Next(i, NOTHING);
-            }
-
-            if (check_type & DBCK_FULL)
-            {
-                // Check wealth.
-                //
-                targ = mudconf.paylimit;
-                check_pennies(i, targ, T("Wealth"));
-            }
-            break;
+            targ = OBJECT_ENDOWMENT(mudconf.createmax);
+            check_pennies(i, targ, T("Value"));
+        }
+        break;
 
-        case TYPE_THING:
+    case TYPE_ROOM:
 
-            // Check home.
-            //
-            targ = Home(i);
-            if (  !Good_obj(targ)
-               || !Has_contents(targ))
+        // Check the dropto.
+        //
+        targ = Dropto(i);
+        if (Good_obj(targ))
+        {
+            if (Going(targ))
             {
+                s_Dropto(i, NOTHING);
                 if (!mudstate.bStandAlone)
                 {
                     if (  !Quiet(i)
                        && !Quiet(owner))
                     {
-                        notify(owner, tprintf(T("Home reset on %s(#%d)"),
+                        notify(owner, tprintf(T("Dropto removed from %s(#%d)"),
                             Moniker(i), i));
                     }
-                    else
-                    {
-                        Log_header_err(i, Location(i), targ, true, T("Home"),
-                            T("is invalid.  Cleared."));
-                    }
                 }
-                s_Home(i, new_home(i));
-            }
-
-            // Check the location.
-            //
-            targ = Location(i);
-            if (  !Good_obj(targ)
-               || !Has_contents(targ))
-            {
-                Log_pointer_err(NOTHING, i, NOTHING, targ, T("Location"),
-                    T("is invalid.  Moved to home."));
-                move_object(i, HOME);
+                else
+                {
+                    Log_header_err(i, NOTHING, targ, true, T("Dropto"),
+                        T("is invalid.  Removed."));
+                }
             }
-
-            // Check for self-referential Next().
+        }
+        else if (  targ != NOTHING
+                && targ != HOME)
+        {
+            Log_header_err(i, NOTHING, targ, true, T("Dropto"),
+                T("is invalid.  Cleared."));
+            s_Dropto(i, NOTHING);
+        }
+        if (check_type & DBCK_FULL)
+        {
+            // NEXT should be null.
             //
-            if (Next(i) == i)
+            if (Next(i) != NOTHING)
             {
-                Log_simple_err(i, NOTHING,
-                    T("Next points to self.  Next cleared."));
+                Log_header_err(i, NOTHING, Next(i), true, T("Next pointer"),
+                    T("should be NOTHING.  Reset."));
                 s_Next(i, NOTHING);
             }
-            if (check_type & DBCK_FULL)
-            {
-                // Check value.
-                //
-                targ = OBJECT_ENDOWMENT(mudconf.createmax);
-                check_pennies(i, targ, T("Value"));
-            }
-            break;
-
-        case TYPE_ROOM:
 
-            // Check the dropto.
+            // LINK should be null.
             //
-            targ = Dropto(i);
-            if (Good_obj(targ))
-            {
-                if (Going(targ))
-                {
-                    s_Dropto(i, NOTHING);
-                    if (!mudstate.bStandAlone)
-                    {
-                        if (  !Quiet(i)
-                           && !Quiet(owner))
-                        {
-                            notify(owner, tprintf(T("Dropto removed from %s(#%d)"),
-                                Moniker(i), i));
-                        }
-                    }
-                    else
-                    {
-                        Log_header_err(i, NOTHING, targ, true, T("Dropto"),
-                            T("is invalid.  Removed."));
-                    }
-                }
-            }
-            else if (  targ != NOTHING
-                    && targ != HOME)
+            if (Link(i) != NOTHING)
             {
-                Log_header_err(i, NOTHING, targ, true, T("Dropto"),
-                    T("is invalid.  Cleared."));
-                s_Dropto(i, NOTHING);
+                Log_header_err(i, NOTHING, Link(i), true, T("Link pointer "),
+                    T("should be NOTHING.  Reset."));
+                s_Link(i, NOTHING);
             }
-            if (check_type & DBCK_FULL)
-            {
-                // NEXT should be null.
-                //
-                if (Next(i) != NOTHING)
-                {
-                    Log_header_err(i, NOTHING, Next(i), true, T("Next pointer"),
-                        T("should be NOTHING.  Reset."));
-                    s_Next(i, NOTHING);
-                }
-
-                // LINK should be null.
-                //
-                if (Link(i) != NOTHING)
-                {
-                    Log_header_err(i, NOTHING, Link(i), true, T("Link pointer "),
-                        T("should be NOTHING.  Reset."));
-                    s_Link(i, NOTHING);
-                }
 
-                // Check value.
-                //
-                check_pennies(i, 1, T("Value"));
-            }
-            break;
+            // Check value.
+            //
+            check_pennies(i, 1, T("Value"));
+        }
+        break;
 
-        case TYPE_EXIT:
+    case TYPE_EXIT:
 
-            // If it points to something GOING, set it going.
-            //
-            targ = Location(i);
-            if (Good_obj(targ))
-            {
-                if (Going(targ))
-                {
-                    s_Going(i);
-                }
-            }
-            else if (targ == HOME)
+        // If it points to something GOING, set it going.
+        //
+        targ = Location(i);
+        if (Good_obj(targ))
+        {
+            if (Going(targ))
             {
-                // null case, HOME is always valid.
-                //
+                s_Going(i);
             }
-            else if (targ != NOTHING)
+        }
+        else if (targ == HOME)
+        {
+            // null case, HOME is always valid.
+            //
+        }
+        else if (targ != NOTHING)
+        {
+            Log_header_err(i, Exits(i), targ, true, T("Destination"),
+                T("is invalid.  Exit destroyed."));
+            s_Going(i);
+        }
+        else
+        {
+            if (!Has_contents(targ))
             {
                 Log_header_err(i, Exits(i), targ, true, T("Destination"),
-                    T("is invalid.  Exit destroyed."));
+                    T("is not a valid type.  Exit destroyed."));
                 s_Going(i);
             }
-            else
+        }
+
+        // Check for self-referential Next().
+        //
+        if (Next(i) == i)
+        {
+            Log_simple_err(i, NOTHING,
+                T("Next points to self.  Next cleared."));
+            s_Next(i, NOTHING);
+        }
+        if (check_type & DBCK_FULL)
+        {
+            // CONTENTS should be null.
+            //
+            if (Contents(i) != NOTHING)
             {
-                if (!Has_contents(targ))
-                {
-                    Log_header_err(i, Exits(i), targ, true, T("Destination"),
-                        T("is not a valid type.  Exit destroyed."));
-                    s_Going(i);
-                }
+                Log_header_err(i, Exits(i), Contents(i), true, T("Contents"),
+                    T("should be NOTHING.  Reset."));
+                s_Contents(i, NOTHING);
             }
 
-            // Check for self-referential Next().
+            // LINK should be null.
             //
-            if (Next(i) == i)
+            if (Link(i) != NOTHING)
             {
-                Log_simple_err(i, NOTHING,
-                    T("Next points to self.  Next cleared."));
-                s_Next(i, NOTHING);
+                Log_header_err(i, Exits(i), Link(i), true, T("Link"),
+                    T("should be NOTHING.  Reset."));
+                s_Link(i, NOTHING);
             }
-            if (check_type & DBCK_FULL)
-            {
-                // CONTENTS should be null.
-                //
-                if (Contents(i) != NOTHING)
-                {
-                    Log_header_err(i, Exits(i), Contents(i), true, T("Contents"),
-                        T("should be NOTHING.  Reset."));
-                    s_Contents(i, NOTHING);
-                }
 
-                // LINK should be null.
-                //
-                if (Link(i) != NOTHING)
-                {
-                    Log_header_err(i, Exits(i), Link(i), true, T("Link"),
-                        T("should be NOTHING.  Reset."));
-                    s_Link(i, NOTHING);
-                }
+            // Check value.
+            //
+            check_pennies(i, 1, T("Value"));
+        }
+        break;
 
-                // Check value.
-                //
-                check_pennies(i, 1, T("Value"));
-            }
-            break;
+    case TYPE_GARBAGE:
+        break;
 
-        case TYPE_GARBAGE:
-            break;
+    default:
 
-        default:
+        // Funny object type, destroy it.
+        //
+        Log_simple_err(i, NOTHING, T("Funny object type.  Destroyed."));
+        destroy_obj(i);
+    }
+}
 
-            // Funny object type, destroy it.
-            //
-            Log_simple_err(i, NOTHING, T("Funny object type.  Destroyed."));
-            destroy_obj(i);
-        }
+static void check_dead_refs(void)
+{
+    dbref i;
+    DO_WHOLE_DB(i)
+    {
+        check_dead_ref(i);
     }
 }
 
@@ -1585,7 +1603,7 @@ static void check_exit_chains(void)
     }
     DO_WHOLE_DB(i)
     {
-        if (  isExit(i)
+        if (  TYPE_EXIT == ScanTypeof(i)
            && !Marked(i))
         {
             Log_simple_err(i, NOTHING, T("Disconnected exit.  Destroyed."));
@@ -1776,9 +1794,9 @@ static void check_contents_chains(void)
     }
     DO_WHOLE_DB(i)
     {
-        if (  !Going(i)
+        if (  !ScanGoing(i)
            && !Marked(i)
-           && Has_location(i))
+           && (object_types[ScanTypeof(i)].flags & OF_LOCATION))
         {
             Log_simple_err(i, Location(i), T("Orphaned object, moved home."));
             s_Location(i, NOTHING);
@@ -1814,9 +1832,10 @@ static void mark_place(dbref loc)
     dbref exit;
     for (exit = Exits(loc); exit != NOTHING; exit = Next(exit))
     {
-        if (Good_obj(Location(exit)))
+        dbref dest = ScanLocation(exit);
+        if (Good_obj(dest))
         {
-            mark_place(Location(exit));
+            mark_place(dest);
         }
     }
 }
@@ -1834,9 +1853,9 @@ static void check_floating(void)
     //
     DO_WHOLE_DB(i)
     {
-        if (  isRoom(i)
-           && Floating(i)
-           && !Going(i))
+        if (  TYPE_ROOM == ScanTypeof(i)
+           && (ScanFlags(i, FLAG_WORD2) & FLOATING)
+           && !ScanGoing(i))
         {
             mark_place(i);
         }
@@ -1846,8 +1865,8 @@ static void check_floating(void)
     //
     DO_WHOLE_DB(i)
     {
-        if (  isRoom(i)
-           && !Going(i)
+        if (  TYPE_ROOM == ScanTypeof(i)
+           && !ScanGoing(i)
            && !Marked(i))
         {
             if (!mudstate.bStandAlone)
@@ -1867,29 +1886,12 @@ static void check_floating(void)
     }
 }
 
-/*
- * ---------------------------------------------------------------------------
- * * do_dbck: Perform a database consistency check and clean up damage.
- */
+static void dbck_hold_referred(void);
 
-void do_dbck(dbref executor, dbref caller, dbref enactor, int eval, int key)
+// dbck_maintenance: The housekeeping which follows every check.
+//
+static void dbck_maintenance(void)
 {
-    UNUSED_PARAMETER(caller);
-    UNUSED_PARAMETER(enactor);
-    UNUSED_PARAMETER(eval);
-
-    check_type = key;
-    check_dead_refs();
-    check_exit_chains();
-    check_contents_chains();
-    check_floating();
-    if (  !mudstate.bStandAlone
-       && executor != NOTHING)
-    {
-        Guest.CleanUp();
-    }
-    purge_going();
-    make_freelist();
     scheduler.Shrink();
 #if defined(TINYMUX_MODULES)
     mux_ModuleMaintenance();
@@ -1912,6 +1914,549 @@ void do_dbck(dbref executor, dbref caller, dbref enactor, int eval, int key)
         p = p->pNext;
     }
 #endif // TINYMUX_MODULES
+}
+
+/* ---------------------------------------------------------------------------
+ * Incremental @dbck.
+ *
+ * The periodic check runs as a string of short tasks so that a large database
+ * does not stall the game.  The per-object checks are made check_slice
+ * objects at a time.  The first pass after startup looks at every object, and
+ * later passes only look at objects which have changed since, along with
+ * anything that refers to an object which has gone away.
+ *
+ * The exit chains, contents chains, and floating rooms are then verified
+ * against a snapshot, on a worker thread where threads are available.  The
+ * repairing checks above are only run if the snapshot shows damage.
+ */
+
+#define DBCK_IDLE       0
+#define DBCK_REFS       1
+#define DBCK_VERIFY     2
+#define DBCK_WAIT       3
+
+#define SNAP_GOING      0x01
+#define SNAP_FLOATING   0x02
+
+typedef struct
+{
+    dbref location;
+    dbref exits;
+    dbref contents;
+    dbref next;
+    UINT8 type;
+    UINT8 bits;
+} DBCK_OBJ;
+
+typedef struct
+{
+    DBCK_OBJ *aObj;
+    int       nObj;
+    dbref     start_room;
+    UINT8    *aMark;
+    dbref    *aStack;
+    dbref    *aFloating;
+    int       nFloating;
+    bool      bDamaged;
+
+#if defined(HAVE_PTHREAD_H)
+    pthread_t       thread;
+    pthread_mutex_t mutex;
+    bool            bThread;
+    bool            bDone;
+#endif // HAVE_PTHREAD_H
+} DBCK_SNAPSHOT;
+
+static int   dbck_state = DBCK_IDLE;
+static dbref dbck_cursor;
+static bool  dbck_sweep = true;
+static bool  dbck_changed;
+static DBCK_SNAPSHOT dbck_snap;
+
+#define SNAP_GOOD(ps,x)     (  0 <= (x) && (x) < (ps)->nObj \
+                            && (ps)->aObj[x].type < TYPE_GARBAGE)
+
+// Marks every room reachable through exits from loc.
+//
+static void snap_mark_place(DBCK_SNAPSHOT *ps, dbref loc)
+{
+    int nStack = 0;
+    if (  SNAP_GOOD(ps, loc)
+       && !ps->aMark[loc])
+    {
+        ps->aMark[loc] = 1;
+        ps->aStack[nStack++] = loc;
+    }
+    while (0 < nStack)
+    {
+        loc = ps->aStack[--nStack];
+        int nSteps = 0;
+        for (dbref exit = ps->aObj[loc].exits;
+             0 <= exit && exit < ps->nObj && nSteps < ps->nObj;
+             exit = ps->aObj[exit].next, nSteps++)
+        {
+            dbref dest = ps->aObj[exit].location;
+            if (  SNAP_GOOD(ps, dest)
+               && !ps->aMark[dest])
+            {
+                ps->aMark[dest] = 1;
+                ps->aStack[nStack++] = dest;
+            }
+        }
+    }
+}
+
+// Read-only versions of check_exit_chains(), check_contents_chains(), and
+// check_floating().  Any condition which those would repair is reported as
+// damage rather than examined further.
+//
+static void *dbck_verify(void *arg)
+{
+    DBCK_SNAPSHOT *ps = (DBCK_SNAPSHOT *)arg;
+    DBCK_OBJ *o = ps->aObj;
+    int n = ps->nObj;
+    bool bDamaged = false;
+    dbref i, j;
+
+    memset(ps->aMark, 0, n);
+    for (i = 0; i < n && !bDamaged; i++)
+    {
+        if (  !SNAP_GOOD(ps, i)
+           || TYPE_EXIT == o[i].type
+           || (o[i].bits & SNAP_GOING))
+        {
+            continue;
+        }
+        for (j = o[i].exits; NOTHING != j; j = o[j].next)
+        {
+            if (  !SNAP_GOOD(ps, j)
+               || TYPE_EXIT != o[j].type
+               || (o[j].bits & SNAP_GOING)
+               || ps->aMark[j]
+               || o[j].exits != i
+               || (  !SNAP_GOOD(ps, o[j].location)
+                  && HOME != o[j].location
+                  && NOTHING != o[j].location))
+            {
+                bDamaged = true;
+                break;
+            }
+            ps->aMark[j] = 1;
+        }
+    }
+    for (i = 0; i < n && !bDamaged; i++)
+    {
+        if (  TYPE_EXIT == o[i].type
+           && !ps->aMark[i])
+        {
+            bDamaged = true;
+        }
+    }
+
+    memset(ps->aMark, 0, n);
+    for (i = 0; i < n && !bDamaged; i++)
+    {
+        if (  !SNAP_GOOD(ps, i)
+           || TYPE_EXIT == o[i].type
+           || (o[i].bits & SNAP_GOING))
+        {
+            continue;
+        }
+        for (j = o[i].contents; NOTHING != j; j = o[j].next)
+        {
+            if (  !SNAP_GOOD(ps, j)
+               || !(object_types[o[j].type].flags & OF_LOCATION)
+               || ps->aMark[j]
+               || o[j].location != i)
+            {
+                bDamaged = true;
+                break;
+            }
+            ps->aMark[j] = 1;
+        }
+    }
+    for (i = 0; i < n && !bDamaged; i++)
+    {
+        if (  !(o[i].bits & SNAP_GOING)
+           && !ps->aMark[i]
+           && (object_types[o[i].type].flags & OF_LOCATION))
+        {
+            bDamaged = true;
+        }
+    }
+
+    ps->nFloating = 0;
+    if (!bDamaged)
+    {
+        memset(ps->aMark, 0, n);
+        snap_mark_place(ps, ps->start_room);
+        for (i = 0; i < n; i++)
+        {
+            if (  TYPE_ROOM == o[i].type
+               && (o[i].bits & SNAP_FLOATING)
+               && !(o[i].bits & SNAP_GOING))
+            {
+                snap_mark_place(ps, i);
+            }
+        }
+        for (i = 0; i < n; i++)
+        {
+            if (  TYPE_ROOM == o[i].type
+               && !(o[i].bits & SNAP_GOING)
+               && !ps->aMark[i])
+            {
+                ps->aFloating[ps->nFloating++] = i;
+            }
+        }
+    }
+    ps->bDamaged = bDamaged;
+
+#if defined(HAVE_PTHREAD_H)
+    if (ps->bThread)
+    {
+        pthread_mutex_lock(&ps->mutex);
+        ps->bDone = true;
+        pthread_mutex_unlock(&ps->mutex);
+    }
+#endif // HAVE_PTHREAD_H
+    return NULL;
+}
+
+// Copies the fields the chain checks use and starts dbck_verify() on them.
+//
+static void dbck_snapshot(void)
+{
+    DBCK_SNAPSHOT *ps = &dbck_snap;
+    int n = mudstate.db_top;
+    ps->nObj       = n;
+    ps->start_room = mudconf.start_room;
+    ps->aObj       = (DBCK_OBJ *)MEMALLOC((n + 1) * sizeof(DBCK_OBJ));
+    ISOUTOFMEMORY(ps->aObj);
+    ps->aMark      = (UINT8 *)MEMALLOC(n + 1);
+    ISOUTOFMEMORY(ps->aMark);
+    ps->aStack     = (dbref *)MEMALLOC((n + 1) * sizeof(dbref));
+    ISOUTOFMEMORY(ps->aStack);
+    ps->aFloating  = (dbref *)MEMALLOC((n + 1) * sizeof(dbref));
+    ISOUTOFMEMORY(ps->aFloating);
+
+    for (dbref i = 0; i < n; i++)
+    {
+        DBCK_OBJ *p = &ps->aObj[i];
+        p->location = ScanLocation(i);
+        p->exits    = Exits(i);
+        p->contents = Contents(i);
+        p->next     = Next(i);
+        p->type     = (UINT8)ScanTypeof(i);
+        p->bits     = 0;
+        if (ScanGoing(i))
+        {
+            p->bits |= SNAP_GOING;
+        }
+        if (ScanFlags(i, FLAG_WORD2) & FLOATING)
+        {
+            p->bits |= SNAP_FLOATING;
+        }
+    }
+
+#if defined(HAVE_PTHREAD_H)
+    ps->bDone = false;
+    pthread_mutex_init(&ps->mutex, NULL);
+
+    sigset_t all, old;
+    sigfillset(&all);
+    pthread_sigmask(SIG_SETMASK, &all, &old);
+    ps->bThread = (0 == pthread_create(&ps->thread, NULL, dbck_verify, ps));
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+    if (ps->bThread)
+    {
+        return;
+    }
+#endif // HAVE_PTHREAD_H
+    dbck_verify(ps);
+}
+
+static bool dbck_verified(void)
+{
+#if defined(HAVE_PTHREAD_H)
+    DBCK_SNAPSHOT *ps = &dbck_snap;
+    if (ps->bThread)
+    {
+        pthread_mutex_lock(&ps->mutex);
+        bool bDone = ps->bDone;
+        pthread_mutex_unlock(&ps->mutex);
+        if (!bDone)
+        {
+            return false;
+        }
+        pthread_join(ps->thread, NULL);
+        ps->bThread = false;
+    }
+    pthread_mutex_destroy(&ps->mutex);
+#endif // HAVE_PTHREAD_H
+    return true;
+}
+
+// Acts on what dbck_verify() found, then finishes the pass.
+//
+static void dbck_repair(void)
+{
+    DBCK_SNAPSHOT *ps = &dbck_snap;
+    if (ps->bDamaged)
+    {
+        check_exit_chains();
+        check_contents_chains();
+        check_floating();
+    }
+    else
+    {
+        for (int k = 0; k < ps->nFloating; k++)
+        {
+            dbref i = ps->aFloating[k];
+            if (  Good_obj(i)
+               && isRoom(i)
+               && !Going(i)
+               && !Floating(i))
+            {
+                dbref owner = Owner(i);
+                if (Good_owner(owner))
+                {
+                    notify(owner, tprintf(T("You own a floating room: %s(#%d)"),
+                        Moniker(i), i));
+                }
+            }
+        }
+    }
+    MEMFREE(ps->aObj);
+    MEMFREE(ps->aMark);
+    MEMFREE(ps->aStack);
+    MEMFREE(ps->aFloating);
+    ps->aObj      = NULL;
+    ps->aMark     = NULL;
+    ps->aStack    = NULL;
+    ps->aFloating = NULL;
+
+    if (  ps->bDamaged
+       || dbck_changed)
+    {
+        dbck_hold_referred();
+        purge_going(true);
+        make_freelist();
+    }
+    dbck_maintenance();
+}
+
+/*! \brief Notes that an object has been set GOING.
+ *
+ * Everything which refers to thing as owner, parent, zone, home,
+ * destination, or dropto, or names it in a forwardlist, needs another look
+ * before thing can be purged.  A pass which is already under way may have
+ * gone past some of them, so it leaves thing for the next pass.
+ *
+ * \param thing  Object just set GOING.
+ * \return       None.
+ */
+
+void dbck_going(dbref thing)
+{
+    static const int aIndex[] = { RX_OWNER, RX_PARENT, RX_ZONE, RX_ENTRANCE };
+    for (size_t k = 0; k < sizeof(aIndex)/sizeof(aIndex[0]); k++)
+    {
+        dbref i;
+        DO_RX(i, aIndex[k], thing)
+        {
+            mudstate.bfDbckDirty.Set(i);
+        }
+    }
+
+    int nKey;
+    UTF8 *pKey;
+    for (FWDLIST *fp = (FWDLIST *)hash_firstkey(&mudstate.fwdlist_htab, &nKey, &pKey);
+         NULL != fp;
+         fp = (FWDLIST *)hash_nextkey(&mudstate.fwdlist_htab, &nKey, &pKey))
+    {
+        for (int j = 0; j < fp->count; j++)
+        {
+            if (fp->data[j] == thing)
+            {
+                dbref holder;
+                memcpy(&holder, pKey, sizeof(dbref));
+                mudstate.bfDbckDirty.Set(holder);
+                break;
+            }
+        }
+    }
+
+    if (DBCK_IDLE != dbck_state)
+    {
+        mudstate.bfDbckHold.Set(thing);
+    }
+}
+
+// A reference to a GOING object can still be made after the pass has gone
+// past the object making it.  Anything still named by a parent, zone,
+// dropto, live exit, or forwardlist is left for the next pass, and whatever
+// names it is looked at again.
+//
+static void dbck_hold_referred(void)
+{
+    int nKey;
+    UTF8 *pKey;
+    for (FWDLIST *fp = (FWDLIST *)hash_firstkey(&mudstate.fwdlist_htab, &nKey, &pKey);
+         NULL != fp;
+         fp = (FWDLIST *)hash_nextkey(&mudstate.fwdlist_htab, &nKey, &pKey))
+    {
+        for (int j = 0; j < fp->count; j++)
+        {
+            dbref targ = fp->data[j];
+            if (  Good_dbref(targ)
+               && ScanGoing(targ))
+            {
+                dbref holder;
+                memcpy(&holder, pKey, sizeof(dbref));
+                mudstate.bfDbckDirty.Set(holder);
+                mudstate.bfDbckHold.Set(targ);
+            }
+        }
+    }
+
+    dbref i;
+    DO_WHOLE_DB(i)
+    {
+        if (!ScanGoing(i))
+        {
+            continue;
+        }
+
+        static const int aIndex[] = { RX_PARENT, RX_ZONE, RX_ENTRANCE };
+        for (size_t k = 0; k < sizeof(aIndex)/sizeof(aIndex[0]); k++)
+        {
+            dbref j;
+            DO_RX(j, aIndex[k], i)
+            {
+                if (  RX_ENTRANCE == aIndex[k]
+                   && !isRoom(j)
+                   && (  !isExit(j)
+                      || ScanGoing(j)))
+                {
+                    // Homes are not checked, and exits which are GOING
+                    // are purged along with their destination.
+                    //
+                    continue;
+                }
+                mudstate.bfDbckDirty.Set(j);
+                mudstate.bfDbckHold.Set(i);
+            }
+        }
+    }
+}
+
+static void dispatch_DbckSlice(void *pUnused, int iUnused)
+{
+    UNUSED_PARAMETER(pUnused);
+    UNUSED_PARAMETER(iUnused);
+
+    const UTF8 *cmdsave = mudstate.debug_cmd;
+    mudstate.debug_cmd = T("< dbck >");
+    check_type = 0;
+
+    switch (dbck_state)
+    {
+    case DBCK_REFS:
+        {
+            int nBudget = mudconf.check_slice;
+            while (  0 < nBudget
+                  && dbck_cursor < mudstate.db_top)
+            {
+                dbref i = dbck_cursor++;
+                nBudget--;
+                if (  dbck_sweep
+                   || mudstate.bfDbckDirty.IsSet(i))
+                {
+                    mudstate.bfDbckDirty.Clear(i);
+                    check_dead_ref(i);
+                    dbck_changed = true;
+                }
+            }
+            if (mudstate.db_top <= dbck_cursor)
+            {
+                dbck_state = DBCK_VERIFY;
+            }
+        }
+        break;
+
+    case DBCK_VERIFY:
+        dbck_snapshot();
+        dbck_state = DBCK_WAIT;
+        break;
+
+    case DBCK_WAIT:
+        if (dbck_verified())
+        {
+            dbck_repair();
+            dbck_sweep = false;
+            dbck_state = DBCK_IDLE;
+        }
+        break;
+    }
+
+    mudstate.debug_cmd = cmdsave;
+    if (DBCK_IDLE != dbck_state)
+    {
+        scheduler.DeferImmediateTask(PRIORITY_SYSTEM, dispatch_DbckSlice, 0, 0);
+    }
+}
+
+/*! \brief Starts a pass of the incremental database check.
+ *
+ * The pass runs in short steps from the scheduler.  A pass which is still
+ * running is left to finish.
+ *
+ * \return  None.
+ */
+
+void dbck_start(void)
+{
+    if (DBCK_IDLE == dbck_state)
+    {
+        // Referrers of everything set GOING before now were marked then, so
+        // this pass looks at all of them.
+        //
+        mudstate.bfDbckHold.ClearAll();
+        dbck_cursor  = 0;
+        dbck_changed = false;
+        dbck_state   = DBCK_REFS;
+        scheduler.DeferImmediateTask(PRIORITY_SYSTEM, dispatch_DbckSlice, 0, 0);
+    }
+}
+
+/*
+ * ---------------------------------------------------------------------------
+ * * do_dbck: Perform a database consistency check and clean up damage.
+ */
+
+void do_dbck(dbref executor, dbref caller, dbref enactor, int eval, int key)
+{
+    UNUSED_PARAMETER(caller);
+    UNUSED_PARAMETER(enactor);
+    UNUSED_PARAMETER(eval);
+
+    // Everything is about to be checked.
+    //
+    mudstate.bfDbckDirty.ClearAll();
+
+    check_type = key;
+    check_dead_refs();
+    check_exit_chains();
+    check_contents_chains();
+    check_floating();
+    if (  !mudstate.bStandAlone
+       && executor != NOTHING)
+    {
+        Guest.CleanUp();
+    }
+    purge_going(false);
+    make_freelist();
+    dbck_maintenance();
 
     if (  !mudstate.bStandAlone
        && executor != NOTHING
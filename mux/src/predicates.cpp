@@ -1620,6 +1620,9 @@ void do_restart(dbref executor, dbref caller, dbref enactor, int eval, int key)
     exit(12345678);
 #elif defined(UNIX_PROCESSES)
 #if defined(HAVE_WORKING_FORK)
+#if defined(UNIX_NETWORKING_THREADS)
+    stop_io_threads();
+#endif // UNIX_NETWORKING_THREADS
     dump_restart_db();
     CleanUpSlaveSocket();
     CleanUpSlaveProcess();
@@ -143,7 +143,7 @@ void do_chzone
 
     // Everything is okay, do the change.
     //
-    db[thing].zone = zone;
+    s_Zone(thing, zone);
     if (!isPlayer(thing))
     {
         // If the object is a player, resetting these flags is rather
@@ -806,12 +806,12 @@ void SetClearFlags
     {
         if (NULL != aClearFlags)
         {
-            db[thing].fs.word[j] &= ~aClearFlags[j];
+            s_Flags(thing, j, db[thing].fs.word[j] & ~aClearFlags[j]);
         }
 
         if (NULL != aSetFlags)
         {
-            db[thing].fs.word[j] |= aSetFlags[j];
+            s_Flags(thing, j, db[thing].fs.word[j] | aSetFlags[j]);
         }
     }
 }
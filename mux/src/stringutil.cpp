@@ -14,6 +14,18 @@
 #include "pcre.h"
 #include "mathutil.h"
 
+#if defined(__SSE2__) || defined(_M_X64)
+#define ASCII_SPAN_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif // _MSC_VER
+#if defined(__x86_64__) && (defined(__clang__) || 4 < __GNUC__ || (4 == __GNUC__ && 8 <= __GNUC_MINOR__))
+#define ASCII_SPAN_AVX2
+#include <immintrin.h>
+#endif
+#endif // __SSE2__ || _M_X64
+
 const bool mux_isprint_ascii[256] =
 {
 //  0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F
@@ -662,6 +674,211 @@ const UTF8 *latin2_utf8[256] =
    T("\xC3\xBC"),     T("\xC3\xBD"),     T("\xC5\xA3"),     T("\xCB\x99"),
 };
 
+/*! \brief Counts the 7-bit ASCII bytes at the start of a UTF8 string.
+ *
+ * The span ends at the terminating '\0' or at the lead byte of the first
+ * multi-byte code point, which includes every color code point.  When
+ * fPrintable is set, it also ends at the first control character, since the
+ * charset conversions do not pass those through unchanged.  Most traffic is
+ * plain ASCII, so the conversion and validation routines below use this to
+ * skip ahead and only walk their state machines for the rest.
+ *
+ * The vector versions only use aligned loads, so while they may read past
+ * the terminator, they never read past the end of the page it is on.
+ *
+ * \param pString    UTF8 string.
+ * \param fPrintable Stop at control characters as well.
+ * \return           Number of leading ASCII bytes.
+ */
+
+static inline bool ascii_span_stop(UTF8 ch, bool fPrintable)
+{
+    return fPrintable ? (ch < 0x20 || 0x7F <= ch) : ('\0' == ch || 0x80 <= ch);
+}
+
+// ascii_span_scalar: The span within the first nString bytes.  The vector
+// versions use it to reach an aligned address or to finish a short tail.
+//
+static size_t ascii_span_scalar(const UTF8 *pString, size_t nString,
+    bool fPrintable)
+{
+    size_t i = 0;
+    while (  i < nString
+          && !ascii_span_stop(pString[i], fPrintable))
+    {
+        i++;
+    }
+    return i;
+}
+
+#if !defined(ASCII_SPAN_SSE2)
+static size_t ascii_span_portable(const UTF8 *pString, bool fPrintable)
+{
+    return ascii_span_scalar(pString, ~static_cast<size_t>(0), fPrintable);
+}
+#endif // ASCII_SPAN_SSE2
+
+#if defined(ASCII_SPAN_SSE2)
+static inline unsigned int ascii_span_ctz(unsigned int mask)
+{
+#if defined(_MSC_VER)
+    unsigned long i;
+    _BitScanForward(&i, mask);
+    return i;
+#else
+    return __builtin_ctz(mask);
+#endif // _MSC_VER
+}
+
+static size_t ascii_span_sse2(const UTF8 *pString, bool fPrintable)
+{
+    size_t nHead = (0 - reinterpret_cast<MUX_UINT_PTR>(pString)) & 15;
+    size_t i = ascii_span_scalar(pString, nHead, fPrintable);
+    if (i < nHead)
+    {
+        return i;
+    }
+    const UTF8 *p = pString + nHead;
+
+    // Signed compares: bytes from 0x80 up are negative.
+    //
+    const __m128i lo = _mm_set1_epi8(fPrintable ? 0x1F : 0x00);
+    const __m128i hi = _mm_set1_epi8(0x7F);
+    for (;;)
+    {
+        __m128i v = _mm_load_si128(reinterpret_cast<const __m128i *>(p));
+        __m128i ok = _mm_cmpgt_epi8(v, lo);
+        if (fPrintable)
+        {
+            ok = _mm_and_si128(ok, _mm_cmplt_epi8(v, hi));
+        }
+        unsigned int mask = ~static_cast<unsigned int>(_mm_movemask_epi8(ok)) & 0xFFFF;
+        if (0 != mask)
+        {
+            return (p - pString) + ascii_span_ctz(mask);
+        }
+        p += 16;
+    }
+}
+#endif // ASCII_SPAN_SSE2
+
+#if defined(ASCII_SPAN_AVX2)
+__attribute__((target("avx2")))
+static size_t ascii_span_avx2(const UTF8 *pString, bool fPrintable)
+{
+    size_t nHead = (0 - reinterpret_cast<MUX_UINT_PTR>(pString)) & 31;
+    size_t i = ascii_span_scalar(pString, nHead, fPrintable);
+    if (i < nHead)
+    {
+        return i;
+    }
+    const UTF8 *p = pString + nHead;
+
+    const __m256i lo = _mm256_set1_epi8(fPrintable ? 0x1F : 0x00);
+    const __m256i hi = _mm256_set1_epi8(0x7F);
+    for (;;)
+    {
+        __m256i v = _mm256_load_si256(reinterpret_cast<const __m256i *>(p));
+        __m256i ok = _mm256_cmpgt_epi8(v, lo);
+        if (fPrintable)
+        {
+            ok = _mm256_and_si256(ok, _mm256_cmpgt_epi8(hi, v));
+        }
+        unsigned int mask = ~static_cast<unsigned int>(_mm256_movemask_epi8(ok));
+        if (0 != mask)
+        {
+            return (p - pString) + ascii_span_ctz(mask);
+        }
+        p += 32;
+    }
+}
+#endif // ASCII_SPAN_AVX2
+
+// The first call picks the best version this CPU supports.
+//
+static size_t ascii_span_select(const UTF8 *pString, bool fPrintable);
+static size_t (*pfAsciiSpan)(const UTF8 *, bool) = ascii_span_select;
+
+static size_t ascii_span_select(const UTF8 *pString, bool fPrintable)
+{
+#if defined(ASCII_SPAN_AVX2)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        pfAsciiSpan = ascii_span_avx2;
+    }
+    else
+#endif // ASCII_SPAN_AVX2
+    {
+#if defined(ASCII_SPAN_SSE2)
+        pfAsciiSpan = ascii_span_sse2;
+#else
+        pfAsciiSpan = ascii_span_portable;
+#endif // ASCII_SPAN_SSE2
+    }
+    return pfAsciiSpan(pString, fPrintable);
+}
+
+size_t utf8_ascii_span(const UTF8 *pString)
+{
+    return pfAsciiSpan(pString, false);
+}
+
+size_t utf8_printable_span(const UTF8 *pString)
+{
+    return pfAsciiSpan(pString, true);
+}
+
+/*! \brief Counts the printable ASCII bytes at the start of a buffer which
+ * need not be terminated.
+ *
+ * Unlike the terminated version, this never reads past pString[nString-1],
+ * so it can be used on bytes straight from the network.
+ *
+ * \param pString   Bytes.
+ * \param nString   Number of bytes in pString.
+ * \return          Number of leading bytes from 0x20 through 0x7E.
+ */
+
+size_t utf8_printable_span(const UTF8 *pString, size_t nString)
+{
+    size_t i = 0;
+#if defined(ASCII_SPAN_SSE2)
+    const __m128i lo = _mm_set1_epi8(0x1F);
+    const __m128i hi = _mm_set1_epi8(0x7F);
+    while (i + 16 <= nString)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pString + i));
+        __m128i ok = _mm_and_si128(_mm_cmpgt_epi8(v, lo), _mm_cmplt_epi8(v, hi));
+        unsigned int mask = ~static_cast<unsigned int>(_mm_movemask_epi8(ok)) & 0xFFFF;
+        if (0 != mask)
+        {
+            return i + ascii_span_ctz(mask);
+        }
+        i += 16;
+    }
+#endif // ASCII_SPAN_SSE2
+    return i + ascii_span_scalar(pString + i, nString - i, true);
+}
+
+/*! \brief Returns the length of the leading run of ASCII bytes which a
+ * translation table maps onto themselves.
+ *
+ * \param pString   UTF8 string.
+ * \param aid       ASCII identity bitmap emitted with the table (xx_aid).
+ * \return          Number of bytes which can be copied unchanged.
+ */
+
+size_t utf8_aid_span(const UTF8 *pString, const unsigned char aid[16])
+{
+    const UTF8 *p = pString;
+    while (utf8_aid(aid, *p))
+    {
+        p++;
+    }
+    return p - pString;
+}
+
 /*! \brief Validates UTF8 string and returns number of code points contained therein.
  *
  * \param pString   UTF8 string.
@@ -672,16 +889,24 @@ const UTF8 *latin2_utf8[256] =
 bool utf8_strlen(const UTF8 *pString, size_t &nString)
 {
     nString = 0;
-    int i = 0;
+    size_t i = 0;
     while ('\0' != pString[i])
     {
+        size_t nAscii = utf8_ascii_span(pString + i);
+        if (0 < nAscii)
+        {
+            nString += nAscii;
+            i += nAscii;
+            continue;
+        }
+
         unsigned char t = utf8_FirstByte[pString[i]];
         if (UTF8_CONTINUE <= t)
         {
             return false;
         }
 
-        int j;
+        size_t j;
         for (j = i + 1; j < i + t; j++)
         {
             if (  '\0' == pString[j]
@@ -702,6 +927,14 @@ bool utf8_strlen(const UTF8 *pString, mux_cursor &nString)
     LBUF_OFFSET nBytes  = 0;
     while ('\0' != pString[nBytes])
     {
+        LBUF_OFFSET nAscii = static_cast<LBUF_OFFSET>(utf8_ascii_span(pString + nBytes));
+        if (0 < nAscii)
+        {
+            nPoints = static_cast<LBUF_OFFSET>(nPoints + nAscii);
+            nBytes  = static_cast<LBUF_OFFSET>(nBytes + nAscii);
+            continue;
+        }
+
         unsigned char t = utf8_FirstByte[pString[nBytes]];
         if (UTF8_CONTINUE <= t)
         {
@@ -747,6 +980,23 @@ const char *ConvertToAscii(const UTF8 *pString)
 
     while ('\0' != *pString)
     {
+        size_t nAscii = utf8_printable_span(pString);
+        if (0 < nAscii)
+        {
+            memcpy(q, pString, nAscii);
+            q += nAscii;
+            pString += nAscii;
+            continue;
+        }
+
+        UTF32 cp = utf8_FastPoint(pString);
+        if (cp < TR_ASCII_FAST_LIMIT)
+        {
+            *q++ = (char)tr_ascii_fast[cp];
+            pString = utf8_NextCodePoint(pString);
+            continue;
+        }
+
         const UTF8 *p = pString;
         int iState = TR_ASCII_START_STATE;
         do
@@ -811,6 +1061,28 @@ const char *ConvertToCp437(const UTF8 *pString)
     while (  '\0' != *pString
           && q < buffer + sizeof(buffer) - 1)
     {
+        size_t nAscii = utf8_printable_span(pString);
+        if (0 < nAscii)
+        {
+            size_t nAvail = buffer + sizeof(buffer) - 1 - q;
+            if (nAvail < nAscii)
+            {
+                nAscii = nAvail;
+            }
+            memcpy(q, pString, nAscii);
+            q += nAscii;
+            pString += nAscii;
+            continue;
+        }
+
+        UTF32 cp = utf8_FastPoint(pString);
+        if (cp < TR_CP437_FAST_LIMIT)
+        {
+            *q++ = (char)tr_cp437_fast[cp];
+            pString = utf8_NextCodePoint(pString);
+            continue;
+        }
+
         const UTF8 *p = pString;
         int iState = TR_CP437_START_STATE;
         do
@@ -875,6 +1147,28 @@ const char *ConvertToLatin1(const UTF8 *pString)
     while (  '\0' != *pString
           && q < buffer + sizeof(buffer) - 1)
     {
+        size_t nAscii = utf8_printable_span(pString);
+        if (0 < nAscii)
+        {
+            size_t nAvail = buffer + sizeof(buffer) - 1 - q;
+            if (nAvail < nAscii)
+            {
+                nAscii = nAvail;
+            }
+            memcpy(q, pString, nAscii);
+            q += nAscii;
+            pString += nAscii;
+            continue;
+        }
+
+        UTF32 cp = utf8_FastPoint(pString);
+        if (cp < TR_LATIN1_FAST_LIMIT)
+        {
+            *q++ = (char)tr_latin1_fast[cp];
+            pString = utf8_NextCodePoint(pString);
+            continue;
+        }
+
         const UTF8 *p = pString;
         int iState = TR_LATIN1_START_STATE;
         do
@@ -939,6 +1233,28 @@ const char *ConvertToLatin2(const UTF8 *pString)
     while (  '\0' != *pString
           && q < buffer + sizeof(buffer) - 1)
     {
+        size_t nAscii = utf8_printable_span(pString);
+        if (0 < nAscii)
+        {
+            size_t nAvail = buffer + sizeof(buffer) - 1 - q;
+            if (nAvail < nAscii)
+            {
+                nAscii = nAvail;
+            }
+            memcpy(q, pString, nAscii);
+            q += nAscii;
+            pString += nAscii;
+            continue;
+        }
+
+        UTF32 cp = utf8_FastPoint(pString);
+        if (cp < TR_LATIN2_FAST_LIMIT)
+        {
+            *q++ = (char)tr_latin2_fast[cp];
+            pString = utf8_NextCodePoint(pString);
+            continue;
+        }
+
         const UTF8 *p = pString;
         int iState = TR_LATIN2_START_STATE;
         do
@@ -2701,6 +3017,7 @@ UTF8 *convert_to_html(const UTF8 *pString)
               && COLOR_NOTCOLOR == iCode)
         {
             i += utf8_FirstByte[pString[i]];
+            i += utf8_ascii_span(pString + i);
             iCode = mux_color(pString + i);
         }
 
@@ -3007,6 +3324,7 @@ UTF8 *convert_to_html(const UTF8 *pString)
                   && COLOR_NOTCOLOR == iCode)
             {
                 i += utf8_FirstByte[pString[i]];
+                i += utf8_ascii_span(pString + i);
                 iCode = mux_color(pString + i);
             }
             size_t n = i - iCopy;
@@ -3070,6 +3388,7 @@ UTF8 *convert_color(const UTF8 *pString, bool fNoBleed, bool fColor256)
               && COLOR_NOTCOLOR == iCode)
         {
             i += utf8_FirstByte[pString[i]];
+            i += utf8_ascii_span(pString + i);
             iCode = mux_color(pString + i);
         }
 
@@ -3141,6 +3460,21 @@ UTF8 *strip_color(const UTF8 *pString, size_t *pnBytes, size_t *pnPoints)
     size_t nPoints = 0;
     while ('\0' != *pString)
     {
+        size_t nAscii = utf8_ascii_span(pString);
+        if (0 < nAscii)
+        {
+            size_t nCopy = (LBUF_SIZE-1) - (pBuffer - aBuffer);
+            if (nAscii < nCopy)
+            {
+                nCopy = nAscii;
+            }
+            memcpy(pBuffer, pString, nCopy);
+            pBuffer += nCopy;
+            pString += nAscii;
+            nPoints += nAscii;
+            continue;
+        }
+
         if (COLOR_NOTCOLOR == mux_color(pString))
         {
             utf8_safe_chr(pString, aBuffer, &pBuffer);
@@ -4859,6 +5193,20 @@ UTF8 *mux_strlwr(const UTF8 *a, size_t &n)
     n = 0;
     while ('\0' != *a)
     {
+        size_t nRun = utf8_aid_span(a, tr_tolower_aid);
+        if (LBUF_SIZE-1 - n < nRun)
+        {
+            nRun = LBUF_SIZE-1 - n;
+        }
+
+        if (0 < nRun)
+        {
+            memcpy(Buffer + n, a, nRun);
+            n += nRun;
+            a += nRun;
+            continue;
+        }
+
         size_t j;
         size_t m;
         bool bXor;
@@ -4915,6 +5263,20 @@ UTF8 *mux_strupr(const UTF8 *a, size_t &n)
     n = 0;
     while ('\0' != *a)
     {
+        size_t nRun = utf8_aid_span(a, tr_toupper_aid);
+        if (LBUF_SIZE-1 - n < nRun)
+        {
+            nRun = LBUF_SIZE-1 - n;
+        }
+
+        if (0 < nRun)
+        {
+            memcpy(Buffer + n, a, nRun);
+            n += nRun;
+            a += nRun;
+            continue;
+        }
+
         size_t j;
         size_t m;
         bool bXor;
@@ -4972,6 +5334,20 @@ UTF8 *mux_foldmatch(const UTF8 *a, size_t &n, bool &fChanged)
     fChanged = false;
     while ('\0' != *a)
     {
+        size_t nRun = utf8_aid_span(a, tr_foldmatch_aid);
+        if (LBUF_SIZE-1 - n < nRun)
+        {
+            nRun = LBUF_SIZE-1 - n;
+        }
+
+        if (0 < nRun)
+        {
+            memcpy(Buffer + n, a, nRun);
+            n += nRun;
+            a += nRun;
+            continue;
+        }
+
         size_t j;
         size_t m;
         bool bXor;
@@ -5742,6 +6118,8 @@ CF_HAND(cf_art_rule)
 mux_string::mux_string(void)
 {
     m_iLast = CursorMin;
+    m_autf = m_aInline;
+    m_nautf = sizeof(m_aInline);
     m_autf[0] = '\0';
     m_ncs = 0;
     m_pcs = NULL;
@@ -5758,6 +6136,8 @@ mux_string::mux_string(void)
 mux_string::mux_string(const mux_string &sStr)
 {
     m_iLast = CursorMin;
+    m_autf = m_aInline;
+    m_nautf = sizeof(m_aInline);
     m_autf[0] = '\0';
     m_ncs = 0;
     m_pcs = NULL;
@@ -5776,6 +6156,8 @@ mux_string::mux_string(const mux_string &sStr)
 mux_string::mux_string(const UTF8 *pStr)
 {
     m_iLast = CursorMin;
+    m_autf = m_aInline;
+    m_nautf = sizeof(m_aInline);
     m_autf[0] = '\0';
     m_ncs = 0;
     m_pcs = NULL;
@@ -5784,7 +6166,8 @@ mux_string::mux_string(const UTF8 *pStr)
 
 /*! \brief Destructs mux_string object.
  *
- * This destructor deletes the m_pcs array if necessary.
+ * This destructor deletes the m_pcs array and returns the m_autf lbuf to
+ * the pool if necessary.
  *
  * \return         None.
  */
@@ -5792,6 +6175,10 @@ mux_string::mux_string(const UTF8 *pStr)
 mux_string::~mux_string(void)
 {
     realloc_m_pcs(0);
+    if (m_aInline != m_autf)
+    {
+        free_lbuf(m_autf);
+    }
 }
 
 /*! \brief Self-checks mux_string to validate the invariant.
@@ -5841,7 +6228,7 @@ void mux_string::Validate(void) const
     size_t npoints = 0;
 
     const UTF8 *p = m_autf;
-    while (  p < (m_autf + LBUF_SIZE)
+    while (  p < (m_autf + m_nautf)
           && '\0' != *p)
     {
         // Each code point must be valid encoding.
@@ -5939,6 +6326,7 @@ void mux_string::append(const mux_string &sStr, mux_cursor iStart, mux_cursor iE
         realloc_m_pcs(m_iLast.m_point + nPoints);
     }
 
+    realloc_m_autf(m_iLast.m_byte + nBytes);
     memcpy(m_autf + m_iLast.m_byte, sStr.m_autf + iStart.m_byte, nBytes);
 
     if (0 != sStr.m_ncs)
@@ -6031,7 +6419,9 @@ void mux_string::append_TextPlain(const UTF8 *pStr)
         nLen = (LBUF_SIZE-1) - m_iLast.m_byte;
     }
 
+    realloc_m_autf(m_iLast.m_byte + nLen);
     memcpy(m_autf + m_iLast.m_byte, pStr, nLen * sizeof(m_autf[0]));
+    m_autf[m_iLast.m_byte + nLen] = '\0';
 
     mux_cursor i = m_iLast, j = i;
     while (  cursor_next(i)
@@ -6081,7 +6471,9 @@ void mux_string::append_TextPlain(const UTF8 *pStr, size_t nLen)
         }
     }
 
+    realloc_m_autf(m_iLast.m_byte + nLen);
     memcpy(m_autf + m_iLast.m_byte, pStr, nLen * sizeof(m_autf[0]));
+    m_autf[m_iLast.m_byte + nLen] = '\0';
 
     mux_cursor i = m_iLast, j = i;
     while (  cursor_next(i)
@@ -7195,6 +7587,7 @@ void mux_string::import(const mux_string &sStr, mux_cursor iStart)
     else
     {
         m_iLast = sStr.m_iLast - iStart;
+        realloc_m_autf(m_iLast.m_byte);
         memcpy(m_autf, sStr.m_autf + iStart.m_byte, m_iLast.m_byte);
         m_autf[m_iLast.m_byte] = '\0';
 
@@ -7265,6 +7658,10 @@ void mux_string::import(const UTF8 *pStr, size_t nLen)
     static ColorState acsTemp[LBUF_SIZE];
     ColorState cs = CS_NORMAL;
 
+    // Color is removed, so the result is never longer than nLen.
+    //
+    realloc_m_autf(nLen);
+
     LBUF_OFFSET iPoint = 0;
     size_t iStr = 0;
     UTF8 *pch = m_autf;
@@ -7355,6 +7752,29 @@ void mux_string::prepend(const UTF8 *pStr, size_t n)
     delete sStore;
 }
 
+/*! \brief Moves m_autf from m_aInline to a pooled lbuf if necessary.
+ *
+ * When this method returns, m_autf has room for nutf bytes plus the
+ * terminating '\0'.  The current contents are preserved.  An lbuf is
+ * already as large as a mux_string is allowed to become, so the string
+ * never needs to move a second time.
+ *
+ * \param nutf     Number of bytes required, not counting the '\0'.
+ * \return         None.
+ */
+
+void mux_string::realloc_m_autf(size_t nutf)
+{
+    if (m_nautf <= nutf)
+    {
+        mux_assert(nutf < LBUF_SIZE);
+        UTF8 *p = alloc_lbuf("mux_string");
+        memcpy(p, m_autf, m_nautf);
+        m_autf = p;
+        m_nautf = LBUF_SIZE;
+    }
+}
+
 /*! \brief Resizes or deletes the m_pcs array if necessary.
  *
  * If asked to resize the array to 0, this method will delete the
@@ -7465,6 +7885,7 @@ void mux_string::replace_Chars
         }
 
         mux_cursor iLast = iStart + nCopy + nMove;
+        realloc_m_autf(iLast.m_byte);
 
         // Move text if necessary.
         //
@@ -7531,18 +7952,23 @@ bool mux_string::replace_Point(const UTF8 *p, const mux_cursor &i)
 
     if (n != m)
     {
-        if (  m < n
-           && sizeof(m_autf) <= m_iLast.m_byte + m - n)
+        if (  n < m
+           && LBUF_SIZE <= m_iLast.m_byte + m - n)
         {
             // We need to truncate the trailing point to make room for an expansion.
             //
             do
             {
                 cursor_prev(m_iLast);
-            } while (sizeof(m_autf) <= m_iLast.m_byte + m - n);
+            } while (LBUF_SIZE <= m_iLast.m_byte + m - n);
             m_autf[m_iLast.m_byte] = '\0';
         }
 
+        if (n < m)
+        {
+            realloc_m_autf(m_iLast.m_byte + m - n);
+        }
+
         if (i.m_byte + n  < m_iLast.m_byte)
         {
             size_t nBytesMove = m_iLast.m_byte - (i.m_byte + n);
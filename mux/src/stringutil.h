@@ -112,10 +112,39 @@ inline size_t TrimPartialSequence(size_t n, __in_ecount(n) const UTF8 *p)
 
 #define utf8_NextCodePoint(x)      (x + utf8_FirstByte[(unsigned char)*x])
 
+// Returns the code point of a one- or two-byte sequence or UNI_EOF for
+// anything longer or ill-formed.  Code points below the xx_FAST_LIMIT of a
+// table can be looked up directly in its xx_fast[] array, and the xx_aid[]
+// bitmaps flag the ASCII bytes a table maps onto themselves.
+//
+inline UTF32 utf8_FastPoint(__in const unsigned char *p)
+{
+    if (p[0] < 0x80)
+    {
+        return p[0];
+    }
+    else if (  0xC2 <= p[0]
+            && p[0] <= 0xDF
+            && 0x80 == (p[1] & 0xC0))
+    {
+        return ((p[0] & 0x1F) << 6) | (p[1] & 0x3F);
+    }
+    return UNI_EOF;
+}
+
+#define utf8_aid(t,ch) (  (unsigned char)(ch) < 0x80 \
+                        && 0 != ((t)[(unsigned char)(ch) >> 3] & (1 << ((unsigned char)(ch) & 7))))
+
 // utf/cl_Printable.txt
 //
 inline bool mux_isprint(__in const unsigned char *p)
 {
+    UTF32 cp = utf8_FastPoint(p);
+    if (cp < CL_PRINT_FAST_LIMIT)
+    {
+        return (1 == cl_print_fast[cp]);
+    }
+
     unsigned char iState = CL_PRINT_START_STATE;
     do
     {
@@ -165,6 +194,12 @@ inline bool mux_isprint(__in const unsigned char *p)
 //
 inline bool mux_isattrnameinitial(__in const unsigned char *p)
 {
+    UTF32 cp = utf8_FastPoint(p);
+    if (cp < CL_ATTRNAMEINITIAL_FAST_LIMIT)
+    {
+        return (1 == cl_attrnameinitial_fast[cp]);
+    }
+
     unsigned char iState = CL_ATTRNAMEINITIAL_START_STATE;
     do
     {
@@ -214,6 +249,12 @@ inline bool mux_isattrnameinitial(__in const unsigned char *p)
 //
 inline bool mux_isattrname(__in const unsigned char *p)
 {
+    UTF32 cp = utf8_FastPoint(p);
+    if (cp < CL_ATTRNAME_FAST_LIMIT)
+    {
+        return (1 == cl_attrname_fast[cp]);
+    }
+
     unsigned char iState = CL_ATTRNAME_START_STATE;
     do
     {
@@ -263,6 +304,12 @@ inline bool mux_isattrname(__in const unsigned char *p)
 //
 inline bool mux_isobjectname(__in const unsigned char *p)
 {
+    UTF32 cp = utf8_FastPoint(p);
+    if (cp < CL_OBJECTNAME_FAST_LIMIT)
+    {
+        return (1 == cl_objectname_fast[cp]);
+    }
+
     unsigned char iState = CL_OBJECTNAME_START_STATE;
     do
     {
@@ -312,6 +359,12 @@ inline bool mux_isobjectname(__in const unsigned char *p)
 //
 inline bool mux_isplayername(__in const unsigned char *p)
 {
+    UTF32 cp = utf8_FastPoint(p);
+    if (cp < CL_PLAYERNAME_FAST_LIMIT)
+    {
+        return (1 == cl_playername_fast[cp]);
+    }
+
     unsigned char iState = CL_PLAYERNAME_START_STATE;
     do
     {
@@ -361,6 +414,12 @@ inline bool mux_isplayername(__in const unsigned char *p)
 //
 inline bool mux_is8859_1(__in const unsigned char *p)
 {
+    UTF32 cp = utf8_FastPoint(p);
+    if (cp < CL_8859_1_FAST_LIMIT)
+    {
+        return (1 == cl_8859_1_fast[cp]);
+    }
+
     unsigned char iState = CL_8859_1_START_STATE;
     do
     {
@@ -410,6 +469,12 @@ inline bool mux_is8859_1(__in const unsigned char *p)
 //
 inline bool mux_is8859_2(__in const unsigned char *p)
 {
+    UTF32 cp = utf8_FastPoint(p);
+    if (cp < CL_8859_2_FAST_LIMIT)
+    {
+        return (1 == cl_8859_2_fast[cp]);
+    }
+
     unsigned char iState = CL_8859_2_START_STATE;
     do
     {
@@ -475,6 +540,19 @@ const char *ConvertToLatin2(__in const UTF8 *pString);
 //
 inline const string_desc *mux_tolower(__in const unsigned char *p, bool &bXor)
 {
+    UTF32 cp = utf8_FastPoint(p);
+    if (cp < TR_TOLOWER_FAST_LIMIT)
+    {
+        int iValue = tr_tolower_fast[cp];
+        if (TR_TOLOWER_DEFAULT == iValue)
+        {
+            bXor = false;
+            return NULL;
+        }
+        bXor = (TR_TOLOWER_XOR_START <= iValue);
+        return tr_tolower_ott + iValue - 1;
+    }
+
     unsigned char iState = TR_TOLOWER_START_STATE;
     do
     {
@@ -534,6 +612,19 @@ inline const string_desc *mux_tolower(__in const unsigned char *p, bool &bXor)
 //
 inline const string_desc *mux_toupper(__in const unsigned char *p, bool &bXor)
 {
+    UTF32 cp = utf8_FastPoint(p);
+    if (cp < TR_TOUPPER_FAST_LIMIT)
+    {
+        int iValue = tr_toupper_fast[cp];
+        if (TR_TOUPPER_DEFAULT == iValue)
+        {
+            bXor = false;
+            return NULL;
+        }
+        bXor = (TR_TOUPPER_XOR_START <= iValue);
+        return tr_toupper_ott + iValue - 1;
+    }
+
     unsigned char iState = TR_TOUPPER_START_STATE;
     do
     {
@@ -593,6 +684,19 @@ inline const string_desc *mux_toupper(__in const unsigned char *p, bool &bXor)
 //
 inline const string_desc *mux_totitle(__in const unsigned char *p, bool &bXor)
 {
+    UTF32 cp = utf8_FastPoint(p);
+    if (cp < TR_TOTITLE_FAST_LIMIT)
+    {
+        int iValue = tr_totitle_fast[cp];
+        if (TR_TOTITLE_DEFAULT == iValue)
+        {
+            bXor = false;
+            return NULL;
+        }
+        bXor = (TR_TOTITLE_XOR_START <= iValue);
+        return tr_totitle_ott + iValue - 1;
+    }
+
     unsigned char iState = TR_TOTITLE_START_STATE;
     do
     {
@@ -652,6 +756,19 @@ inline const string_desc *mux_totitle(__in const unsigned char *p, bool &bXor)
 //
 inline const string_desc *mux_foldmatch(__in const unsigned char *p, bool &bXor)
 {
+    UTF32 cp = utf8_FastPoint(p);
+    if (cp < TR_FOLDMATCH_FAST_LIMIT)
+    {
+        int iValue = tr_foldmatch_fast[cp];
+        if (TR_FOLDMATCH_DEFAULT == iValue)
+        {
+            bXor = false;
+            return NULL;
+        }
+        bXor = (TR_FOLDMATCH_XOR_START <= iValue);
+        return tr_foldmatch_ott + iValue - 1;
+    }
+
     int iState = TR_FOLDMATCH_START_STATE;
     do
     {
@@ -711,6 +828,12 @@ inline const string_desc *mux_foldmatch(__in const unsigned char *p, bool &bXor)
 //
 inline int mux_color(__in const unsigned char *p)
 {
+    UTF32 cp = utf8_FastPoint(p);
+    if (cp < TR_COLOR_FAST_LIMIT)
+    {
+        return tr_color_fast[cp];
+    }
+
     unsigned short iState = TR_COLOR_START_STATE;
     do
     {
@@ -759,6 +882,10 @@ inline int mux_color(__in const unsigned char *p)
 #define mux_haswidth(x) mux_isprint(x)
 
 bool utf8_strlen(__in const UTF8 *pString, __out size_t &nString);
+size_t utf8_ascii_span(__in const UTF8 *pString);
+size_t utf8_printable_span(__in const UTF8 *pString);
+size_t utf8_printable_span(__in_ecount(nString) const UTF8 *pString, size_t nString);
+size_t utf8_aid_span(__in const UTF8 *pString, __in const unsigned char aid[16]);
 
 typedef struct
 {
@@ -1677,6 +1804,8 @@ static const mux_cursor CursorMax(LBUF_SIZE - 1, LBUF_SIZE - 1);
 
 static const mux_cursor curAscii(1, 1);
 
+#define MUX_STRING_INLINE 256
+
 class mux_string
 {
     // m_nutf, m_ncs, m_autf, m_ncs, and m_pcs work together as follows:
@@ -1708,13 +1837,25 @@ class mux_string
     // To recap, m_nutf has units of bytes while m_ncp and m_ncs are in units
     // of code points.
     //
+    // m_autf points either to m_aInline[] or to an lbuf taken from the pool
+    // once the string outgrows MUX_STRING_INLINE bytes.  m_nautf is the size
+    // of whichever buffer is in use.  Most strings are short, so this keeps
+    // a mux_string small without changing the LBUF_SIZE-1 limit on length.
+    //
 private:
     mux_cursor  m_iLast;
-    UTF8        m_autf[LBUF_SIZE];
+    UTF8       *m_autf;
+    size_t      m_nautf;
     size_t      m_ncs;
     ColorState *m_pcs;
+    UTF8        m_aInline[MUX_STRING_INLINE];
+    void realloc_m_autf(size_t nutf);
     void realloc_m_pcs(size_t ncs);
 
+    // Not implemented.  The buffers are owned by the object.
+    //
+    mux_string &operator =(const mux_string &sStr);
+
 public:
     mux_string(void);
     mux_string(const mux_string &sStr);
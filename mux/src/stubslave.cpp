@@ -28,29 +28,86 @@ bool bStubSlaveShutdown = false;
 extern "C" MUX_RESULT DCL_API Stub_PipePump(void)
 {
     static UINT8 arg[QUEUE_BLOCK_SIZE];
-    size_t nWanted = sizeof(arg);
-    while (  Pipe_GetBytes(&Queue_Out, &nWanted, arg)
-          && 0 < nWanted)
+    int fdRing = Pipe_GetRingHandle();
+    if (0 <= fdRing)
     {
-        if (write(1, arg, nWanted) < 0)
+        Pipe_WriteRing(&Queue_Out);
+    }
+    else
+    {
+        size_t nWanted = sizeof(arg);
+        while (  Pipe_GetBytes(&Queue_Out, &nWanted, arg)
+              && 0 < nWanted)
         {
-            return MUX_E_FAIL;
+            if (write(1, arg, nWanted) < 0)
+            {
+                return MUX_E_FAIL;
+            }
+            nWanted = sizeof(arg);
         }
-        nWanted = sizeof(arg);
     }
 
     // If we are shutting down, don't wait for any more input from the pipe.
     //
     if (!bStubSlaveShutdown)
     {
-        int len = read(0, arg, sizeof(arg));
-        if (0 < len)
+        // Modules which do work on their own threads wake us through the
+        // completion handle, so wait on it as well as the pipe.  With rings,
+        // netmux signals the ring handle instead of writing to the pipe, but
+        // the pipe is still read so that we learn when netmux has gone away.
+        //
+        int fdCompletion = Pipe_GetCompletionHandle();
+
+        fd_set input_set;
+        FD_ZERO(&input_set);
+        FD_SET(0, &input_set);
+        int maxfd = 1;
+        if (0 <= fdRing)
+        {
+            FD_SET(fdRing, &input_set);
+            maxfd = fdRing + 1;
+        }
+        if (0 <= fdCompletion)
+        {
+            FD_SET(fdCompletion, &input_set);
+            if (maxfd <= fdCompletion)
+            {
+                maxfd = fdCompletion + 1;
+            }
+        }
+
+        int found = select(maxfd, &input_set, NULL, NULL, NULL);
+        if (found < 0)
+        {
+            return (EINTR == errno) ? MUX_S_OK : MUX_E_FAIL;
+        }
+
+        if (  0 <= fdCompletion
+           && FD_ISSET(fdCompletion, &input_set))
+        {
+            Pipe_RunCompletions();
+        }
+
+        if (  0 <= fdRing
+           && FD_ISSET(fdRing, &input_set))
         {
-            Pipe_AppendBytes(&Queue_In, len, arg);
+            Pipe_ReadRing(&Queue_In);
         }
-        else if (len < 0)
+
+        if (FD_ISSET(0, &input_set))
         {
-            return MUX_E_FAIL;
+            int len = read(0, arg, sizeof(arg));
+            if (0 < len)
+            {
+                Pipe_AppendBytes(&Queue_In, len, arg);
+            }
+            else
+            {
+                // netmux never writes an empty packet, so zero is
+                // end-of-file.
+                //
+                return MUX_E_FAIL;
+            }
         }
     }
     return MUX_S_OK;
@@ -103,6 +160,19 @@ int main(int argc, char *argv[])
     Pipe_InitializeQueueInfo(&Queue_In);
     Pipe_InitializeQueueInfo(&Queue_Out);
 
+    // netmux passes the shared-memory and eventfd descriptors for the rings
+    // when it was able to create them.  Otherwise, everything travels over
+    // the pipe.
+    //
+    if (2 <= argc)
+    {
+        int fdShared, fdWake, fdWakePeer;
+        if (3 == sscanf(argv[1], "%d,%d,%d", &fdShared, &fdWake, &fdWakePeer))
+        {
+            Pipe_AttachRing(fdShared, fdWake, fdWakePeer);
+        }
+    }
+
     MUX_RESULT mr = MUX_S_OK;
     mr = mux_InitModuleLibrary(IsSlaveProcess, Stub_PipePump, &Queue_In, &Queue_Out);
     if (MUX_SUCCEEDED(mr))
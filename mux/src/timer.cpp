@@ -29,7 +29,14 @@ void dispatch_FreeListReconstruction(void *pUnused, int iUnused)
     {
         const UTF8 *cmdsave = mudstate.debug_cmd;
         mudstate.debug_cmd = T("< dbck >");
-        do_dbck(NOTHING, NOTHING, NOTHING, 0, 0);
+        if (0 < mudconf.check_slice)
+        {
+            dbck_start();
+        }
+        else
+        {
+            do_dbck(NOTHING, NOTHING, NOTHING, 0, 0);
+        }
         Guest.CleanUp();
         pcache_trim();
         pool_reset();
@@ -373,6 +380,19 @@ bool CTaskHeap::Grow(void)
     return true;
 }
 
+int CTaskHeap::Count(int iPriority)
+{
+    int n = 0;
+    for (int i = 0; i < m_nCurrent; i++)
+    {
+        if (m_pHeap[i]->iPriority == iPriority)
+        {
+            n++;
+        }
+    }
+    return n;
+}
+
 void CTaskHeap::Shrink(void)
 {
     // Shrink the heap.
@@ -817,3 +837,12 @@ void CScheduler::Shrink(void)
     m_WhenHeap.Shrink();
     m_PriorityHeap.Shrink();
 }
+
+// Tasks in the priority heap are ready to run.  Those in the when heap are
+// waiting for their time to come.
+//
+void CScheduler::CountTasks(int iPriority, int *pnReady, int *pnWaiting)
+{
+    *pnReady = m_PriorityHeap.Count(iPriority);
+    *pnWaiting = m_WhenHeap.Count(iPriority);
+}
@@ -263,6 +263,144 @@ const unsigned char cl_print_sbt[3263] =
      215,   6, 215,   3,   2, 255, 214,  85,  215,   2, 215,  48, 216,  45, 215
 };
 
+const unsigned char cl_print_fast[2048] =
+{
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   0,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   1,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       1,   1,   1,   1,   1,   1,   1,   1,    0,   0,   1,   1,   1,   1,   1,   0,
+       0,   0,   0,   0,   1,   1,   1,   1,    1,   1,   1,   0,   1,   0,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   0,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   0,   0,   0,   0,   0,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   0,    0,   1,   1,   1,   1,   1,   1,   1,
+       0,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    0,   1,   1,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   1,   0,
+       1,   0,   0,   1,   0,   0,   1,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   0,   0,   0,   0,   0,
+       1,   1,   1,   1,   1,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   1,   0,   0,   1,   1,
+       0,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       0,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   0,   0,    0,   0,   0,   0,   0,   0,   1,   0,
+       0,   0,   0,   0,   0,   1,   1,   0,    0,   1,   0,   0,   0,   0,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   0,   0,
+       1,   0,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   1,   1,   1,   1,    1,   1,   1,   0,   0,   0,   0,   0
+};
+
+const unsigned char cl_print_aid[16] =
+{
+     0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F
+};
+
 // utf/cl_AttrNameInitial.txt
 //
 // 177 included, 1113935 excluded, 0 errors.
@@ -303,6 +441,144 @@ const unsigned char cl_attrnameinitial_sbt[50] =
        7,   6
 };
 
+const unsigned char cl_attrnameinitial_fast[2048] =
+{
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   1,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   1,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   0,   0,   0,   0,   1,
+       0,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   0,   0,   0,   1,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   1,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   1,   0,   0,    0,   0,   1,   0,   0,   0,   0,   0,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   0,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   0,    1,   1,   1,   1,   1,   1,   1,   1,
+       0,   0,   1,   1,   1,   1,   1,   1,    0,   0,   0,   0,   1,   1,   1,   1,
+       1,   1,   0,   0,   0,   0,   0,   0,    1,   1,   1,   1,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   1,   1,   0,   0,   1,   1,   0,
+       0,   1,   1,   1,   1,   0,   0,   1,    1,   0,   0,   0,   0,   0,   0,   0,
+       1,   1,   1,   1,   1,   1,   0,   0,    1,   1,   1,   1,   0,   0,   1,   1,
+       1,   1,   1,   1,   1,   1,   0,   0,    0,   0,   0,   0,   0,   0,   1,   1,
+       1,   1,   0,   0,   0,   0,   0,   0,    1,   1,   1,   1,   1,   1,   1,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   1,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0
+};
+
+const unsigned char cl_attrnameinitial_aid[16] =
+{
+     0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x00, 0x00,
+     0xFE, 0xFF, 0xFF, 0x87, 0xFE, 0xFF, 0xFF, 0x47
+};
+
 // utf/cl_AttrName.txt
 //
 // 203 included, 1113909 excluded, 0 errors.
@@ -343,123 +619,675 @@ const unsigned char cl_attrname_sbt[50] =
        7,   6
 };
 
-// utf/cl_ObjectName.txt
-//
-// 257 included, 1113855 excluded, 0 errors.
-// 8 states, 23 columns, 343 bytes
-//
-const unsigned char cl_objectname_itt[256] =
+const unsigned char cl_attrname_fast[2048] =
 {
        0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
        0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
-       1,   1,   1,   1,   1,   1,   0,   1,    1,   1,   1,   1,   1,   1,   1,   1,
-       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   0,   1,   1,
+       0,   1,   0,   1,   1,   0,   1,   1,    1,   1,   0,   1,   0,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   0,   0,   1,   1,   1,   1,
        1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   0,   0,   0,   1,   1,
        1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   0,   0,   0,   1,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   1,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   1,   0,   0,    0,   0,   1,   0,   0,   0,   0,   0,
        1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
-       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   0,   1,   1,   0,
-
-       2,   3,   4,   4,   4,   5,   5,   4,    3,   6,   6,   6,   5,   5,   5,   5,
-       4,   4,   7,   8,   8,   3,   6,   6,    9,   9,   9,   4,  10,  10,   8,   3,
-       8,  11,  11,  12,  12,  12,  13,  14,   14,  14,  14,  14,  14,  14,  12,  12,
-      11,  12,  14,  14,  14,  14,  14,  14,   12,  15,  16,  12,  12,  16,  16,  14,
+       1,   1,   1,   1,   1,   1,   1,   0,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   0,    1,   1,   1,   1,   1,   1,   1,   1,
+       0,   0,   1,   1,   1,   1,   1,   1,    0,   0,   0,   0,   1,   1,   1,   1,
+       1,   1,   0,   0,   0,   0,   0,   0,    1,   1,   1,   1,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   1,   1,   0,   0,   1,   1,   0,
+       0,   1,   1,   1,   1,   0,   0,   1,    1,   0,   0,   0,   0,   0,   0,   0,
+       1,   1,   1,   1,   1,   1,   0,   0,    1,   1,   1,   1,   0,   0,   1,   1,
+       1,   1,   1,   1,   1,   1,   0,   0,    0,   0,   0,   0,   0,   0,   1,   1,
+       1,   1,   0,   0,   0,   0,   0,   0,    1,   1,   1,   1,   1,   1,   1,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   1,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0
+};
+
+const unsigned char cl_attrname_aid[16] =
+{
+     0x00, 0x00, 0x00, 0x00, 0xDA, 0xEB, 0xFF, 0xF3,
+     0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x47
+};
+
+// utf/cl_ObjectName.txt
+//
+// 257 included, 1113855 excluded, 0 errors.
+// 8 states, 23 columns, 343 bytes
+//
+const unsigned char cl_objectname_itt[256] =
+{
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       1,   1,   1,   1,   1,   1,   0,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   0,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   0,   1,   1,   0,
+
+       2,   3,   4,   4,   4,   5,   5,   4,    3,   6,   6,   6,   5,   5,   5,   5,
+       4,   4,   7,   8,   8,   3,   6,   6,    9,   9,   9,   4,  10,  10,   8,   3,
+       8,  11,  11,  12,  12,  12,  13,  14,   14,  14,  14,  14,  14,  14,  12,  12,
+      11,  12,  14,  14,  14,  14,  14,  14,   12,  15,  16,  12,  12,  16,  16,  14,
        0,   0,  17,  18,  19,  20,  21,   0,    0,   0,   0,   0,   0,   0,   0,   0,
        0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
-       0,   0,  22,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
-       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0
-
-};
-
-const unsigned char cl_objectname_sot[8] =
-{
-        0,   12,   18,   24,   38,   56,   62,   68
-};
-
-const unsigned char cl_objectname_sbt[79] =
-{
-     254,   8,   9,  15,   8, 250,   1,   2,    3,   4,   5,   6,  11,   8,   6,   9,
-       6,   8,   2,   8,  15,   9,   6,   8,    4,   8,   2,   9,   3,   8, 255,   9,
-       5,   8,   2,   9,   6,   8,   3,   8,    2,   9,   2,   8,   3,   9, 255,   8,
-       2,   9,   2,   8,   2,   9,   6,   8,    7,   8, 255,   9,  15,   8,   2,   8,
-     255,   7,  20,   8,   8,   8,   4,   9,  252,   8,   9,   8,   9,   7,   8
-};
-
-// utf/cl_PlayerName.txt
-//
-// 190 included, 1113922 excluded, 0 errors.
-// 6 states, 14 columns, 312 bytes
-//
-const unsigned char cl_playername_itt[256] =
-{
+       0,   0,  22,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0
+
+};
+
+const unsigned char cl_objectname_sot[8] =
+{
+        0,   12,   18,   24,   38,   56,   62,   68
+};
+
+const unsigned char cl_objectname_sbt[79] =
+{
+     254,   8,   9,  15,   8, 250,   1,   2,    3,   4,   5,   6,  11,   8,   6,   9,
+       6,   8,   2,   8,  15,   9,   6,   8,    4,   8,   2,   9,   3,   8, 255,   9,
+       5,   8,   2,   9,   6,   8,   3,   8,    2,   9,   2,   8,   3,   9, 255,   8,
+       2,   9,   2,   8,   2,   9,   6,   8,    7,   8, 255,   9,  15,   8,   2,   8,
+     255,   7,  20,   8,   8,   8,   4,   9,  252,   8,   9,   8,   9,   7,   8
+};
+
+const unsigned char cl_objectname_fast[2048] =
+{
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       1,   1,   1,   1,   1,   1,   0,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   0,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   0,   1,   1,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       0,   0,   1,   1,   1,   1,   1,   1,    0,   0,   0,   0,   1,   1,   1,   1,
+       1,   1,   0,   0,   0,   0,   0,   0,    1,   1,   1,   1,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   1,   1,   0,   0,   1,   1,   0,
+       0,   1,   1,   1,   1,   0,   0,   1,    1,   0,   0,   0,   0,   0,   0,   0,
+       1,   1,   1,   1,   1,   1,   0,   0,    1,   1,   1,   1,   0,   0,   1,   1,
+       1,   1,   1,   1,   1,   1,   0,   0,    0,   0,   0,   0,   0,   0,   1,   1,
+       1,   1,   0,   0,   0,   0,   0,   0,    1,   1,   1,   1,   1,   1,   1,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   1,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0
+};
+
+const unsigned char cl_objectname_aid[16] =
+{
+     0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xDF,
+     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F
+};
+
+// utf/cl_PlayerName.txt
+//
+// 190 included, 1113922 excluded, 0 errors.
+// 6 states, 14 columns, 312 bytes
+//
+const unsigned char cl_playername_itt[256] =
+{
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   1,   0,   0,   1,    0,   0,   0,   0,   1,   1,   1,   0,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   0,   0,   0,   0,   0,   0,
+       0,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   0,   0,   0,   0,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   0,   0,   0,   0,   0,
+
+       2,   3,   4,   4,   4,   5,   5,   4,    3,   2,   2,   2,   5,   5,   5,   5,
+       4,   4,   6,   3,   3,   3,   2,   0,    4,   4,   4,   4,   2,   2,   3,   3,
+       3,   3,   3,   3,   3,   3,   2,   2,    2,   2,   7,   2,   2,   2,   3,   3,
+       3,   3,   2,   2,   2,   7,   2,   0,    3,   4,   8,   3,   3,   4,   4,   2,
+       0,   0,   9,  10,  11,  12,  13,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0
+
+};
+
+const unsigned char cl_playername_sot[6] =
+{
+        0,   11,   17,   23,   33,   44
+};
+
+const unsigned char cl_playername_sbt[50] =
+{
+     254,   6,   7,   7,   6, 251,   1,   2,    3,   4,   5,   7,   6,   2,   7,   5,
+       6,   2,   6,   7,   7,   5,   6,   4,    6,   2,   7,   2,   6, 255,   7,   5,
+       6,   3,   6,   2,   7, 252,   6,   7,    6,   7,   5,   6,   6,   6, 255,   7,
+       7,   6
+};
+
+const unsigned char cl_playername_fast[2048] =
+{
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   1,   0,   0,   1,    0,   0,   0,   0,   1,   1,   1,   0,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   0,   0,   0,   0,   0,   0,
+       0,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   0,   0,   0,   0,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   1,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   1,   0,   0,    0,   0,   1,   0,   0,   0,   0,   0,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   0,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   0,    1,   1,   1,   1,   1,   1,   1,   1,
+       0,   0,   1,   1,   1,   1,   1,   1,    0,   0,   0,   0,   1,   1,   1,   1,
+       1,   1,   0,   0,   0,   0,   0,   0,    1,   1,   1,   1,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   1,   1,   0,   0,   1,   1,   0,
+       0,   1,   1,   1,   1,   0,   0,   1,    1,   0,   0,   0,   0,   0,   0,   0,
+       1,   1,   1,   1,   1,   1,   0,   0,    1,   1,   1,   1,   0,   0,   1,   1,
+       1,   1,   1,   1,   1,   1,   0,   0,    0,   0,   0,   0,   0,   0,   1,   1,
+       1,   1,   0,   0,   0,   0,   0,   0,    1,   1,   1,   1,   1,   1,   1,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   1,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0
+};
+
+const unsigned char cl_playername_aid[16] =
+{
+     0x00, 0x00, 0x00, 0x00, 0x90, 0x70, 0xFF, 0x03,
+     0xFE, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x07
+};
+
+// utf/cl_8859_1.txt
+//
+// 191 included, 1113921 excluded, 0 errors.
+// 3 states, 6 columns, 279 bytes
+//
+const unsigned char cl_8859_1_itt[256] =
+{
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   0,
+
+       2,   2,   2,   2,   2,   2,   2,   2,    2,   2,   2,   2,   2,   2,   2,   2,
+       2,   2,   2,   2,   2,   2,   2,   2,    2,   2,   2,   2,   2,   2,   2,   2,
+       3,   3,   3,   3,   3,   3,   3,   3,    3,   3,   3,   3,   3,   3,   3,   3,
+       3,   3,   3,   3,   3,   3,   3,   3,    3,   3,   3,   3,   3,   3,   3,   3,
+       0,   0,   4,   5,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0
+
+};
+
+const unsigned char cl_8859_1_sot[3] =
+{
+        0,    8,   14
+};
+
+const unsigned char cl_8859_1_sbt[20] =
+{
+     254,   3,   4,   2,   3, 254,   1,   2,    3,   3, 255,   4,   2,   3,   2,   3,
+       2,   4,   2,   3
+};
+
+const unsigned char cl_8859_1_fast[2048] =
+{
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
        0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
        0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
-       0,   0,   0,   0,   1,   0,   0,   1,    0,   0,   0,   0,   1,   1,   1,   0,
-       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   0,   0,   0,   0,   0,   0,
-       0,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
-       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   0,   0,   0,   0,   1,
-       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
-       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   0,   0,   0,   0,   0,
-
-       2,   3,   4,   4,   4,   5,   5,   4,    3,   2,   2,   2,   5,   5,   5,   5,
-       4,   4,   6,   3,   3,   3,   2,   0,    4,   4,   4,   4,   2,   2,   3,   3,
-       3,   3,   3,   3,   3,   3,   2,   2,    2,   2,   7,   2,   2,   2,   3,   3,
-       3,   3,   2,   2,   2,   7,   2,   0,    3,   4,   8,   3,   3,   4,   4,   2,
-       0,   0,   9,  10,  11,  12,  13,   0,    0,   0,   0,   0,   0,   0,   0,   0,
        0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
        0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
-       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0
-
-};
-
-const unsigned char cl_playername_sot[6] =
-{
-        0,   11,   17,   23,   33,   44
-};
-
-const unsigned char cl_playername_sbt[50] =
-{
-     254,   6,   7,   7,   6, 251,   1,   2,    3,   4,   5,   7,   6,   2,   7,   5,
-       6,   2,   6,   7,   7,   5,   6,   4,    6,   2,   7,   2,   6, 255,   7,   5,
-       6,   3,   6,   2,   7, 252,   6,   7,    6,   7,   5,   6,   6,   6, 255,   7,
-       7,   6
-};
-
-// utf/cl_8859_1.txt
-//
-// 191 included, 1113921 excluded, 0 errors.
-// 3 states, 6 columns, 279 bytes
-//
-const unsigned char cl_8859_1_itt[256] =
-{
        0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
        0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
-       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
-       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
-       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
-       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
-       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
-       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   0,
-
-       2,   2,   2,   2,   2,   2,   2,   2,    2,   2,   2,   2,   2,   2,   2,   2,
-       2,   2,   2,   2,   2,   2,   2,   2,    2,   2,   2,   2,   2,   2,   2,   2,
-       3,   3,   3,   3,   3,   3,   3,   3,    3,   3,   3,   3,   3,   3,   3,   3,
-       3,   3,   3,   3,   3,   3,   3,   3,    3,   3,   3,   3,   3,   3,   3,   3,
-       0,   0,   4,   5,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
        0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
        0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
        0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0
-
-};
-
-const unsigned char cl_8859_1_sot[3] =
-{
-        0,    8,   14
 };
 
-const unsigned char cl_8859_1_sbt[20] =
+const unsigned char cl_8859_1_aid[16] =
 {
-     254,   3,   4,   2,   3, 254,   1,   2,    3,   3, 255,   4,   2,   3,   2,   3,
-       2,   4,   2,   3
+     0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F
 };
 
 // utf/cl_8859_2.txt
@@ -503,6 +1331,144 @@ const unsigned char cl_8859_2_sbt[73] =
        6, 255,   7,   3,   6,   2,   7,   9,    6
 };
 
+const unsigned char cl_8859_2_fast[2048] =
+{
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   1,
+       1,   1,   1,   1,   1,   1,   1,   1,    1,   1,   1,   1,   1,   1,   1,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       1,   0,   0,   0,   1,   0,   0,   1,    1,   0,   0,   0,   0,   1,   0,   0,
+       1,   0,   0,   0,   1,   0,   0,   0,    1,   0,   0,   0,   0,   0,   0,   0,
+       0,   1,   1,   0,   1,   0,   0,   1,    0,   1,   0,   1,   0,   1,   1,   0,
+       0,   0,   0,   1,   1,   0,   1,   1,    0,   0,   1,   0,   1,   1,   0,   1,
+       0,   1,   1,   0,   1,   0,   0,   1,    0,   1,   0,   1,   0,   1,   1,   0,
+       0,   0,   0,   1,   1,   0,   1,   1,    0,   0,   1,   0,   1,   1,   0,   0,
+       0,   0,   1,   1,   1,   1,   1,   1,    0,   0,   0,   0,   1,   1,   1,   1,
+       1,   1,   0,   0,   0,   0,   0,   0,    1,   1,   1,   1,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   1,   1,   0,   0,   1,   1,   0,
+       0,   1,   1,   1,   1,   0,   0,   1,    1,   0,   0,   0,   0,   0,   0,   0,
+       1,   1,   0,   0,   1,   1,   0,   0,    1,   1,   1,   1,   0,   0,   1,   1,
+       1,   1,   1,   1,   1,   1,   0,   0,    0,   0,   0,   0,   0,   0,   1,   1,
+       1,   1,   0,   0,   0,   0,   0,   0,    0,   1,   1,   1,   1,   1,   1,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   1,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    1,   1,   0,   1,   0,   1,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0
+};
+
+const unsigned char cl_8859_2_aid[16] =
+{
+     0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F
+};
+
 // utf/tr_utf8_ascii.txt
 //
 // 2367 code points.
@@ -750,6 +1716,144 @@ const unsigned char tr_ascii_sbt[3295] =
      172, 157, 174,  27, 157, 103, 157, 255,  177,   3, 157, 255, 181,  84, 157
 };
 
+const unsigned char tr_ascii_fast[2048] =
+{
+       0,  63,  63,  63,  63,  63,  63,   7,    8,   9,  10,  63,  63,  13,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  27,  63,  63,  63,  63,
+      32,  33,  34,  35,  36,  37,  38,  39,   40,  41,  42,  43,  44,  45,  46,  47,
+      48,  49,  50,  51,  52,  53,  54,  55,   56,  57,  58,  59,  60,  61,  62,  63,
+      64,  65,  66,  67,  68,  69,  70,  71,   72,  73,  74,  75,  76,  77,  78,  79,
+      80,  81,  82,  83,  84,  85,  86,  87,   88,  89,  90,  91,  92,  93,  94,  95,
+      96,  97,  98,  99, 100, 101, 102, 103,  104, 105, 106, 107, 108, 109, 110, 111,
+     112, 113, 114, 115, 116, 117, 118, 119,  120, 121, 122, 123, 124, 125, 126,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      32,  33,  63,  63,  63,  63,  63,  63,   32,  63,  97,  63,  63,  45,  63,  32,
+      63,  63,  50,  51,  32,  63,  63,  63,   32,  49, 111,  63,  63,  63,  63,  63,
+      65,  65,  65,  65,  65,  65,  63,  67,   69,  69,  69,  69,  73,  73,  73,  73,
+      68,  78,  79,  79,  79,  79,  79,  42,   79,  85,  85,  85,  85,  89,  63,  63,
+      97,  97,  97,  97,  97,  97,  63,  99,  101, 101, 101, 101, 105, 105, 105, 105,
+     100, 110, 111, 111, 111, 111, 111,  47,  111, 117, 117, 117, 117, 121,  63, 121,
+      65,  97,  65,  97,  65,  97,  67,  99,   67,  99,  67,  99,  67,  99,  68, 100,
+      68, 100,  69, 101,  69, 101,  69, 101,   69, 101,  69, 101,  71, 103,  71, 103,
+      71, 103,  71, 103,  72, 104,  72, 104,   73, 105,  73, 105,  73, 105,  73, 105,
+      73,  63,  63,  63,  74, 106,  75, 107,   63,  76, 108,  76, 108,  76, 108,  76,
+     108,  76, 108,  78, 110,  78, 110,  78,  110, 110,  63,  63,  79, 111,  79, 111,
+      79, 111,  63,  63,  82, 114,  82, 114,   82, 114,  83, 115,  83, 115,  83, 115,
+      83, 115,  84, 116,  84, 116,  84, 116,   85, 117,  85, 117,  85, 117,  85, 117,
+      85, 117,  85, 117,  87, 119,  89, 121,   89,  90, 122,  90, 122,  90, 122, 115,
+      98,  66,  66,  98,  63,  63,  63,  67,   99,  63,  68,  68, 100,  63,  63,  63,
+      63,  70, 102,  71,  63,  63,  63,  73,   75, 107, 108,  63,  63,  78, 110,  79,
+      79, 111,  63,  63,  80, 112,  63,  63,   63,  63,  63, 116,  84, 116,  84,  85,
+     117,  63,  86,  89, 121,  90, 122,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  33,  63,  63,  63,  63,   63,  63,  63,  63,  63,  65,  97,  73,
+     105,  79, 111,  85, 117,  85, 117,  85,  117,  85, 117,  85, 117,  63,  65,  97,
+      65,  97,  63,  63,  71, 103,  71, 103,   75, 107,  79, 111,  79, 111,  63,  63,
+     106,  63,  63,  63,  71, 103,  63,  63,   78, 110,  65,  97,  63,  63,  79, 111,
+      65,  97,  65,  97,  69, 101,  69, 101,   73, 105,  73, 105,  79, 111,  79, 111,
+      82, 114,  82, 114,  85, 117,  85, 117,   83, 115,  84, 116,  63,  63,  72, 104,
+      78, 100,  63,  63,  90, 122,  65,  97,   69, 101,  79, 111,  79, 111,  79, 111,
+      79, 111,  89, 121, 108, 110, 116,  63,   63,  63,  65,  67,  99,  76,  84, 115,
+     122,  63,  63,  66,  85,  63,  69, 101,   74, 106,  63, 113,  82, 114,  89, 121,
+      63,  63,  63,  98,  63,  99, 100, 100,   63,  63,  63,  63,  63,  63,  63,  63,
+     103,  63,  63,  63,  63,  63, 104,  63,  105,  63,  63, 108, 108, 108, 108,  63,
+      63, 109, 110, 110,  63,  63,  63,  63,   63,  63,  63,  63, 114, 114, 114,  63,
+      63,  63, 115,  63,  63,  63,  63,  63,  116, 117,  63, 118,  63,  63,  63,  63,
+     122, 122,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63, 106,  63,  63,
+     113,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+     104,  63, 106, 114,  63,  63,  63, 119,  121,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   32,  32,  32,  32, 126,  32,  63,  63,
+      63, 108, 115, 120,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  32,  63,  63,  63,  59,  63,
+      63,  63,  63,  63,  32,  32,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  69,  63,  73,  63,   63,  63,  63,  63,  63,  73,  63,  63,
+      65,  63,  63,  63,  63,  63,  63,  63,   73,  63,  63,  63,  63,  63,  79,  63,
+      63,  63,  63,  85,  63,  63,  63,  63,   63,  63,  63,  63,  63,  69,  63,  63,
+      97,  63,  63,  63,  63,  63,  63,  63,  105,  63,  63,  63,  63,  63, 111,  63,
+      63,  63,  63, 117,  63,  63,  63,  63,   63,  63,  63,  63,  63, 101,  63,  63,
+      63,  63,  63,  63, 101,  63, 105,  63,   63,  63,  63,  63,  63, 105,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   79, 111,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  72, 104,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      65,  97,  65,  97,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  73, 105,  73, 105,  79, 111,   63,  63,  63,  63,  69, 101,  85, 117,
+      85, 117,  85, 117,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  33,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  45,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      48,  49,  50,  51,  52,  53,  54,  55,   56,  57,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      48,  49,  50,  51,  52,  53,  54,  55,   56,  57,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      48,  49,  50,  51,  52,  53,  54,  55,   56,  57,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  33,  63,  63,  63,  63,  63,  63
+};
+
+const unsigned char tr_ascii_aid[16] =
+{
+     0x80, 0x27, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F
+};
+
 // utf/tr_utf8_cp437.txt
 //
 // 2480 code points.
@@ -1017,6 +2121,144 @@ const unsigned short tr_cp437_sbt[3585] =
      166
 };
 
+const unsigned char tr_cp437_fast[2048] =
+{
+       0,  63,  63,  63,  63,  63,  63,   7,    8,   9,  10,  63,  63,  13,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  27,  63,  63,  63,  63,
+      32,  33,  34,  35,  36,  37,  38,  39,   40,  41,  42,  43,  44,  45,  46,  47,
+      48,  49,  50,  51,  52,  53,  54,  55,   56,  57,  58,  59,  60,  61,  62,  63,
+      64,  65,  66,  67,  68,  69,  70,  71,   72,  73,  74,  75,  76,  77,  78,  79,
+      80,  81,  82,  83,  84,  85,  86,  87,   88,  89,  90,  91,  92,  93,  94,  95,
+      96,  97,  98,  99, 100, 101, 102, 103,  104, 105, 106, 107, 108, 109, 110, 111,
+     112, 113, 114, 115, 116, 117, 118, 119,  120, 121, 122, 123, 124, 125, 126,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+     255, 173, 155, 156,  63, 157,  63,  21,   32,  63, 166, 174, 170,  45,  63,  32,
+     248, 241, 253,  51,  32, 230,  20, 250,   32,  49, 167, 175, 172, 171,  63, 168,
+      65,  65,  65,  65, 142, 143, 146, 128,   69, 144,  69,  69,  73,  73,  73,  73,
+      68, 165,  79,  79,  79,  79, 153,  42,   79,  85,  85,  85, 154,  89,  63, 225,
+     133, 160, 131,  97, 132, 134, 145, 135,  138, 130, 136, 137, 141, 161, 140, 139,
+     100, 164, 149, 162, 147, 111, 148, 246,  111, 151, 163, 150, 129, 121,  63, 152,
+      65,  97,  65,  97,  65,  97,  67,  99,   67,  99,  67,  99,  67,  99,  68, 100,
+      68, 100,  69, 101,  69, 101,  69, 101,   69, 101,  69, 101,  71, 103,  71, 103,
+      71, 103,  71, 103,  72, 104,  72, 104,   73, 105,  73, 105,  73, 105,  73, 105,
+      73,  63,  63,  63,  74, 106,  75, 107,   63,  76, 108,  76, 108,  76, 108,  76,
+     108,  76, 108,  78, 110,  78, 110,  78,  110, 110,  63,  63,  79, 111,  79, 111,
+      79, 111,  63,  63,  82, 114,  82, 114,   82, 114,  83, 115,  83, 115,  83, 115,
+      83, 115,  84, 116,  84, 116,  84, 116,   85, 117,  85, 117,  85, 117,  85, 117,
+      85, 117,  85, 117,  87, 119,  89, 121,   89,  90, 122,  90, 122,  90, 122, 115,
+      98,  66,  66,  98,  63,  63,  63,  67,   99,  63,  68,  68, 100,  63,  63,  63,
+      63,  70, 159,  71,  63,  63,  63,  73,   75, 107, 108,  63,  63,  78, 110,  79,
+      79, 111,  63,  63,  80, 112,  63,  63,   63,  63,  63, 116,  84, 116,  84,  85,
+     117,  63,  86,  89, 121,  90, 122,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  33,  63,  63,  63,  63,   63,  63,  63,  63,  63,  65,  97,  73,
+     105,  79, 111,  85, 117,  85, 117,  85,  117,  85, 117,  85, 117,  63,  65,  97,
+      65,  97,  63,  63,  71, 103,  71, 103,   75, 107,  79, 111,  79, 111,  63,  63,
+     106,  63,  63,  63,  71, 103,  63,  63,   78, 110,  65,  97,  63,  63,  79, 111,
+      65,  97,  65,  97,  69, 101,  69, 101,   73, 105,  73, 105,  79, 111,  79, 111,
+      82, 114,  82, 114,  85, 117,  85, 117,   83, 115,  84, 116,  63,  63,  72, 104,
+      78, 100,  63,  63,  90, 122,  65,  97,   69, 101,  79, 111,  79, 111,  79, 111,
+      79, 111,  89, 121, 108, 110, 116,  63,   63,  63,  65,  67,  99,  76,  84, 115,
+     122,  63,  63,  66,  85,  63,  69, 101,   74, 106,  63, 113,  82, 114,  89, 121,
+      63,  63,  63,  98,  63,  99, 100, 100,   63,  63,  63,  63,  63,  63,  63,  63,
+     103,  63,  63,  63,  63,  63, 104,  63,  105,  63,  63, 108, 108, 108, 108,  63,
+      63, 109, 110, 110,  63,  63,  63,  63,   63,  63,  63,  63, 114, 114, 114,  63,
+      63,  63, 115,  63,  63,  63,  63,  63,  116, 117,  63, 118,  63,  63,  63,  63,
+     122, 122,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63, 106,  63,  63,
+     113,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+     104,  63, 106, 114,  63,  63,  63, 119,  121,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   32,  32,  32,  32, 126,  32,  63,  63,
+      63, 108, 115, 120,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  32,  63,  63,  63,  59,  63,
+      63,  63,  63,  63,  32,  32,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63, 226,  63,  63,  63,  63,  233,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63, 228,  63,  63, 232,  63,   63, 234,  63,  63,  63,  63,  63,  63,
+      63, 224,  63,  63, 235, 238,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+     227,  63,  63, 229, 231,  63, 237,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  69,  63,  73,  63,   63,  63,  63,  63,  63,  73,  63,  63,
+      65,  63,  63,  63,  63,  63,  63,  63,   73,  63,  63,  63,  63,  63,  79,  63,
+      63,  63,  63,  85,  63,  63,  63,  63,   63,  63,  63,  63,  63,  69,  63,  63,
+      97,  63,  63,  63,  63,  63,  63,  63,  105,  63,  63,  63,  63,  63, 111,  63,
+      63,  63,  63, 117,  63,  63,  63,  63,   63,  63,  63,  63,  63, 101,  63,  63,
+      63,  63,  63,  63, 101,  63, 105,  63,   63,  63,  63,  63,  63, 105,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   79, 111,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  72, 104,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      65,  97,  65,  97,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  73, 105,  73, 105,  79, 111,   63,  63,  63,  63,  69, 101,  85, 117,
+      85, 117,  85, 117,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  33,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  45,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      48,  49,  50,  51,  52,  53,  54,  55,   56,  57,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      48,  49,  50,  51,  52,  53,  54,  55,   56,  57,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      48,  49,  50,  51,  52,  53,  54,  55,   56,  57,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  33,  63,  63,  63,  63,  63,  63
+};
+
+const unsigned char tr_cp437_aid[16] =
+{
+     0x80, 0x27, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F
+};
+
 // utf/tr_utf8_latin1.txt
 //
 // 2404 code points.
@@ -1269,6 +2511,144 @@ const unsigned short tr_latin1_sbt[3349] =
      159, 255, 183,  84, 159
 };
 
+const unsigned char tr_latin1_fast[2048] =
+{
+       0,  63,  63,  63,  63,  63,  63,   7,    8,   9,  10,  63,  63,  13,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  27,  63,  63,  63,  63,
+      32,  33,  34,  35,  36,  37,  38,  39,   40,  41,  42,  43,  44,  45,  46,  47,
+      48,  49,  50,  51,  52,  53,  54,  55,   56,  57,  58,  59,  60,  61,  62,  63,
+      64,  65,  66,  67,  68,  69,  70,  71,   72,  73,  74,  75,  76,  77,  78,  79,
+      80,  81,  82,  83,  84,  85,  86,  87,   88,  89,  90,  91,  92,  93,  94,  95,
+      96,  97,  98,  99, 100, 101, 102, 103,  104, 105, 106, 107, 108, 109, 110, 111,
+     112, 113, 114, 115, 116, 117, 118, 119,  120, 121, 122, 123, 124, 125, 126,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+     160, 161, 162, 163, 164, 165, 166, 167,  168, 169, 170, 171, 172, 173, 174, 175,
+     176, 177, 178, 179, 180, 181, 182, 183,  184, 185, 186, 187, 188, 189, 190, 191,
+     192, 193, 194, 195, 196, 197, 198, 199,  200, 201, 202, 203, 204, 205, 206, 207,
+     208, 209, 210, 211, 212, 213, 214, 215,  216, 217, 218, 219, 220, 221, 222, 223,
+     224, 225, 226, 227, 228, 229, 230, 231,  232, 233, 234, 235, 236, 237, 238, 239,
+     240, 241, 242, 243, 244, 245, 246, 247,  248, 249, 250, 251, 252, 253, 254, 255,
+      65,  97,  65,  97,  65,  97,  67,  99,   67,  99,  67,  99,  67,  99,  68, 100,
+      68, 100,  69, 101,  69, 101,  69, 101,   69, 101,  69, 101,  71, 103,  71, 103,
+      71, 103,  71, 103,  72, 104,  72, 104,   73, 105,  73, 105,  73, 105,  73, 105,
+      73,  63,  63,  63,  74, 106,  75, 107,   63,  76, 108,  76, 108,  76, 108,  76,
+     108,  76, 108,  78, 110,  78, 110,  78,  110, 110,  63,  63,  79, 111,  79, 111,
+      79, 111,  63,  63,  82, 114,  82, 114,   82, 114,  83, 115,  83, 115,  83, 115,
+      83, 115,  84, 116,  84, 116,  84, 116,   85, 117,  85, 117,  85, 117,  85, 117,
+      85, 117,  85, 117,  87, 119,  89, 121,  255,  90, 122,  90, 122, 122, 122, 115,
+      98,  66,  66,  98,  63,  63,  63,  67,   99,  63,  68,  68, 100,  63,  63,  63,
+      63,  70, 102,  71,  63,  63,  63,  73,   75, 107, 108,  63,  63,  78, 110,  79,
+      79, 111,  63,  63,  80, 112,  63,  63,   63,  63,  63, 116,  84, 116,  84,  85,
+     117,  63,  86,  89, 121,  90, 122,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  33,  63,  63,  63,  63,   63,  63,  63,  63,  63,  65,  97,  73,
+     105,  79, 111,  85, 117,  85, 117,  85,  117,  85, 117,  85, 117,  63,  65,  97,
+      65,  97,  63, 230,  71, 103,  71, 103,   75, 107,  79, 111,  79, 111,  63,  63,
+     106,  63,  63,  63,  71, 103,  63,  63,   78, 110,  65,  97,  63, 230,  79, 111,
+      65,  97,  65,  97,  69, 101,  69, 101,   73, 105,  73, 105,  79, 111,  79, 111,
+      82, 114,  82, 114,  85, 117,  85, 117,   83, 115,  84, 116,  63,  63,  72, 104,
+      78, 100,  63,  63,  90, 122,  65,  97,   69, 101,  79, 111,  79, 111,  79, 111,
+      79, 111,  89, 121, 108, 110, 116,  63,   63,  63,  65,  67,  99,  76,  84, 115,
+     122,  63,  63,  66,  85,  63,  69, 101,   74, 106,  63, 113,  82, 114,  89, 121,
+      63,  63,  63,  98,  63,  99, 100, 100,   63,  63,  63,  63,  63,  63,  63,  63,
+     103,  63,  63,  63,  63,  63, 104,  63,  105,  63,  63, 108, 108, 108, 108,  63,
+      63, 109, 110, 110,  63,  63,  63,  63,   63,  63,  63,  63, 114, 114, 114,  63,
+      63,  63, 115,  63,  63,  63,  63,  63,  116, 117,  63, 118,  63,  63,  63,  63,
+     122, 122,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63, 106,  63,  63,
+     113,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+     104,  63, 106, 114,  63,  63,  63, 119,  121,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   32,  32,  32,  32, 126,  32,  63,  63,
+      63, 108, 115, 120,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  32,  63,  63,  63,  59,  63,
+      63,  63,  63,  63,  32,  32,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  69,  63,  73,  63,   63,  63,  63,  63,  63,  73,  63,  63,
+      65,  63,  63,  63,  63,  63,  63,  63,   73,  63,  63,  63,  63,  63,  79,  63,
+      63,  63,  63,  85,  63,  63,  63,  63,   63,  63,  63,  63,  63,  69,  63,  63,
+      97,  63,  63,  63,  63,  63,  63,  63,  105,  63,  63,  63,  63,  63, 111,  63,
+      63,  63,  63, 117,  63,  63,  63,  63,   63,  63,  63,  63,  63, 101,  63,  63,
+      63,  63,  63,  63, 101,  63, 105,  63,   63,  63,  63,  63,  63, 105,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   79, 111,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  72, 104,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      65,  97,  65,  97,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  73, 105,  73, 105,  79, 111,   63,  63,  63,  63,  69, 101,  85, 117,
+      85, 117,  85, 117,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  33,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  45,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      48,  49,  50,  51,  52,  53,  54,  55,   56,  57,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      48,  49,  50,  51,  52,  53,  54,  55,   56,  57,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      48,  49,  50,  51,  52,  53,  54,  55,   56,  57,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  33,  63,  63,  63,  63,  63,  63
+};
+
+const unsigned char tr_latin1_aid[16] =
+{
+     0x80, 0x27, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F
+};
+
 // utf/tr_utf8_latin2.txt
 //
 // 2372 code points.
@@ -1518,6 +2898,144 @@ const unsigned short tr_latin2_sbt[3324] =
       27, 157, 103, 157, 255, 177,   3, 157,  255, 181,  84, 157
 };
 
+const unsigned char tr_latin2_fast[2048] =
+{
+       0,  63,  63,  63,  63,  63,  63,   7,    8,   9,  10,  63,  63,  13,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  27,  63,  63,  63,  63,
+      32,  33,  34,  35,  36,  37,  38,  39,   40,  41,  42,  43,  44,  45,  46,  47,
+      48,  49,  50,  51,  52,  53,  54,  55,   56,  57,  58,  59,  60,  61,  62,  63,
+      64,  65,  66,  67,  68,  69,  70,  71,   72,  73,  74,  75,  76,  77,  78,  79,
+      80,  81,  82,  83,  84,  85,  86,  87,   88,  89,  90,  91,  92,  93,  94,  95,
+      96,  97,  98,  99, 100, 101, 102, 103,  104, 105, 106, 107, 108, 109, 110, 111,
+     112, 113, 114, 115, 116, 117, 118, 119,  120, 121, 122, 123, 124, 125, 126,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+     160,  33,  63,  63, 164,  63,  63, 167,  168,  63,  97,  63,  63, 173,  63,  32,
+     176,  63,  50,  51, 180,  63,  63,  63,  184,  49, 111,  63,  63,  63,  63,  63,
+      65, 193, 194,  65, 196,  65,  63, 199,   69, 201,  69, 203,  73, 205, 206,  73,
+      68,  78,  79, 211, 212,  79, 214, 215,   79,  85, 218,  85, 220, 221,  63, 223,
+      97, 225, 226,  97, 228,  97,  63, 231,  101, 233, 101, 235, 105, 237, 238, 105,
+     100, 110, 111, 243, 244, 111, 246, 247,  111, 117, 250, 117, 252, 253,  63, 121,
+      65,  97, 195, 227, 161, 177, 198, 230,   67,  99,  67,  99, 200, 232, 207, 239,
+     208, 240,  69, 101,  69, 101,  69, 101,  202, 234, 204, 236,  71, 103,  71, 103,
+      71, 103,  71, 103,  72, 104,  72, 104,   73, 105,  73, 105,  73, 105,  73, 105,
+      73,  63,  63,  63,  74, 106,  75, 107,   63, 197, 229,  76, 108, 165, 181,  76,
+     108, 163, 179, 209, 241,  78, 110, 210,  242, 110,  63,  63,  79, 111,  79, 111,
+     213, 245,  63,  63, 192, 224,  82, 114,  216, 248, 166, 182,  83, 115, 170, 186,
+     169, 185, 222, 254, 171, 187,  84, 116,   85, 117,  85, 117,  85, 117, 217, 249,
+     219, 251,  85, 117,  87, 119,  89, 121,   89, 172, 188, 175, 191, 174, 190, 115,
+      98,  66,  66,  98,  63,  63,  63,  67,   99,  63,  68,  68, 100,  63,  63,  63,
+      63,  70, 102,  71,  63,  63,  63,  73,   75, 107, 108,  63,  63,  78, 110,  79,
+      79, 111,  63,  63,  80, 112,  63,  63,   63,  63,  63, 116,  84, 116,  84,  85,
+     117,  63,  86,  89, 121,  90, 122,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  33,  63,  63,  63,  63,   63,  63,  63,  63,  63,  65,  97,  73,
+     105,  79, 111,  85, 117,  85, 117,  85,  117,  85, 117,  85, 117,  63,  65,  97,
+      65,  97,  63,  63,  71, 103,  71, 103,   75, 107,  79, 111,  79, 111,  63,  63,
+     106,  63,  63,  63,  71, 103,  63,  63,   78, 110,  65,  97,  63,  63,  79, 111,
+      65,  97,  65,  97,  69, 101,  69, 101,   73, 105,  73, 105,  79, 111,  79, 111,
+      82, 114,  82, 114,  85, 117,  85, 117,   83, 115,  84, 116,  63,  63,  72, 104,
+      78, 100,  63,  63,  90, 122,  65,  97,   69, 101,  79, 111,  79, 111,  79, 111,
+      79, 111,  89, 121, 108, 110, 116,  63,   63,  63,  65,  67,  99,  76,  84, 115,
+     122,  63,  63,  66,  85,  63,  69, 101,   74, 106,  63, 113,  82, 114,  89, 121,
+      63,  63,  63,  98,  63,  99, 100, 100,   63,  63,  63,  63,  63,  63,  63,  63,
+     103,  63,  63,  63,  63,  63, 104,  63,  105,  63,  63, 108, 108, 108, 108,  63,
+      63, 109, 110, 110,  63,  63,  63,  63,   63,  63,  63,  63, 114, 114, 114,  63,
+      63,  63, 115,  63,  63,  63,  63,  63,  116, 117,  63, 118,  63,  63,  63,  63,
+     122, 122,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63, 106,  63,  63,
+     113,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+     104,  63, 106, 114,  63,  63,  63, 119,  121,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63, 183,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,  162, 255,  32, 178, 126, 189,  63,  63,
+      63, 108, 115, 120,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  32,  63,  63,  63,  59,  63,
+      63,  63,  63,  63,  32,  32,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  69,  63,  73,  63,   63,  63,  63,  63,  63,  73,  63,  63,
+      65,  63,  63,  63,  63,  63,  63,  63,   73,  63,  63,  63,  63,  63,  79,  63,
+      63,  63,  63,  85,  63,  63,  63,  63,   63,  63,  63,  63,  63,  69,  63,  63,
+      97,  63,  63,  63,  63,  63,  63,  63,  105,  63,  63,  63,  63,  63, 111,  63,
+      63,  63,  63, 117,  63,  63,  63,  63,   63,  63,  63,  63,  63, 101,  63,  63,
+      63,  63,  63,  63, 101,  63, 105,  63,   63,  63,  63,  63,  63, 105,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   79, 111,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  72, 104,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      65,  97,  65,  97,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  73, 105,  73, 105,  79, 111,   63,  63,  63,  63,  69, 101,  85, 117,
+      85, 117,  85, 117,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  33,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  45,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      48,  49,  50,  51,  52,  53,  54,  55,   56,  57,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      48,  49,  50,  51,  52,  53,  54,  55,   56,  57,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      48,  49,  50,  51,  52,  53,  54,  55,   56,  57,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  33,  63,  63,  63,  63,  63,  63
+};
+
+const unsigned char tr_latin2_aid[16] =
+{
+     0x80, 0x27, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F
+};
+
 // utf/tr_tolower.txt
 //
 // 1029 code points.
@@ -1642,6 +3160,144 @@ const unsigned char tr_tolower_sbt[1365] =
      145,   7, 146,  45,  46
 };
 
+const unsigned char tr_tolower_fast[2048] =
+{
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,  16,  16,  16,  16,  16,  16,  16,   16,  16,  16,  16,  16,  16,  16,  16,
+      16,  16,  16,  16,  16,  16,  16,  16,   16,  16,  16,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+      17,  17,  17,  17,  17,  17,  17,  17,   17,  17,  17,  17,  17,  17,  17,  17,
+      17,  17,  17,  17,  17,  17,  17,   0,   17,  17,  17,  17,  17,  17,  17,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+      18,   0,  18,   0,  18,   0,  18,   0,   18,   0,  18,   0,  18,   0,  18,   0,
+      18,   0,  18,   0,  18,   0,  18,   0,   18,   0,  18,   0,  18,   0,  18,   0,
+      18,   0,  18,   0,  18,   0,  18,   0,   18,   0,  18,   0,  18,   0,  18,   0,
+       1,   0,  18,   0,  18,   0,  18,   0,    0,  19,   0,  20,   0,  19,   0,  21,
+       0,  19,   0,  20,   0,  19,   0,  22,    0,   0,  18,   0,  18,   0,  18,   0,
+      18,   0,  18,   0,  18,   0,  18,   0,   18,   0,  18,   0,  18,   0,  18,   0,
+      18,   0,  18,   0,  18,   0,  18,   0,   18,   0,  18,   0,  18,   0,  18,   0,
+      18,   0,  18,   0,  18,   0,  18,   0,   23,  19,   0,  20,   0,  19,   0,   0,
+       0,  24,  18,   0,  18,   0,  24,  22,    0,  25,  26,  20,   0,   0,  27,  28,
+      29,  19,   0,  30,  31,   0,  32,  32,   18,   0,   0,   0,  30,  33,   0,  34,
+      18,   0,  18,   0,  18,   0,  35,  22,    0,  36,   0,   0,  18,   0,  35,  37,
+       0,  38,  39,  20,   0,  19,   0,  40,   18,   0,   0,   0,  18,   0,   0,   0,
+       0,   0,   0,   0,  41,  19,   0,  42,   18,   0,  43,  20,   0,  19,   0,  37,
+       0,  19,   0,  20,   0,  19,   0,  22,    0,  19,   0,  20,   0,   0,  18,   0,
+      18,   0,  18,   0,  18,   0,  18,   0,   18,   0,  18,   0,  18,   0,  18,   0,
+       0,  41,  18,   0,  18,   0,  44,  45,   18,   0,  18,   0,  18,   0,  18,   0,
+      18,   0,  18,   0,  18,   0,  18,   0,   18,   0,  18,   0,  18,   0,  18,   0,
+      18,   0,  18,   0,  18,   0,  18,   0,   18,   0,  18,   0,  18,   0,  18,   0,
+      46,   0,  18,   0,  18,   0,  18,   0,   18,   0,  18,   0,  18,   0,  18,   0,
+      18,   0,  18,   0,   0,   0,   0,   0,    0,   0,   2,  20,   0,  47,   3,   0,
+       0,  19,   0,  48,  49,  50,  18,   0,   18,   0,  18,   0,  18,   0,  18,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+      18,   0,  18,   0,   0,   0,  18,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,  51,   0,   52,  53,  52,   0,  54,   0,  55,  56,
+       0,  17,  17,  17,  17,  17,  17,  17,   17,  17,  17,  17,  17,  17,  17,  17,
+      57,  57,   0,  57,  57,  57,  57,  57,   57,  57,  57,  57,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,  58,
+       0,   0,   0,   0,   0,   0,   0,   0,   18,   0,  18,   0,  18,   0,  18,   0,
+      18,   0,  18,   0,  18,   0,  18,   0,   18,   0,  18,   0,  18,   0,  18,   0,
+       0,   0,   0,   0,  59,   0,   0,  22,    0,  60,  18,   0,   0,  61,  62,  62,
+      63,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      17,  17,  17,  17,  17,  17,  17,  17,   17,  17,  17,  17,  17,  17,  17,  17,
+      57,  57,  57,  57,  57,  57,  57,  57,   57,  57,  57,  57,  57,  57,  57,  57,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+      18,   0,  18,   0,  18,   0,  18,   0,   18,   0,  18,   0,  18,   0,  18,   0,
+      18,   0,  18,   0,  18,   0,  18,   0,   18,   0,  18,   0,  18,   0,  18,   0,
+      18,   0,   0,   0,   0,   0,   0,   0,    0,   0,  18,   0,  18,   0,  18,   0,
+      18,   0,  18,   0,  18,   0,  18,   0,   18,   0,  18,   0,  18,   0,  18,   0,
+      18,   0,  18,   0,  18,   0,  18,   0,   18,   0,  18,   0,  18,   0,  18,   0,
+      18,   0,  18,   0,  18,   0,  18,   0,   18,   0,  18,   0,  18,   0,  18,   0,
+      22,  19,   0,  20,   0,  19,   0,  22,    0,  19,   0,  20,   0,  19,   0,   0,
+      18,   0,  18,   0,  18,   0,  18,   0,   18,   0,  18,   0,  18,   0,  18,   0,
+      18,   0,  18,   0,  18,   0,  18,   0,   18,   0,  18,   0,  18,   0,  18,   0,
+      18,   0,  18,   0,  18,   0,  18,   0,   18,   0,  18,   0,  18,   0,  18,   0,
+      18,   0,  18,   0,  18,   0,  18,   0,   18,   0,  18,   0,  18,   0,  18,   0,
+      18,   0,  18,   0,  18,   0,  18,   0,   18,   0,  18,   0,  18,   0,  18,   0,
+      18,   0,  18,   0,  18,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,  63,  63,  63,  63,  63,  63,  63,   63,  63,  63,  63,  63,  63,  63,  63,
+      64,  64,  64,  64,  64,  64,  64,  64,   64,  64,  64,  64,  64,  64,  64,  64,
+      65,  65,  65,  65,  65,  65,  65,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0
+};
+
+const unsigned char tr_tolower_aid[16] =
+{
+     0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+     0x01, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
 const string_desc tr_tolower_ott[100] =
 {
     {  1,  1, T("\x69") }, // 1 references
@@ -1877,6 +3533,144 @@ const unsigned char tr_toupper_sbt[1458] =
       72,  48
 };
 
+const unsigned char tr_toupper_fast[2048] =
+{
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,  14,  14,  14,  14,  14,  14,  14,   14,  14,  14,  14,  14,  14,  14,  14,
+      14,  14,  14,  14,  14,  14,  14,  14,   14,  14,  14,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,  15,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+      16,  16,  16,  16,  16,  16,  16,  16,   16,  16,  16,  16,  16,  16,  16,  16,
+      16,  16,  16,  16,  16,  16,  16,   0,   16,  16,  16,  16,  16,  16,  16,  17,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,   1,   0,  18,   0,  18,   0,  18,    0,   0,  19,   0,  20,   0,  19,   0,
+      21,   0,  19,   0,  20,   0,  19,   0,   22,   0,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,   0,  19,   0,  20,   0,  19,   2,
+      23,   0,   0,  18,   0,  18,   0,   0,   22,   0,   0,   0,  20,   0,   0,   0,
+       0,   0,  19,   0,   0,  24,   0,   0,    0,  18,  25,   0,   0,   0,  26,   0,
+       0,  18,   0,  18,   0,  18,   0,   0,   22,   0,   0,   0,   0,  18,   0,   0,
+      27,   0,   0,   0,  20,   0,  19,   0,    0,  18,   0,   0,   0,  18,   0,  28,
+       0,   0,   0,   0,   0,  18,  29,   0,   22,  30,   0,  18,  31,   0,  19,   0,
+      27,   0,  19,   0,  20,   0,  19,   0,   22,   0,  19,   0,  20,  32,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,   0,  19,  29,   0,  18,   0,   0,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,   0,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,   0,   0,   0,    0,   0,   0,   0,  20,   0,   0,   3,
+       4,   0,  19,   0,   0,   0,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       5,   6,   7,  33,  33,   0,  34,  35,    0,  36,   0,  37,   0,   0,   0,   0,
+      38,   0,   0,  39,   0,   0,   0,   0,   40,  40,   0,   8,   0,   0,   0,  38,
+       0,   9,  41,   0,   0,  42,   0,   0,    0,   0,   0,   0,   0,  10,   0,   0,
+      43,   0,   0,  44,   0,   0,   0,   0,   43,  45,  46,  47,  48,   0,   0,   0,
+       0,   0,  49,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,  18,   0,  18,   0,   0,   0,  18,    0,   0,   0,  50,  51,  51,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,  52,  53,  54,  53,
+       0,  16,  16,  16,  16,  16,  16,  16,   16,  16,  16,  16,  16,  16,  16,  16,
+      55,  55,  56,  55,  55,  55,  55,  55,   55,  55,  55,  55,  57,  58,  59,   0,
+      60,  61,   0,   0,   0,  62,  63,  64,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+      65,  66,  67,   0,   0,  55,   0,   0,   22,   0,   0,  18,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+      16,  16,  16,  16,  16,  16,  16,  16,   16,  16,  16,  16,  16,  16,  16,  16,
+      55,  55,  55,  55,  55,  55,  55,  55,   55,  55,  55,  55,  55,  55,  55,  55,
+      66,  66,  66,  66,  66,  66,  66,  66,   66,  66,  66,  66,  66,  66,  66,  66,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,   0,   0,   0,   0,   0,    0,   0,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,   0,  19,   0,  20,   0,  19,   0,   22,   0,  19,   0,  20,   0,  19,  22,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,  66,  66,  66,  66,  66,  66,  66,   66,  66,  66,  66,  66,  66,  66,  66,
+      68,  68,  68,  68,  68,  68,  68,  68,   68,  68,  68,  68,  68,  68,  68,  68,
+      69,  69,  69,  69,  69,  69,  69,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0
+};
+
+const unsigned char tr_toupper_aid[16] =
+{
+     0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+     0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF8
+};
+
 const string_desc tr_toupper_ott[105] =
 {
     {  1,  1, T("\x49") }, // 1 references
@@ -2117,6 +3911,144 @@ const unsigned char tr_totitle_sbt[1459] =
      151,  72,  48
 };
 
+const unsigned char tr_totitle_fast[2048] =
+{
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,  14,  14,  14,  14,  14,  14,  14,   14,  14,  14,  14,  14,  14,  14,  14,
+      14,  14,  14,  14,  14,  14,  14,  14,   14,  14,  14,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,  15,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+      16,  16,  16,  16,  16,  16,  16,  16,   16,  16,  16,  16,  16,  16,  16,  16,
+      16,  16,  16,  16,  16,  16,  16,   0,   16,  16,  16,  16,  16,  16,  16,  17,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,   1,   0,  18,   0,  18,   0,  18,    0,   0,  19,   0,  20,   0,  19,   0,
+      21,   0,  19,   0,  20,   0,  19,   0,   22,   0,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,   0,  19,   0,  20,   0,  19,   2,
+      23,   0,   0,  18,   0,  18,   0,   0,   22,   0,   0,   0,  20,   0,   0,   0,
+       0,   0,  19,   0,   0,  24,   0,   0,    0,  18,  25,   0,   0,   0,  26,   0,
+       0,  18,   0,  18,   0,  18,   0,   0,   22,   0,   0,   0,   0,  18,   0,   0,
+      27,   0,   0,   0,  20,   0,  19,   0,    0,  18,   0,   0,   0,  18,   0,  28,
+       0,   0,   0,   0,  18,  29,  19,  22,   29,  18,  18,  29,  20,   0,  19,   0,
+      27,   0,  19,   0,  20,   0,  19,   0,   22,   0,  19,   0,  20,  30,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  19,  29,  18,   0,  18,   0,   0,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,   0,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,   0,   0,   0,    0,   0,   0,   0,  20,   0,   0,   3,
+       4,   0,  19,   0,   0,   0,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       5,   6,   7,  31,  31,   0,  32,  33,    0,  34,   0,  35,   0,   0,   0,   0,
+      36,   0,   0,  37,   0,   0,   0,   0,   38,  38,   0,   8,   0,   0,   0,  36,
+       0,   9,  39,   0,   0,  40,   0,   0,    0,   0,   0,   0,   0,  10,   0,   0,
+      41,   0,   0,  42,   0,   0,   0,   0,   41,  43,  44,  45,  46,   0,   0,   0,
+       0,   0,  47,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,  18,   0,  18,   0,   0,   0,  18,    0,   0,   0,  48,  49,  49,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,  50,  51,  52,  51,
+       0,  16,  16,  16,  16,  16,  16,  16,   16,  16,  16,  16,  16,  16,  16,  16,
+      53,  53,  54,  53,  53,  53,  53,  53,   53,  53,  53,  53,  55,  56,  57,   0,
+      58,  59,   0,   0,   0,  60,  61,  62,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+      63,  64,  65,   0,   0,  53,   0,   0,   22,   0,   0,  18,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+      16,  16,  16,  16,  16,  16,  16,  16,   16,  16,  16,  16,  16,  16,  16,  16,
+      53,  53,  53,  53,  53,  53,  53,  53,   53,  53,  53,  53,  53,  53,  53,  53,
+      64,  64,  64,  64,  64,  64,  64,  64,   64,  64,  64,  64,  64,  64,  64,  64,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,   0,   0,   0,   0,   0,    0,   0,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,   0,  19,   0,  20,   0,  19,   0,   22,   0,  19,   0,  20,   0,  19,  22,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,  18,    0,  18,   0,  18,   0,  18,   0,  18,
+       0,  18,   0,  18,   0,  18,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,  64,  64,  64,  64,  64,  64,  64,   64,  64,  64,  64,  64,  64,  64,  64,
+      66,  66,  66,  66,  66,  66,  66,  66,   66,  66,  66,  66,  66,  66,  66,  66,
+      67,  67,  67,  67,  67,  67,  67,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0
+};
+
+const unsigned char tr_totitle_aid[16] =
+{
+     0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+     0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF8
+};
+
 const string_desc tr_totitle_ott[103] =
 {
     {  1,  1, T("\x49") }, // 1 references
@@ -2233,34 +4165,172 @@ const unsigned char tr_foldmatch_itt[256] =
 {
        0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
        0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
-       0,   0,   1,   0,   0,   0,   0,   1,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   1,   0,   0,   0,   0,   1,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+
+       2,   0,   3,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    4,   4,   4,   4,   5,   6,   6,   6,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   7,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   8,   9,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,  10,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0
+
+};
+
+const unsigned char tr_foldmatch_sot[7] =
+{
+        0,    9,   15,   23,   29,   35,   41
+};
+
+const unsigned char tr_foldmatch_sbt[47] =
+{
+     254,   7,  10,   6,   7, 253,   1,   3,    5,   2,   7, 255,   2,   8,   7,   4,
+       7, 255,   8,   2,   9,   4,   7,   2,    7, 255,   4,   8,   7,   6,   7, 255,
+       9,   4,   7,   7,   7, 255,   6,   3,    7,   3,   7, 255,   9,   7,   7
+};
+
+const unsigned char tr_foldmatch_fast[2048] =
+{
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   3,   0,   0,   0,   0,   3,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
        0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
        0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
        0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
        0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
        0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
-
-       2,   0,   3,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
-       0,   0,   0,   0,   0,   0,   0,   0,    4,   4,   4,   4,   5,   6,   6,   6,
        0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
-       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   7,   0,   0,   0,
        0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
        0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
-       0,   0,   8,   9,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,  10,
        0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0
-
 };
 
-const unsigned char tr_foldmatch_sot[7] =
-{
-        0,    9,   15,   23,   29,   35,   41
-};
-
-const unsigned char tr_foldmatch_sbt[47] =
+const unsigned char tr_foldmatch_aid[16] =
 {
-     254,   7,  10,   6,   7, 253,   1,   3,    5,   2,   7, 255,   2,   8,   7,   4,
-       7, 255,   8,   2,   9,   4,   7,   2,    7, 255,   4,   8,   7,   6,   7, 255,
-       9,   4,   7,   7,   7, 255,   6,   3,    7,   3,   7, 255,   9,   7,   7
+     0xFE, 0xFF, 0xFF, 0xFF, 0x7B, 0xFF, 0xFF, 0xFF,
+     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
 };
 
 const string_desc tr_foldmatch_ott[3] =
@@ -2448,3 +4518,142 @@ const unsigned short tr_color_sbt[2245] =
      2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079,  2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087,
      2088, 2089, 2090,   2,  37
 };
+
+const unsigned char tr_color_fast[2048] =
+{
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0,
+       0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0
+};
+
+const unsigned char tr_color_aid[16] =
+{
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
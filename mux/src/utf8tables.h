@@ -25,6 +25,9 @@ typedef struct
 extern const unsigned char cl_print_itt[256];
 extern const unsigned short cl_print_sot[215];
 extern const unsigned char cl_print_sbt[3263];
+#define CL_PRINT_FAST_LIMIT (0x800)
+extern const unsigned char cl_print_fast[2048];
+extern const unsigned char cl_print_aid[16];
 
 // utf/cl_AttrNameInitial.txt
 //
@@ -36,6 +39,9 @@ extern const unsigned char cl_print_sbt[3263];
 extern const unsigned char cl_attrnameinitial_itt[256];
 extern const unsigned char cl_attrnameinitial_sot[6];
 extern const unsigned char cl_attrnameinitial_sbt[50];
+#define CL_ATTRNAMEINITIAL_FAST_LIMIT (0x800)
+extern const unsigned char cl_attrnameinitial_fast[2048];
+extern const unsigned char cl_attrnameinitial_aid[16];
 
 // utf/cl_AttrName.txt
 //
@@ -47,6 +53,9 @@ extern const unsigned char cl_attrnameinitial_sbt[50];
 extern const unsigned char cl_attrname_itt[256];
 extern const unsigned char cl_attrname_sot[6];
 extern const unsigned char cl_attrname_sbt[50];
+#define CL_ATTRNAME_FAST_LIMIT (0x800)
+extern const unsigned char cl_attrname_fast[2048];
+extern const unsigned char cl_attrname_aid[16];
 
 // utf/cl_ObjectName.txt
 //
@@ -58,6 +67,9 @@ extern const unsigned char cl_attrname_sbt[50];
 extern const unsigned char cl_objectname_itt[256];
 extern const unsigned char cl_objectname_sot[8];
 extern const unsigned char cl_objectname_sbt[79];
+#define CL_OBJECTNAME_FAST_LIMIT (0x800)
+extern const unsigned char cl_objectname_fast[2048];
+extern const unsigned char cl_objectname_aid[16];
 
 // utf/cl_PlayerName.txt
 //
@@ -69,6 +81,9 @@ extern const unsigned char cl_objectname_sbt[79];
 extern const unsigned char cl_playername_itt[256];
 extern const unsigned char cl_playername_sot[6];
 extern const unsigned char cl_playername_sbt[50];
+#define CL_PLAYERNAME_FAST_LIMIT (0x800)
+extern const unsigned char cl_playername_fast[2048];
+extern const unsigned char cl_playername_aid[16];
 
 // utf/cl_8859_1.txt
 //
@@ -80,6 +95,9 @@ extern const unsigned char cl_playername_sbt[50];
 extern const unsigned char cl_8859_1_itt[256];
 extern const unsigned char cl_8859_1_sot[3];
 extern const unsigned char cl_8859_1_sbt[20];
+#define CL_8859_1_FAST_LIMIT (0x800)
+extern const unsigned char cl_8859_1_fast[2048];
+extern const unsigned char cl_8859_1_aid[16];
 
 // utf/cl_8859_2.txt
 //
@@ -91,6 +109,9 @@ extern const unsigned char cl_8859_1_sbt[20];
 extern const unsigned char cl_8859_2_itt[256];
 extern const unsigned char cl_8859_2_sot[6];
 extern const unsigned char cl_8859_2_sbt[73];
+#define CL_8859_2_FAST_LIMIT (0x800)
+extern const unsigned char cl_8859_2_fast[2048];
+extern const unsigned char cl_8859_2_aid[16];
 
 // utf/tr_utf8_ascii.txt
 //
@@ -102,6 +123,9 @@ extern const unsigned char cl_8859_2_sbt[73];
 extern const unsigned char tr_ascii_itt[256];
 extern const unsigned short tr_ascii_sot[94];
 extern const unsigned char tr_ascii_sbt[3295];
+#define TR_ASCII_FAST_LIMIT (0x800)
+extern const unsigned char tr_ascii_fast[2048];
+extern const unsigned char tr_ascii_aid[16];
 
 // utf/tr_utf8_cp437.txt
 //
@@ -113,6 +137,9 @@ extern const unsigned char tr_ascii_sbt[3295];
 extern const unsigned char tr_cp437_itt[256];
 extern const unsigned short tr_cp437_sot[103];
 extern const unsigned short tr_cp437_sbt[3585];
+#define TR_CP437_FAST_LIMIT (0x800)
+extern const unsigned char tr_cp437_fast[2048];
+extern const unsigned char tr_cp437_aid[16];
 
 // utf/tr_utf8_latin1.txt
 //
@@ -124,6 +151,9 @@ extern const unsigned short tr_cp437_sbt[3585];
 extern const unsigned char tr_latin1_itt[256];
 extern const unsigned short tr_latin1_sot[96];
 extern const unsigned short tr_latin1_sbt[3349];
+#define TR_LATIN1_FAST_LIMIT (0x800)
+extern const unsigned char tr_latin1_fast[2048];
+extern const unsigned char tr_latin1_aid[16];
 
 // utf/tr_utf8_latin2.txt
 //
@@ -135,6 +165,9 @@ extern const unsigned short tr_latin1_sbt[3349];
 extern const unsigned char tr_latin2_itt[256];
 extern const unsigned short tr_latin2_sot[94];
 extern const unsigned short tr_latin2_sbt[3324];
+#define TR_LATIN2_FAST_LIMIT (0x800)
+extern const unsigned char tr_latin2_fast[2048];
+extern const unsigned char tr_latin2_aid[16];
 
 // utf/tr_tolower.txt
 //
@@ -146,6 +179,9 @@ extern const unsigned short tr_latin2_sbt[3324];
 extern const unsigned char tr_tolower_itt[256];
 extern const unsigned short tr_tolower_sot[46];
 extern const unsigned char tr_tolower_sbt[1365];
+#define TR_TOLOWER_FAST_LIMIT (0x800)
+extern const unsigned char tr_tolower_fast[2048];
+extern const unsigned char tr_tolower_aid[16];
 
 #define TR_TOLOWER_DEFAULT (0)
 #define TR_TOLOWER_LITERAL_START (1)
@@ -162,6 +198,9 @@ extern const string_desc tr_tolower_ott[100];
 extern const unsigned char tr_toupper_itt[256];
 extern const unsigned short tr_toupper_sot[48];
 extern const unsigned char tr_toupper_sbt[1458];
+#define TR_TOUPPER_FAST_LIMIT (0x800)
+extern const unsigned char tr_toupper_fast[2048];
+extern const unsigned char tr_toupper_aid[16];
 
 #define TR_TOUPPER_DEFAULT (0)
 #define TR_TOUPPER_LITERAL_START (1)
@@ -178,6 +217,9 @@ extern const string_desc tr_toupper_ott[105];
 extern const unsigned char tr_totitle_itt[256];
 extern const unsigned short tr_totitle_sot[48];
 extern const unsigned char tr_totitle_sbt[1459];
+#define TR_TOTITLE_FAST_LIMIT (0x800)
+extern const unsigned char tr_totitle_fast[2048];
+extern const unsigned char tr_totitle_aid[16];
 
 #define TR_TOTITLE_DEFAULT (0)
 #define TR_TOTITLE_LITERAL_START (1)
@@ -194,6 +236,9 @@ extern const string_desc tr_totitle_ott[103];
 extern const unsigned char tr_foldmatch_itt[256];
 extern const unsigned char tr_foldmatch_sot[7];
 extern const unsigned char tr_foldmatch_sbt[47];
+#define TR_FOLDMATCH_FAST_LIMIT (0x800)
+extern const unsigned char tr_foldmatch_fast[2048];
+extern const unsigned char tr_foldmatch_aid[16];
 
 #define TR_FOLDMATCH_DEFAULT (0)
 #define TR_FOLDMATCH_LITERAL_START (1)
@@ -210,5 +255,8 @@ extern const string_desc tr_foldmatch_ott[3];
 extern const unsigned char tr_color_itt[256];
 extern const unsigned short tr_color_sot[37];
 extern const unsigned short tr_color_sbt[2245];
+#define TR_COLOR_FAST_LIMIT (0x800)
+extern const unsigned char tr_color_fast[2048];
+extern const unsigned char tr_color_aid[16];
 
 #endif // UTF8TABLES_H
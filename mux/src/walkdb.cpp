@@ -10,6 +10,11 @@
 #include "config.h"
 #include "externs.h"
 
+#if defined(HAVE_PTHREAD_H)
+#include <pthread.h>
+#include <signal.h>
+#endif // HAVE_PTHREAD_H
+
 #include "attrs.h"
 #include "command.h"
 #include "mathutil.h"
@@ -153,43 +158,55 @@ bool get_stats(dbref player, dbref who, STATS *info)
     info->s_players = 0;
     info->s_garbage = 0;
 
+    if (who == NOTHING)
+    {
+        // The reverse index keeps a running count of each type.
+        //
+        info->s_total   = mudstate.db_top;
+        info->s_rooms   = rx_census(TYPE_ROOM, false) + rx_census(TYPE_ROOM, true);
+        info->s_exits   = rx_census(TYPE_EXIT, false);
+        info->s_things  = rx_census(TYPE_THING, false);
+        info->s_players = rx_census(TYPE_PLAYER, false);
+        info->s_garbage = info->s_total - info->s_rooms - info->s_exits
+                        - info->s_things - info->s_players;
+        return true;
+    }
+
     dbref i;
-    DO_WHOLE_DB(i)
+    DO_RX(i, RX_OWNER, who)
     {
-        if ((who == NOTHING) || (who == Owner(i)))
+        info->s_total++;
+        int iType = ScanTypeof(i);
+        if (ScanGoing(i) && (iType != TYPE_ROOM))
         {
-            info->s_total++;
-            if (Going(i) && (Typeof(i) != TYPE_ROOM))
-            {
-                info->s_garbage++;
-                continue;
-            }
-            switch (Typeof(i))
-            {
-            case TYPE_ROOM:
+            info->s_garbage++;
+            continue;
+        }
+        switch (iType)
+        {
+        case TYPE_ROOM:
 
-                info->s_rooms++;
-                break;
+            info->s_rooms++;
+            break;
 
-            case TYPE_EXIT:
+        case TYPE_EXIT:
 
-                info->s_exits++;
-                break;
+            info->s_exits++;
+            break;
 
-            case TYPE_THING:
+        case TYPE_THING:
 
-                info->s_things++;
-                break;
+            info->s_things++;
+            break;
 
-            case TYPE_PLAYER:
+        case TYPE_PLAYER:
 
-                info->s_players++;
-                break;
+            info->s_players++;
+            break;
 
-            default:
+        default:
 
-                info->s_garbage++;
-            }
+            info->s_garbage++;
         }
     }
     return true;
@@ -278,7 +295,7 @@ int chown_all(dbref from_player, dbref to_player, dbref acting_player, int key)
     }
     else
     {
-        int i;
+        dbref i, next;
         int quota_out = 0;
         int quota_in  = 0;
 
@@ -288,10 +305,9 @@ int chown_all(dbref from_player, dbref to_player, dbref acting_player, int key)
 
         TranslateFlags_Chown(clearflags.word, setflags.word, &bClearPowers, acting_player, key);
 
-        DO_WHOLE_DB(i)
+        SAFE_DO_RX(i, next, RX_OWNER, from_player)
         {
-            if (  Owner(i) == from_player
-               && Owner(i) != i)
+            if (Owner(i) != i)
             {
                 switch (Typeof(i))
                 {
@@ -777,87 +793,324 @@ bool search_setup(dbref player, UTF8 *searchfor, SEARCH *parm)
     return true;
 }
 
-void search_perform(dbref executor, dbref caller, dbref enactor, SEARCH *parm)
+// search_candidates: When the search is restricted by owner, parent, zone,
+// or type, returns the shortest matching reverse index list in dbref order.
+// Otherwise, *pn is -1 and the whole range must be scanned.
+//
+static dbref *search_candidates(SEARCH *parm, int *pn)
 {
-    POWER thing1powers, thing2powers;
-    UTF8 *result, *bp;
+    int   ix[4];
+    dbref key[4];
+    int   nix = 0;
 
-    UTF8 *buff = alloc_sbuf("search_perform.num");
-    int save_invk_ctr = mudstate.func_invk_ctr;
-
-    dbref thing;
-    for (thing = parm->low_bound; thing <= parm->high_bound; thing++)
+    if (parm->s_rst_owner != ANY_OWNER)
     {
-        mudstate.func_invk_ctr = save_invk_ctr;
+        ix[nix] = RX_OWNER;
+        key[nix++] = parm->s_rst_owner;
+    }
+    if (parm->s_parent != NOTHING)
+    {
+        ix[nix] = RX_PARENT;
+        key[nix++] = parm->s_parent;
+    }
+    if (parm->s_zone != NOTHING)
+    {
+        ix[nix] = RX_ZONE;
+        key[nix++] = parm->s_zone;
+    }
+    if (parm->s_rst_type != NOTYPE)
+    {
+        ix[nix] = RX_TYPE;
+        key[nix++] = parm->s_rst_type;
+    }
 
-        // Check for matching type.
-        //
-        if (  (parm->s_rst_type != NOTYPE)
-           && (parm->s_rst_type != Typeof(thing)))
+    int iBest = -1;
+    int nBest = 0;
+    for (int i = 0; i < nix; i++)
+    {
+        int n;
+        if (RX_TYPE == ix[i])
         {
-            continue;
+            n = rx_census(key[i], false) + rx_census(key[i], true);
         }
+        else
+        {
+            n = rx_gather(ix[i], key[i], NULL);
+        }
+        if (  iBest < 0
+           || n < nBest)
+        {
+            iBest = i;
+            nBest = n;
+        }
+    }
 
-        // Check for matching owner.
-        //
-        if (  (parm->s_rst_owner != ANY_OWNER)
-           && (parm->s_rst_owner != Owner(thing)))
+    if (iBest < 0)
+    {
+        *pn = -1;
+        return NULL;
+    }
+    return rx_sorted(ix[iBest], key[iBest], pn);
+}
+
+// search_match: Tests everything about a search except the name and EVAL
+// classes.  It only reads the object header and the scan columns, so it is
+// safe to call from the search worker threads while the main thread waits
+// for them.
+//
+static bool search_match(SEARCH *parm, dbref thing)
+{
+    // Check for matching type.
+    //
+    if (  (parm->s_rst_type != NOTYPE)
+       && (parm->s_rst_type != ScanTypeof(thing)))
+    {
+        return false;
+    }
+
+    // Check for matching owner.
+    //
+    if (  (parm->s_rst_owner != ANY_OWNER)
+       && (parm->s_rst_owner != ScanOwner(thing)))
+    {
+        return false;
+    }
+
+    // Toss out destroyed things.
+    //
+    if (ScanGoing(thing))
+    {
+        return false;
+    }
+
+    // Check for matching parent.
+    //
+    if (  (parm->s_parent != NOTHING)
+       && (parm->s_parent != ScanParent(thing)))
+    {
+        return false;
+    }
+
+    // Check for matching zone.
+    //
+    if (  (parm->s_zone != NOTHING)
+       && (parm->s_zone != ScanZone(thing)))
+    {
+        return false;
+    }
+
+    // Check for matching flags.
+    //
+    for (int i = FLAG_WORD1; i <= FLAG_WORD3; i++)
+    {
+        FLAG f = parm->s_fset.word[i];
+        if ((ScanFlags(thing, i) & f) != f)
         {
-            continue;
+            return false;
         }
+    }
 
-        // Toss out destroyed things.
-        //
-        if (Going(thing))
+    // Check for matching power.
+    //
+    if ((Powers(thing) & parm->s_pset.word1) != parm->s_pset.word1)
+    {
+        return false;
+    }
+    if ((Powers2(thing) & parm->s_pset.word2) != parm->s_pset.word2)
+    {
+        return false;
+    }
+    return true;
+}
+
+// A slice of the candidates for a search.  The candidates are aList[iFirst]
+// through aList[iLast-1] or, without a list, dbrefs iFirst through iLast-1.
+// Matches are written to aMatch, which has room for every candidate.
+//
+typedef struct
+{
+    SEARCH *parm;
+    dbref  *aList;
+    int     iFirst;
+    int     iLast;
+    dbref  *aMatch;
+    int     nMatch;
+} SEARCH_SLICE;
+
+static void *search_slice(void *arg)
+{
+    SEARCH_SLICE *ps = (SEARCH_SLICE *)arg;
+    for (int k = ps->iFirst; k < ps->iLast; k++)
+    {
+        dbref thing = (NULL == ps->aList) ? k : ps->aList[k];
+        if (search_match(ps->parm, thing))
         {
-            continue;
+            ps->aMatch[ps->nMatch++] = thing;
         }
+    }
+    return NULL;
+}
 
-        // Check for matching parent.
-        //
-        if (  (parm->s_parent != NOTHING)
-           && (parm->s_parent != Parent(thing)))
+#if defined(HAVE_PTHREAD_H)
+
+// Slices smaller than this are not worth a thread.
+//
+#define SEARCH_MIN_SLICE    8192
+#define SEARCH_MAX_THREADS  16
+
+#endif // HAVE_PTHREAD_H
+
+// search_prefilter: Returns the objects which pass search_match() in dbref
+// order.  A large scan is cut into contiguous slices which are handed to
+// worker threads, so joining the per-slice results in slice order keeps the
+// dbref order.
+//
+static dbref *search_prefilter(SEARCH *parm, int *pn)
+{
+    int n;
+    int iFirst, iLast;
+    dbref *aList = search_candidates(parm, &n);
+    if (n < 0)
+    {
+        iFirst = parm->low_bound;
+        iLast  = parm->high_bound + 1;
+    }
+    else
+    {
+        iFirst = 0;
+        while (  iFirst < n
+              && aList[iFirst] < parm->low_bound)
         {
-            continue;
+            iFirst++;
+        }
+        iLast = n;
+        while (  iFirst < iLast
+              && parm->high_bound < aList[iLast-1])
+        {
+            iLast--;
         }
+    }
 
-        // Check for matching zone.
-        //
-        if (  (parm->s_zone != NOTHING)
-           && (parm->s_zone != Zone(thing)))
+    *pn = 0;
+    if (iLast <= iFirst)
+    {
+        if (NULL != aList)
         {
-            continue;
+            MEMFREE(aList);
         }
+        return NULL;
+    }
 
-        // Check for matching flags.
-        //
-        bool b = false;
-        for (int i = FLAG_WORD1; i <= FLAG_WORD3; i++)
+    dbref *aMatch = (dbref *)MEMALLOC((iLast - iFirst) * sizeof(dbref));
+    ISOUTOFMEMORY(aMatch);
+
+    int nSlices = 1;
+#if defined(HAVE_PTHREAD_H)
+    if (1 < mudconf.search_threads)
+    {
+        nSlices = (iLast - iFirst) / SEARCH_MIN_SLICE;
+        if (mudconf.search_threads < nSlices)
         {
-            FLAG f = parm->s_fset.word[i];
-            if ((db[thing].fs.word[i] & f) != f)
-            {
-                b = true;
-                break;
-            }
+            nSlices = mudconf.search_threads;
         }
-        if (b)
+        if (SEARCH_MAX_THREADS < nSlices)
         {
-            continue;
+            nSlices = SEARCH_MAX_THREADS;
+        }
+        if (nSlices < 1)
+        {
+            nSlices = 1;
         }
+    }
+#endif // HAVE_PTHREAD_H
 
-        // Check for matching power.
+    if (1 == nSlices)
+    {
+        SEARCH_SLICE ss;
+        ss.parm   = parm;
+        ss.aList  = aList;
+        ss.iFirst = iFirst;
+        ss.iLast  = iLast;
+        ss.aMatch = aMatch;
+        ss.nMatch = 0;
+        search_slice(&ss);
+        *pn = ss.nMatch;
+    }
+#if defined(HAVE_PTHREAD_H)
+    else
+    {
+        // Each slice writes to its own part of aMatch.  The main thread
+        // takes the first slice itself.  Signals are blocked in the workers
+        // so that they are always delivered to the main thread.
         //
-        thing1powers = Powers(thing);
-        thing2powers = Powers2(thing);
-        if ((thing1powers & parm->s_pset.word1) != parm->s_pset.word1)
+        SEARCH_SLICE ss[SEARCH_MAX_THREADS];
+        pthread_t    tid[SEARCH_MAX_THREADS];
+        bool         bStarted[SEARCH_MAX_THREADS];
+        int nTotal = iLast - iFirst;
+        int i;
+        for (i = 0; i < nSlices; i++)
         {
-            continue;
+            ss[i].parm   = parm;
+            ss[i].aList  = aList;
+            ss[i].iFirst = iFirst + (int)(((INT64)nTotal * i) / nSlices);
+            ss[i].iLast  = iFirst + (int)(((INT64)nTotal * (i+1)) / nSlices);
+            ss[i].aMatch = aMatch + (ss[i].iFirst - iFirst);
+            ss[i].nMatch = 0;
+            bStarted[i]  = false;
         }
-        if ((thing2powers & parm->s_pset.word2) != parm->s_pset.word2)
+
+        sigset_t all, old;
+        sigfillset(&all);
+        pthread_sigmask(SIG_SETMASK, &all, &old);
+        for (i = 1; i < nSlices; i++)
         {
-            continue;
+            bStarted[i] = (0 == pthread_create(&tid[i], NULL, search_slice, &ss[i]));
+        }
+        pthread_sigmask(SIG_SETMASK, &old, NULL);
+
+        search_slice(&ss[0]);
+        int nMatch = ss[0].nMatch;
+        for (i = 1; i < nSlices; i++)
+        {
+            if (bStarted[i])
+            {
+                pthread_join(tid[i], NULL);
+            }
+            else
+            {
+                search_slice(&ss[i]);
+            }
+            memmove(aMatch + nMatch, ss[i].aMatch, ss[i].nMatch * sizeof(dbref));
+            nMatch += ss[i].nMatch;
         }
+        *pn = nMatch;
+    }
+#endif // HAVE_PTHREAD_H
+
+    if (NULL != aList)
+    {
+        MEMFREE(aList);
+        aList = NULL;
+    }
+    return aMatch;
+}
+
+void search_perform(dbref executor, dbref caller, dbref enactor, SEARCH *parm)
+{
+    UTF8 *result, *bp;
+
+    UTF8 *buff = alloc_sbuf("search_perform.num");
+    int save_invk_ctr = mudstate.func_invk_ctr;
+
+    // The name and EVAL tests are not thread-safe, so they are made here,
+    // over only what the prefilter leaves.
+    //
+    int n;
+    dbref *aMatch = search_prefilter(parm, &n);
+    for (int k = 0; k < n; k++)
+    {
+        dbref thing = aMatch[k];
+        mudstate.func_invk_ctr = save_invk_ctr;
 
         // Check for matching name.
         //
@@ -891,6 +1144,11 @@ void search_perform(dbref executor, dbref caller, dbref enactor, SEARCH *parm)
         //
         olist_add(thing);
     }
+    if (NULL != aMatch)
+    {
+        MEMFREE(aMatch);
+        aMatch = NULL;
+    }
     free_sbuf(buff);
     mudstate.func_invk_ctr = save_invk_ctr;
 }
@@ -498,3 +498,428 @@ bool wild_match(UTF8 *tstr, const UTF8 *dstr)
     mudstate.wild_invk_ctr = 0;
     return quick_wild(tstr, dstr);
 }
+
+// ---------------------------------------------------------------------------
+// Compiled wildcard patterns.
+//
+// $-command patterns are matched against every command typed, so rather than
+// re-interpreting the pattern text each time, wild_compile() turns it into a
+// flat list of operations: lower-cased literals, '?', and '*'.  The
+// operations before the first '*' are matched in place.  Each '*' is then
+// followed by a fixed-length segment of literals and '?'s.  An interior
+// segment is placed at the earliest position where it matches (which is the
+// shortest '*' and gives the same captures as wild1()), and the last segment
+// is anchored to the end of the data.  No backtracking is required.
+//
+// As with wild1(), a '?' which directly follows a '*' (possibly through other
+// '?'s) consumes one byte, while a '?' elsewhere consumes one code point.
+// Once every capture has been used, a '?' consumes one byte, as quick_wild()
+// does.
+//
+#define WOP_LITERAL  0
+#define WOP_ONE      1
+#define WOP_ONE_UTF8 2
+#define WOP_STAR     3
+
+struct wild_program
+{
+    size_t nSize;       // Bytes allocated.
+    size_t nOps;
+    size_t nPrefix;     // Number of leading literals.
+    bool   bWild;       // Pattern contains '*' or '?'.
+    UTF8  *pOps;
+    UTF8  *pChars;
+};
+
+WILD_PROGRAM *wild_compile(const UTF8 *tstr)
+{
+    size_t n = strlen((const char *)tstr);
+    WILD_PROGRAM *pwp = (WILD_PROGRAM *)MEMALLOC(sizeof(WILD_PROGRAM) + 2*n);
+    ISOUTOFMEMORY(pwp);
+    pwp->nSize   = sizeof(WILD_PROGRAM) + 2*n;
+    pwp->pOps    = (UTF8 *)(pwp + 1);
+    pwp->pChars  = pwp->pOps + n;
+    pwp->nOps    = 0;
+    pwp->nPrefix = 0;
+    pwp->bWild   = false;
+
+    bool bByte = false;
+    while ('\0' != *tstr)
+    {
+        UTF8 op;
+        UTF8 ch = '\0';
+        switch (*tstr)
+        {
+        case '*':
+
+            op = WOP_STAR;
+            bByte = true;
+            break;
+
+        case '?':
+
+            op = bByte ? WOP_ONE : WOP_ONE_UTF8;
+            break;
+
+        case '\\':
+
+            // Escape character.  A trailing backslash is ignored.
+            //
+            tstr++;
+            if ('\0' == *tstr)
+            {
+                continue;
+            }
+
+            // FALL THROUGH
+
+        default:
+
+            op = WOP_LITERAL;
+            ch = mux_tolower_ascii(*tstr);
+            break;
+        }
+
+        if (WOP_LITERAL != op)
+        {
+            pwp->bWild = true;
+        }
+        else
+        {
+            bByte = false;
+            if (!pwp->bWild)
+            {
+                pwp->nPrefix++;
+            }
+        }
+        pwp->pOps[pwp->nOps]   = op;
+        pwp->pChars[pwp->nOps] = ch;
+        pwp->nOps++;
+        tstr++;
+    }
+    return pwp;
+}
+
+void wild_free(WILD_PROGRAM *pwp)
+{
+    if (NULL != pwp)
+    {
+        MEMFREE(pwp);
+    }
+}
+
+size_t wild_size(const WILD_PROGRAM *pwp)
+{
+    return (NULL == pwp) ? 0 : pwp->nSize;
+}
+
+// wild_segment: Match the '*'-free operations [iOp, iOp+nOps) at exactly
+// dstr, recording captures starting at *piCap.  Returns the end of the match,
+// or NULL if it does not match.
+//
+static const UTF8 *wild_segment(const WILD_PROGRAM *pwp, size_t iOp,
+    size_t nOps, const UTF8 *dstr, int *piCap, int nargs,
+    const UTF8 *aStart[], size_t aLen[])
+{
+    for (size_t i = iOp; i < iOp + nOps; i++)
+    {
+        size_t t = 1;
+        switch (pwp->pOps[i])
+        {
+        case WOP_LITERAL:
+
+            if (mux_tolower_ascii(*dstr) != pwp->pChars[i])
+            {
+                return NULL;
+            }
+            dstr++;
+            continue;
+
+        case WOP_ONE_UTF8:
+
+            if (*piCap < nargs)
+            {
+                if (  '\0' == dstr[0]
+                   || UTF8_CONTINUE <= (t = utf8_FirstByte[*dstr]))
+                {
+                    return NULL;
+                }
+
+                for (size_t j = 1; j < t; j++)
+                {
+                    if (  '\0' == dstr[j]
+                       || UTF8_CONTINUE != utf8_FirstByte[dstr[j]])
+                    {
+                        return NULL;
+                    }
+                }
+            }
+
+            // FALL THROUGH
+
+        case WOP_ONE:
+
+            if ('\0' == *dstr)
+            {
+                return NULL;
+            }
+            break;
+        }
+
+        if (*piCap < nargs)
+        {
+            aStart[*piCap] = dstr;
+            aLen[*piCap]   = t;
+        }
+        (*piCap)++;
+        dstr += t;
+    }
+    return dstr;
+}
+
+// ---------------------------------------------------------------------------
+// wild_exec: do a compiled wildcard match, remembering the wild data.
+//
+// The results in args[] are the same as wild() would return for the source
+// pattern.
+//
+bool wild_exec(const WILD_PROGRAM *pwp, const UTF8 *dstr, UTF8 *args[], int nargs)
+{
+    mudstate.wild_invk_ctr = 0;
+
+    int i;
+    for (i = 0; i < nargs; i++)
+    {
+        args[i] = NULL;
+    }
+    if (NUM_ENV_VARS < nargs)
+    {
+        nargs = NUM_ENV_VARS;
+    }
+
+    const UTF8 *aStart[NUM_ENV_VARS];
+    size_t      aLen[NUM_ENV_VARS];
+    int iCap = 0;
+
+    // Match everything up to the first '*' in place.
+    //
+    size_t iOp = 0;
+    while (  iOp < pwp->nOps
+          && WOP_STAR != pwp->pOps[iOp])
+    {
+        iOp++;
+    }
+
+    dstr = wild_segment(pwp, 0, iOp, dstr, &iCap, nargs, aStart, aLen);
+    if (  NULL == dstr
+       || (  iOp == pwp->nOps
+          && '\0' != *dstr))
+    {
+        return false;
+    }
+
+    while (iOp < pwp->nOps)
+    {
+        // pOps[iOp] is a '*'.  Find the segment which follows it.
+        //
+        int iStar = iCap++;
+        iOp++;
+        size_t iSeg = iOp;
+        while (  iOp < pwp->nOps
+              && WOP_STAR != pwp->pOps[iOp])
+        {
+            iOp++;
+        }
+        size_t nSeg = iOp - iSeg;
+        bool bLast = (iOp == pwp->nOps);
+
+        // Place the segment at the earliest position it matches.  The last
+        // segment must also end with the data.
+        //
+        const UTF8 *p;
+        const UTF8 *pEnd;
+        int iNext;
+        for (p = dstr; ; p++)
+        {
+            if (mudstate.wild_invk_ctr >= mudconf.wild_invk_lim)
+            {
+                return false;
+            }
+            mudstate.wild_invk_ctr++;
+
+            iNext = iCap;
+            pEnd = wild_segment(pwp, iSeg, nSeg, p, &iNext, nargs, aStart, aLen);
+            if (  NULL != pEnd
+               && (  !bLast
+                  || '\0' == *pEnd))
+            {
+                break;
+            }
+            else if ('\0' == *p)
+            {
+                return false;
+            }
+        }
+
+        if (iStar < nargs)
+        {
+            aStart[iStar] = dstr;
+            aLen[iStar]   = p - dstr;
+        }
+        iCap = iNext;
+        dstr = pEnd;
+    }
+
+    // Fill in the non-empty arguments.
+    //
+    if (nargs < iCap)
+    {
+        iCap = nargs;
+    }
+    for (i = 0; i < iCap; i++)
+    {
+        if (0 < aLen[i])
+        {
+            args[i] = alloc_lbuf("wild_exec");
+            mux_strncpy(args[i], aStart[i], aLen[i] < LBUF_SIZE-1 ? aLen[i] : LBUF_SIZE-1);
+        }
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Multi-pattern prefilter.
+//
+// $-command patterns are anchored at the start of the command, so the
+// Aho-Corasick goto function alone (a trie over each pattern's literal
+// prefix) is enough: one walk down the trie along the command text visits
+// every pattern whose prefix the command begins with.  Patterns with no
+// literal prefix hang off the root and are always candidates.
+//
+typedef struct
+{
+    UTF8 ch;
+    int  iChild;
+    int  iSibling;
+    int  iOutput;
+} WILD_TRIE_NODE;
+
+struct wild_prefilter
+{
+    size_t          nSize;      // Bytes allocated.
+    int             nNodes;
+    int             nPatterns;
+    WILD_TRIE_NODE *aNodes;
+    int            *aNextOutput;
+};
+
+WILD_PREFILTER *wild_prefilter_build(WILD_PROGRAM *apwp[], int nPatterns)
+{
+    int i;
+    size_t nNodes = 1;
+    for (i = 0; i < nPatterns; i++)
+    {
+        if (NULL != apwp[i])
+        {
+            nNodes += apwp[i]->nPrefix;
+        }
+    }
+
+    size_t nSize = sizeof(WILD_PREFILTER) + nNodes*sizeof(WILD_TRIE_NODE)
+                 + nPatterns*sizeof(int);
+    WILD_PREFILTER *pwpf = (WILD_PREFILTER *)MEMALLOC(nSize);
+    ISOUTOFMEMORY(pwpf);
+    pwpf->nSize       = nSize;
+    pwpf->aNodes      = (WILD_TRIE_NODE *)(pwpf + 1);
+    pwpf->aNextOutput = (int *)(pwpf->aNodes + nNodes);
+    pwpf->nPatterns   = nPatterns;
+    pwpf->nNodes      = 1;
+    pwpf->aNodes[0].ch       = '\0';
+    pwpf->aNodes[0].iChild   = -1;
+    pwpf->aNodes[0].iSibling = -1;
+    pwpf->aNodes[0].iOutput  = -1;
+
+    for (i = 0; i < nPatterns; i++)
+    {
+        pwpf->aNextOutput[i] = -1;
+        if (NULL == apwp[i])
+        {
+            continue;
+        }
+
+        int iNode = 0;
+        for (size_t j = 0; j < apwp[i]->nPrefix; j++)
+        {
+            UTF8 ch = apwp[i]->pChars[j];
+            int iChild = pwpf->aNodes[iNode].iChild;
+            while (  -1 != iChild
+                  && pwpf->aNodes[iChild].ch != ch)
+            {
+                iChild = pwpf->aNodes[iChild].iSibling;
+            }
+
+            if (-1 == iChild)
+            {
+                iChild = pwpf->nNodes++;
+                pwpf->aNodes[iChild].ch       = ch;
+                pwpf->aNodes[iChild].iChild   = -1;
+                pwpf->aNodes[iChild].iSibling = pwpf->aNodes[iNode].iChild;
+                pwpf->aNodes[iChild].iOutput  = -1;
+                pwpf->aNodes[iNode].iChild    = iChild;
+            }
+            iNode = iChild;
+        }
+        pwpf->aNextOutput[i] = pwpf->aNodes[iNode].iOutput;
+        pwpf->aNodes[iNode].iOutput = i;
+    }
+    return pwpf;
+}
+
+void wild_prefilter_free(WILD_PREFILTER *pwpf)
+{
+    if (NULL != pwpf)
+    {
+        MEMFREE(pwpf);
+    }
+}
+
+size_t wild_prefilter_size(const WILD_PREFILTER *pwpf)
+{
+    return (NULL == pwpf) ? 0 : pwpf->nSize;
+}
+
+// wild_prefilter_scan: Set abCandidate[i] for every pattern which could match
+// dstr.  Patterns which were NULL at build time are left alone.
+//
+void wild_prefilter_scan(const WILD_PREFILTER *pwpf, const UTF8 *dstr,
+    bool abCandidate[])
+{
+    int iNode = 0;
+    for (;;)
+    {
+        for (int i = pwpf->aNodes[iNode].iOutput; -1 != i; i = pwpf->aNextOutput[i])
+        {
+            abCandidate[i] = true;
+        }
+
+        if ('\0' == *dstr)
+        {
+            return;
+        }
+
+        UTF8 ch = mux_tolower_ascii(*dstr);
+        int iChild = pwpf->aNodes[iNode].iChild;
+        while (  -1 != iChild
+              && pwpf->aNodes[iChild].ch != ch)
+        {
+            iChild = pwpf->aNodes[iChild].iSibling;
+        }
+
+        if (-1 == iChild)
+        {
+            return;
+        }
+        iNode = iChild;
+        dstr++;
+    }
+}
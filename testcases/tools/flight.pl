@@ -0,0 +1,129 @@
+#!/usr/bin/perl
+#
+#	flight.pl - Decode the flight recorder file netmux writes when it
+#	            catches a fatal signal, SIGTERM, or SIGQUIT.
+#
+# Usage:
+#
+#   ./tools/flight.pl [--last 200] [--type command,queue,dump,cache,alloc]
+#                     [game/netmux.flight]
+#
+# The events are printed oldest first.  Each line gives the time in UTC,
+# how long before the file was written it happened, the event type, the
+# executor and enactor, a value, and a short text:
+#
+#   command  Command finished.  Value is wall time.  Text is the built-in
+#            command it dispatched to, or (other).
+#   queue    Queue entry finished.  Value is wall time.  Text is the start
+#            of the queued command.
+#   dump     'stall' is how long a dump held up the game, and 'done' is how
+#            long the forked dump took.
+#   cache    Attribute cache entries evicted since the last cache event.
+#   alloc    Large allocation.  Value is bytes.
+#   signal   The signal which wrote the file.  Text is the command running.
+#
+# The file is in the byte order of the machine which wrote it, so decode it
+# on the same kind of machine.
+#
+use strict;
+use warnings;
+use Getopt::Long;
+use POSIX qw(strftime);
+
+my $last  = 0;
+my $types = '';
+
+GetOptions(
+    'last=i' => \$last,
+    'type=s' => \$types,
+) or die "Bad options.  See the top of $0 for usage.\n";
+
+my $file = shift(@ARGV) || 'netmux.flight';
+
+my %TYPE_NAMES = (
+    1 => 'command',
+    2 => 'queue',
+    3 => 'dump',
+    4 => 'cache',
+    5 => 'alloc',
+    6 => 'signal',
+);
+
+# CLinearTimeAbsolute counts 100ns ticks from January 1, 1601.
+#
+my $EPOCH_OFFSET = 116444736000000000;
+
+my %want;
+foreach my $t (split /,/, $types) {
+    die "Unknown event type '$t'.\n"
+        unless grep { $_ eq $t } values %TYPE_NAMES;
+    $want{$t} = 1;
+}
+
+open(my $fh, '<', $file) or die "Cannot open $file: $!\n";
+binmode($fh);
+local $/;
+my $data = <$fh>;
+close($fh);
+
+my $HEADER_SIZE = 32;
+die "$file is too short.\n" if length($data) < $HEADER_SIZE;
+
+my ($magic, $nEvents, $nEventSize, $nNext, $iSignal, $tWritten)
+    = unpack('a8 L L L l q', substr($data, 0, $HEADER_SIZE));
+die "$file is not a flight recorder file.\n" unless $magic eq 'MUXFLT01';
+die "$file has events of $nEventSize bytes, not 64.\n" unless $nEventSize == 64;
+die "$file is truncated.\n"
+    if length($data) < $HEADER_SIZE + $nEvents * $nEventSize;
+
+my @events;
+for (my $i = 0; $i < $nEvents; $i++) {
+    my ($nSeq, $iType, undef, $tWhen, $executor, $enactor, $nValue, $text)
+        = unpack('L S S q l l q Z32',
+                 substr($data, $HEADER_SIZE + $i * $nEventSize, $nEventSize));
+
+    # Empty slots, and slots which were being written when the file was,
+    # have a zero sequence number.
+    #
+    next if $nSeq == 0;
+
+    my $type = $TYPE_NAMES{$iType} || "type$iType";
+    next if %want && !$want{$type};
+    push @events, [$nSeq, $type, $tWhen, $executor, $enactor, $nValue, $text];
+}
+@events = sort { $a->[0] <=> $b->[0] } @events;
+splice(@events, 0, @events - $last) if $last > 0 && @events > $last;
+
+sub format_time {
+    my ($t) = @_;
+    my $us = int(($t - $EPOCH_OFFSET) / 10);
+    my $s  = int($us / 1000000);
+    return strftime('%Y-%m-%d %H:%M:%S', gmtime($s))
+         . sprintf('.%06d', $us - $s * 1000000);
+}
+
+sub format_dbref {
+    my ($d) = @_;
+    return $d < 0 ? '-' : "#$d";
+}
+
+sub format_value {
+    my ($type, $n) = @_;
+    if ($type eq 'command' || $type eq 'queue' || $type eq 'dump') {
+        return sprintf('%.3fms', $n / 1000);
+    } elsif ($type eq 'alloc') {
+        return "${n}B";
+    }
+    return $n;
+}
+
+printf("%s: written %s by signal %d, %u events recorded, %d kept\n",
+    $file, format_time($tWritten), $iSignal, $nNext, scalar @events);
+
+foreach my $e (@events) {
+    my ($nSeq, $type, $tWhen, $executor, $enactor, $nValue, $text) = @$e;
+    printf("%s %10.3fs %-7s %7s %7s %12s  %s\n",
+        format_time($tWhen), ($tWritten - $tWhen) / 10000000, $type,
+        format_dbref($executor), format_dbref($enactor),
+        format_value($type, $nValue), $text);
+}
@@ -0,0 +1,391 @@
+#!/usr/bin/perl
+#
+#	loadgen.pl - Drive a running netmux with many simultaneous telnet
+#	             clients and report throughput and round-trip latency.
+#
+# Usage:
+#
+#   ./tools/loadgen.pl [--host localhost] [--port 2860] [--clients 100]
+#                      [--rooms 1] [--duration 30] [--think 1000]
+#                      [--rate 100] [--timeout 10]
+#                      [--mix say=30,pose=20,channel=20,mail=10,dollar=20]
+#                      [--wizard #1] [--password potrzebie]
+#
+# The wizard connection creates the players (Load1, Load2, ...), the rooms,
+# a LoadGen channel, and an object in each room with a $lgcmd command.  The
+# clients then connect at --rate per second, join the channel, move into
+# their room, and each replays the --mix of say, pose, channel, @mail, and
+# $-command traffic with an exponentially-distributed think time averaging
+# --think milliseconds (0 is closed-loop).
+#
+# Every client sets OUTPUTSUFFIX, so a command's round trip ends when its
+# suffix comes back.  A $-command also waits for the @pemit from the queue.
+# Only commands sent after every client has logged in are measured.
+#
+# Each connection is a file descriptor on both sides, so raise 'ulimit -n'
+# for both netmux and this script before asking for more than about 1000
+# clients.  Use a scratch database.  The players, rooms, and mail stay.
+#
+use strict;
+use warnings;
+use Getopt::Long;
+use IO::Socket::INET;
+use IO::Poll qw(POLLIN POLLOUT POLLERR POLLHUP);
+use Time::HiRes qw(time sleep);
+
+my $host     = 'localhost';
+my $port     = 2860;
+my $clients  = 100;
+my $rooms    = 1;
+my $duration = 30;
+my $think    = 1000;
+my $rate     = 100;
+my $timeout  = 10;
+my $mix      = 'say=30,pose=20,channel=20,mail=10,dollar=20';
+my $wizard   = '#1';
+my $wizpass  = 'potrzebie';
+my $prefix   = 'Load';
+my $password = 'lgpass';
+
+GetOptions(
+    'host=s'     => \$host,
+    'port=i'     => \$port,
+    'clients=i'  => \$clients,
+    'rooms=i'    => \$rooms,
+    'duration=i' => \$duration,
+    'think=i'    => \$think,
+    'rate=i'     => \$rate,
+    'timeout=i'  => \$timeout,
+    'mix=s'      => \$mix,
+    'wizard=s'   => \$wizard,
+    'password=s' => \$wizpass,
+    'prefix=s'   => \$prefix,
+) or die "Bad options.  See the top of $0 for usage.\n";
+
+$rooms = 1 if $rooms < 1;
+$rate  = 1 if $rate < 1;
+
+my $MARKER = 'LOADGEN-DONE';
+
+# Traffic mix: a list of [name, weight].
+#
+my @mix;
+my $total_weight = 0;
+foreach my $item (split /,/, $mix) {
+    my ($name, $weight) = split /=/, $item;
+    die "Unknown command type '$name'.\n"
+        unless $name =~ /^(say|pose|channel|mail|dollar)$/;
+    push @mix, [$name, $weight];
+    $total_weight += $weight;
+}
+die "The mix is empty.\n" unless $total_weight > 0;
+
+sub pick_type {
+    my $r = rand($total_weight);
+    foreach my $m (@mix) {
+        return $m->[0] if ($r -= $m->[1]) < 0;
+    }
+    return $mix[-1][0];
+}
+
+sub open_socket {
+    my $s = IO::Socket::INET->new(
+        PeerAddr => $host,
+        PeerPort => $port,
+        Proto    => 'tcp',
+        Timeout  => 5,
+    );
+    return $s;
+}
+
+#############################################################################
+# Setup through the wizard connection.
+#############################################################################
+
+# Sends a list of commands down a blocking socket and collects the output
+# until every one of them has returned its suffix.
+#
+sub wiz_run {
+    my ($s, @cmds) = @_;
+    my $out = '';
+    my $want = scalar @cmds;
+    my $batch = join('', map { "$_\r\n" } @cmds);
+    syswrite($s, $batch) == length($batch) or die "Wizard write failed.\n";
+    my $deadline = time + $timeout + $want / 100;
+    my $seen = 0;
+    while ($seen < $want) {
+        die "Wizard setup timed out.\n" if time > $deadline;
+        my $buf;
+        my $n = sysread($s, $buf, 65536);
+        die "Wizard connection closed.\n" unless $n;
+        $out .= $buf;
+        $seen = () = $out =~ /^\Q$MARKER\E\r?$/mg;
+    }
+    return $out;
+}
+
+my $wiz = open_socket() or die "Can't connect to $host:$port: $!\n";
+syswrite($wiz, "connect $wizard $wizpass\r\nOUTPUTSUFFIX $MARKER\r\n");
+wiz_run($wiz, 'think');
+
+print "Creating $clients players.\n";
+for (my $i = 1; $i <= $clients; $i += 200) {
+    my $last = $i + 199;
+    $last = $clients if $last > $clients;
+    wiz_run($wiz, map { "\@pcreate $prefix$_=$password" } ($i .. $last));
+}
+
+my $out = wiz_run($wiz, '@ccreate LoadGen', '@cset/public LoadGen');
+
+my @room;
+for (my $r = 1; $r <= $rooms; $r++) {
+    $out = wiz_run($wiz, "\@dig LoadGen Room $r");
+    $out =~ /LoadGen Room $r created.*?#(\d+)/ or die "Couldn't dig a room:\n$out";
+    my $room = $1;
+    push @room, $room;
+    $out = wiz_run($wiz, "\@create LoadGen Commands $r");
+    $out =~ /#(\d+)/ or die "Couldn't create an object:\n$out";
+    my $obj = $1;
+    wiz_run($wiz,
+        "\@set #$room=JUMP_OK",
+        "&CMD #$obj=\$lgcmd *:\@pemit %#=%0",
+        "\@tel #$obj=#$room");
+}
+syswrite($wiz, "QUIT\r\n");
+close($wiz);
+
+#############################################################################
+# The clients.
+#############################################################################
+
+my @c;          # Client state, indexed by client number.
+my %by_fd;      # fileno -> client number.
+my $poll = IO::Poll->new();
+
+my %lat;        # Command type -> list of round-trip times.
+my %timeouts;   # Command type -> count.
+my $measuring = 0;
+my $t_start;
+my $logged_in = 0;
+
+sub client_send {
+    my ($k, $text) = @_;
+    $c[$k]{out} .= "$text\r\n";
+    $poll->mask($c[$k]{sock} => POLLIN | POLLOUT);
+}
+
+sub next_wakeup {
+    return time if $think <= 0;
+    return time - log(1 - rand()) * $think / 1000;
+}
+
+sub start_command {
+    my ($k) = @_;
+    my $cl = $c[$k];
+    my $type = pick_type();
+    my $seq = ++$cl->{seq};
+    my $cmd;
+    $cl->{token} = undef;
+    if ($type eq 'say') {
+        $cmd = "say lg $seq";
+    } elsif ($type eq 'pose') {
+        $cmd = ":lg $seq";
+    } elsif ($type eq 'channel') {
+        $cmd = "lgc lg $seq";
+    } elsif ($type eq 'mail') {
+        my $peer = 1 + int(rand($clients));
+        $cmd = "\@mail/quick $prefix$peer/lg=$seq";
+    } else {
+        $cl->{token} = "lgtok$k.$seq";
+        $cmd = "lgcmd $cl->{token}";
+    }
+    $cl->{type}    = $type;
+    $cl->{sent}    = time;
+    $cl->{marked}  = 0;
+    $cl->{state}   = 'busy';
+    $cl->{measure} = $measuring;
+    client_send($k, $cmd);
+}
+
+sub finish_command {
+    my ($k) = @_;
+    my $cl = $c[$k];
+    push @{$lat{$cl->{type}}}, time - $cl->{sent} if $cl->{measure};
+    $cl->{state} = 'idle';
+    $cl->{wake}  = next_wakeup();
+}
+
+sub client_line {
+    my ($k, $line) = @_;
+    my $cl = $c[$k];
+    if ($line eq $MARKER) {
+        if ($cl->{state} eq 'login') {
+            if (0 == --$cl->{pending}) {
+                $cl->{state} = 'idle';
+                $cl->{wake}  = next_wakeup();
+                $logged_in++;
+            }
+        } elsif ($cl->{state} eq 'busy') {
+            $cl->{marked} = 1;
+            finish_command($k) unless defined $cl->{token};
+        }
+    } elsif (  $cl->{state} eq 'busy'
+            && defined $cl->{token}
+            && $line eq $cl->{token}) {
+        $cl->{token} = undef;
+        finish_command($k) if $cl->{marked};
+    } elsif ($line =~ /^Either that player does not exist/) {
+        die "Client $k couldn't log in as $prefix$k.\n";
+    }
+}
+
+sub client_read {
+    my ($k) = @_;
+    my $cl = $c[$k];
+    my $buf;
+    my $n = sysread($cl->{sock}, $buf, 65536);
+    return if !defined $n && ($!{EAGAIN} || $!{EWOULDBLOCK});
+    if (!$n) {
+        warn "Client $k disconnected.\n";
+        $poll->remove($cl->{sock});
+        delete $by_fd{fileno($cl->{sock})};
+        $logged_in-- if $cl->{state} ne 'login';
+        $cl->{state} = 'dead';
+        return;
+    }
+    $cl->{in} .= $buf;
+    while ($cl->{in} =~ s/^([^\n]*)\n//) {
+        my $line = $1;
+        $line =~ s/\r$//;
+        client_line($k, $line);
+    }
+}
+
+sub client_write {
+    my ($k) = @_;
+    my $cl = $c[$k];
+    my $n = syswrite($cl->{sock}, $cl->{out});
+    if (defined $n) {
+        substr($cl->{out}, 0, $n) = '';
+    }
+    $poll->mask($cl->{sock} => POLLIN) if '' eq $cl->{out};
+}
+
+sub client_open {
+    my ($k) = @_;
+    my $s = open_socket();
+    if (!$s) {
+        warn "Client $k couldn't connect: $!\n";
+        return;
+    }
+    $s->blocking(0);
+    $c[$k] = {
+        sock  => $s,
+        in    => '',
+        out   => '',
+        state => 'login',
+        seq   => 0,
+        pending => 2,
+    };
+    $by_fd{fileno($s)} = $k;
+    my $room = $room[($k - 1) % @room];
+    client_send($k, "connect $prefix$k $password");
+    client_send($k, "OUTPUTSUFFIX $MARKER");
+    client_send($k, "addcom lgc=LoadGen");
+    client_send($k, "\@tel me=#$room");
+}
+
+my $next_open = 1;
+my $t_open = time;
+my $t_end;
+print "Connecting $clients clients.\n";
+
+while (1) {
+    my $now = time;
+
+    # Ramp up connections at --rate per second.
+    #
+    while (  $next_open <= $clients
+          && $next_open <= 1 + ($now - $t_open) * $rate) {
+        client_open($next_open++);
+    }
+
+    if (!$measuring && $next_open > $clients && $logged_in >= $clients) {
+        $measuring = 1;
+        $t_start = $now;
+        $t_end = $now + $duration;
+        printf "All clients logged in after %.1f seconds.  Measuring for %d seconds.\n",
+            $now - $t_open, $duration;
+    }
+    last if $measuring && $now >= $t_end;
+    if (!$measuring && $now - $t_open > $clients / $rate + 60) {
+        die "Only $logged_in of $clients clients logged in.\n";
+    }
+
+    # Start commands for idle clients whose think time is over, and give up
+    # on commands which took too long.
+    #
+    my $wait = 0.05;
+    for (my $k = 1; $k < $next_open; $k++) {
+        my $cl = $c[$k] or next;
+        if ($cl->{state} eq 'idle') {
+            if ($cl->{wake} <= $now) {
+                start_command($k);
+            } elsif ($cl->{wake} - $now < $wait) {
+                $wait = $cl->{wake} - $now;
+            }
+        } elsif ($cl->{state} eq 'busy' && $now - $cl->{sent} > $timeout) {
+            $timeouts{$cl->{type}}++ if $cl->{measure};
+            $cl->{state} = 'idle';
+            $cl->{wake} = $now;
+        }
+    }
+
+    $poll->poll($wait);
+    foreach my $s ($poll->handles(POLLIN | POLLHUP | POLLERR)) {
+        my $k = $by_fd{fileno($s)};
+        client_read($k) if defined $k;
+    }
+    foreach my $s ($poll->handles(POLLOUT)) {
+        my $k = $by_fd{fileno($s)};
+        client_write($k) if defined $k && $c[$k]{state} ne 'dead';
+    }
+}
+my $elapsed = time - $t_start;
+
+#############################################################################
+# Report.
+#############################################################################
+
+sub percentile {
+    my ($sorted, $p) = @_;
+    return 0 unless @$sorted;
+    return $sorted->[int($p * $#$sorted + 0.5)];
+}
+
+my @all;
+printf "\n%-10s %10s %10s %10s %10s %10s %9s\n",
+    'Command', 'Count', 'Cmds/sec', 'p50(ms)', 'p99(ms)', 'Max(ms)', 'Timeouts';
+foreach my $m (@mix) {
+    my $type = $m->[0];
+    my @s = sort { $a <=> $b } @{$lat{$type} || []};
+    push @all, @s;
+    printf "%-10s %10d %10.1f %10.2f %10.2f %10.2f %9d\n", $type, scalar @s,
+        @s / $elapsed, 1000 * percentile(\@s, 0.50),
+        1000 * percentile(\@s, 0.99), 1000 * (@s ? $s[-1] : 0),
+        $timeouts{$type} || 0;
+}
+@all = sort { $a <=> $b } @all;
+my $nto = 0;
+$nto += $_ foreach values %timeouts;
+printf "%-10s %10d %10.1f %10.2f %10.2f %10.2f %9d\n", 'all', scalar @all,
+    @all / $elapsed, 1000 * percentile(\@all, 0.50),
+    1000 * percentile(\@all, 0.99), 1000 * (@all ? $all[-1] : 0), $nto;
+
+for (my $k = 1; $k < $next_open; $k++) {
+    next unless $c[$k] && $c[$k]{state} ne 'dead';
+    $c[$k]{sock}->blocking(1);
+    syswrite($c[$k]{sock}, "QUIT\r\n");
+    close($c[$k]{sock});
+}
+exit 0;
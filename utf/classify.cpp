@@ -291,6 +291,7 @@ void BuildAndOutputTable(FILE *fp, FILE *fpBody, FILE *fpInclude, char *UpperPre
     oc.fpInclude = fpInclude;
     oc.UpperPrefix = UpperPrefix;
     oc.LowerPrefix = LowerPrefix;
+    oc.IdentityValue = 1;
     sm.OutputTables(&oc, NULL);
 }
 
@@ -283,6 +283,7 @@ void BuildAndOutputTable(FILE *fp, FILE *fpBody, FILE *fpInclude, char *UpperPre
     oc.fpInclude = fpInclude;
     oc.UpperPrefix = UpperPrefix;
     oc.LowerPrefix = LowerPrefix;
+    oc.IdentityValue = IDENTITY_SELF;
     sm.OutputTables(&oc, NULL);
 }
 
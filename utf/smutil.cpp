@@ -1176,6 +1176,8 @@ void StateMachine::OutputTables(OutputControl *poc, OutputStatus *pos)
             }
         }
         fprintf(poc->fpBody, "\n};\n");
+
+        OutputFastTables(poc, piBlob, piBlobOffsets, iAcceptingStatesStart);
     }
 
 CleanUp:
@@ -1189,6 +1191,178 @@ CleanUp:
     }
 }
 
+// Run the compressed tables exactly as the server does.  Returns the accepting
+// state reached within the n bytes, or -1 if the machine wants more.  It may
+// accept before the last byte when the lead byte alone decides the answer.
+//
+int StateMachine::RunCompressed(int *piBlob, int *piBlobOffsets, int iAcceptingStatesStart, const UTF8 *p, int n)
+{
+    int iState = 0;
+    for (int i = 0; i < n; i++)
+    {
+        int iColumn = m_itt[p[i]];
+        int Offset = piBlobOffsets[iState];
+        for (;;)
+        {
+            int y = piBlob[Offset];
+            if (0 < y)
+            {
+                // RUN phrase.
+                //
+                if (iColumn < y)
+                {
+                    iState = piBlob[Offset+1];
+                    break;
+                }
+                else
+                {
+                    iColumn -= y;
+                    Offset += 2;
+                }
+            }
+            else
+            {
+                // COPY phrase.
+                //
+                y = -y;
+                if (iColumn < y)
+                {
+                    iState = piBlob[Offset+iColumn+1];
+                    break;
+                }
+                else
+                {
+                    iColumn -= y;
+                    Offset += y + 1;
+                }
+            }
+        }
+
+        if (iAcceptingStatesStart <= iState)
+        {
+            return iState - iAcceptingStatesStart;
+        }
+    }
+    return -1;
+}
+
+// The fast table gives the accepting state for every code point below U+0800
+// in a single lookup, and the ASCII identity bitmap lets callers pass runs of
+// unaffected ASCII through in bulk.  Neither is emitted unless every one of
+// those code points is accepted by the machine.
+//
+#define FAST_LIMIT 0x800
+
+void StateMachine::OutputFastTables(OutputControl *poc, int *piBlob, int *piBlobOffsets, int iAcceptingStatesStart)
+{
+    int aFast[FAST_LIMIT];
+    int nLargest = 0;
+    int i;
+    for (i = 1; i < FAST_LIMIT; i++)
+    {
+        UTF8 aBytes[2];
+        int nBytes;
+        if (i < 0x80)
+        {
+            aBytes[0] = static_cast<UTF8>(i);
+            nBytes = 1;
+        }
+        else
+        {
+            aBytes[0] = static_cast<UTF8>(0xC0 | (i >> 6));
+            aBytes[1] = static_cast<UTF8>(0x80 | (i & 0x3F));
+            nBytes = 2;
+        }
+
+        aFast[i] = RunCompressed(piBlob, piBlobOffsets, iAcceptingStatesStart, aBytes, nBytes);
+        if (aFast[i] < 0)
+        {
+            fprintf(stderr, "U+%04X is not accepted. No fast table.\n", i);
+            return;
+        }
+
+        if (nLargest < aFast[i])
+        {
+            nLargest = aFast[i];
+        }
+    }
+
+    // The terminating '\0' is never looked up.
+    //
+    aFast[0] = 0;
+
+    const char *pType = (nLargest < 256) ? "unsigned char" : "unsigned short";
+    fprintf(poc->fpInclude, "#define %s_FAST_LIMIT (0x%X)\n", poc->UpperPrefix, FAST_LIMIT);
+    fprintf(poc->fpInclude, "extern const %s %s_fast[%d];\n", pType, poc->LowerPrefix, FAST_LIMIT);
+    fprintf(poc->fpBody, "\nconst %s %s_fast[%d] =\n", pType, poc->LowerPrefix, FAST_LIMIT);
+    fprintf(poc->fpBody, "{\n");
+    for (i = 0; i < FAST_LIMIT; i++)
+    {
+        int j = i % 16;
+        if (0 == j)
+        {
+            fprintf(poc->fpBody, "    ");
+        }
+
+        fprintf(poc->fpBody, " %3d", aFast[i]);
+        if (i < FAST_LIMIT-1)
+        {
+            fprintf(poc->fpBody, ",");
+        }
+
+        if (7 == j)
+        {
+            fprintf(poc->fpBody, " ");
+        }
+
+        if (15 == j)
+        {
+            fprintf(poc->fpBody, "\n");
+        }
+    }
+    fprintf(poc->fpBody, "};\n");
+
+    if (IDENTITY_NONE == poc->IdentityValue)
+    {
+        return;
+    }
+
+    unsigned char aBitmap[16];
+    memset(aBitmap, 0, sizeof(aBitmap));
+    for (i = 1; i < 0x80; i++)
+    {
+        int iIdentity = (IDENTITY_SELF == poc->IdentityValue) ? i : poc->IdentityValue;
+        if (aFast[i] == iIdentity)
+        {
+            aBitmap[i >> 3] = static_cast<unsigned char>(aBitmap[i >> 3] | (1 << (i & 7)));
+        }
+    }
+
+    fprintf(poc->fpInclude, "extern const unsigned char %s_aid[16];\n", poc->LowerPrefix);
+    fprintf(poc->fpBody, "\nconst unsigned char %s_aid[16] =\n", poc->LowerPrefix);
+    fprintf(poc->fpBody, "{\n");
+    for (i = 0; i < 16; i++)
+    {
+        int j = i % 8;
+        if (0 == j)
+        {
+            fprintf(poc->fpBody, "    ");
+        }
+
+        fprintf(poc->fpBody, " 0x%02X", aBitmap[i]);
+        if (i < 16-1)
+        {
+            fprintf(poc->fpBody, ",");
+        }
+
+        if (7 == j)
+        {
+            fprintf(poc->fpBody, "\n");
+        }
+    }
+    fprintf(poc->fpBody, "};\n");
+}
+
 void StateMachine::TestString(UTF8 *pStart, UTF8 *pEnd, int AcceptingState)
 {
     State *pState = m_StartingState;
@@ -15,12 +15,19 @@ typedef struct State
     struct State *next[256];
 } State;
 
+// The ASCII identity bitmap marks the bytes whose accepting state is
+// IdentityValue, or the byte itself when IdentityValue is IDENTITY_SELF.
+//
+#define IDENTITY_NONE (-2)
+#define IDENTITY_SELF (-1)
+
 typedef struct OutputControl
 {
     FILE *fpBody;
     FILE *fpInclude;
     char *UpperPrefix;
     char *LowerPrefix;
+    int   IdentityValue;
 } OutputControl;
 
 typedef struct OutputStatus
@@ -57,6 +64,8 @@ private:
     void FreeState(State *p);
     bool RowsEqual(State *p, State *q);
     bool ColumnsEqual(int iColumn, int jColumn);
+    int  RunCompressed(int *piBlob, int *piBlobOffsets, int iAcceptingStatesStart, const UTF8 *p, int n);
+    void OutputFastTables(OutputControl *poc, int *piBlob, int *piBlobOffsets, int iAcceptingStatesStart);
 
     // Special States.
     //
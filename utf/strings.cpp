@@ -548,6 +548,7 @@ void BuildAndOutputTable(FILE *fp, FILE *fpBody, FILE *fpInclude, char *UpperPre
     oc.fpInclude = fpInclude;
     oc.UpperPrefix = UpperPrefix;
     oc.LowerPrefix = LowerPrefix;
+    oc.IdentityValue = g_bDefault ? g_iDefaultState : IDENTITY_NONE;
     sm.OutputTables(&oc, NULL);
 
     fprintf(fpBody, "\n");